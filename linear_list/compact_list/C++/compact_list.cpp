@@ -0,0 +1,911 @@
+/*****************************************************************************************************************************
+ * File name:	compact_list.cpp
+ * Author:	guoke
+ * Date:	2026.10.19
+ * Description:	C++紧凑双向循环链表的源文件，该文件包含了compact_list.h中模板类COMPACT_LIST_NODE和COMPACT_LIST的实现。
+ * History:	1. 2026.10.19 创建并完成初始版本
+ *			2. 2026.10.19 LoadImage()在丢弃原有结点之前检查元数据和每个结点的下标，损坏的缓冲区不再导致越界访问
+ ****************************************************************************************************************************/
+
+#include <iostream>
+#include <cstring>
+#include <climits>
+#include <type_traits>
+#include "compact_list.h"
+
+using namespace std;
+
+#define COMPACT_LIST_MIN_CAPACITY	16u				// 第一次申请结点空间时的最小容量
+
+
+/* SaveImage()写入缓冲区的链表元数据，之后紧跟used个结点 */
+typedef struct COMPACT_LIST_IMAGE_HEADER{
+	uint32_t	node_size;				// 结点的字节数，用于检查缓冲区与链表类型是否匹配
+	uint32_t	used;					// 已使用的结点个数
+	uint32_t	first;					// 第一个结点的下标
+	uint32_t	free_head;				// 空闲链表的第一个结点的下标
+	uint32_t	slider;					// 游标
+	int32_t		length;					// 链表长度
+}COMPACT_LIST_IMAGE_HEADER;
+
+/****************************************************************** COMPACT_LIST_NODE类型API ****************************************************************/
+
+/*
+ * Function:		COMPACT_LIST_NODE()
+ * Description:		COMPACT_LIST_NODE类的无参构造函数，数据域调用其无参构造函数，下标都置为COMPACT_LIST_NIL
+ * Time complexity:	与类T的无参构造函数时间复杂度相同
+ * Input:
+ * Output:
+ * Return:
+ */
+template <typename T>
+COMPACT_LIST_NODE<T>::COMPACT_LIST_NODE():next(COMPACT_LIST_NIL), prior(COMPACT_LIST_NIL), data()
+{
+}
+
+
+
+/*
+ * Function:		SetNextIndex()
+ * Description:		设置该结点的后继结点的下标
+ * Time complexity:	O(1)
+ * Input:
+ *		index:		uint32_t类型，后继结点的下标
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int COMPACT_LIST_NODE<T>::SetNextIndex(uint32_t index)
+{
+	this->next = index;
+	return 0;
+}
+
+
+
+/*
+ * Function:		SetPriorIndex()
+ * Description:		设置该结点的前驱结点的下标
+ * Time complexity:	O(1)
+ * Input:
+ *		index:		uint32_t类型，前驱结点的下标
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int COMPACT_LIST_NODE<T>::SetPriorIndex(uint32_t index)
+{
+	this->prior = index;
+	return 0;
+}
+
+
+
+/*
+ * Function:		GetNextIndex()
+ * Description:		获取该结点的后继结点的下标
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			uint32_t类型，后继结点的下标
+ */
+template <typename T>
+uint32_t COMPACT_LIST_NODE<T>::GetNextIndex() const
+{
+	return this->next;
+}
+
+
+
+/*
+ * Function:		GetPriorIndex()
+ * Description:		获取该结点的前驱结点的下标
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			uint32_t类型，前驱结点的下标
+ */
+template <typename T>
+uint32_t COMPACT_LIST_NODE<T>::GetPriorIndex() const
+{
+	return this->prior;
+}
+
+
+
+/*
+ * Function:		SetData()
+ * Description:		设置该结点的数据域的值
+ * Time complexity:	与类T的重载的赋值操作符时间复杂度相同
+ * Input:
+ *		data:		const T&类型，要设置的数据域的值
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int COMPACT_LIST_NODE<T>::SetData(const T& data)
+{
+	this->data = data;			// 调用类T重载的赋值操作
+	return 0;
+}
+
+
+
+/*
+ * Function:		GetNodeData()
+ * Description:		获取该结点的数据域的值
+ * Time complexity:	与类T的重载的赋值操作符时间复杂度相同
+ * Input:
+ * Output:
+ *		out_data:	T&类型，通过该引用将该结点的数据传给调用者
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int COMPACT_LIST_NODE<T>::GetNodeData(T& out_data) const
+{
+	out_data = this->data;		// 调用类T重载的赋值操作
+	return 0;
+}
+
+
+
+/*
+ * Function:		GetDataRef()
+ * Description:		获取该结点数据域的常引用，比较时不需要拷贝数据
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			const T&类型，结点数据域的常引用
+ */
+template <typename T>
+const T& COMPACT_LIST_NODE<T>::GetDataRef() const
+{
+	return this->data;
+}
+
+
+/****************************************************************** COMPACT_LIST类型API ****************************************************************/
+
+/*
+ * Function:		COMPACT_LIST()
+ * Description:		COMPACT_LIST类的无参构造函数，构造一个空的链表，不申请结点空间
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:
+ */
+template <typename T>
+COMPACT_LIST<T>::COMPACT_LIST():nodes(NULL), capacity(0), used(0), first(COMPACT_LIST_NIL), free_head(COMPACT_LIST_NIL), slider(COMPACT_LIST_NIL), length(0)
+{
+}
+
+
+
+/*
+ * Function:		COMPACT_LIST()
+ * Description:		COMPACT_LIST类的拷贝构造函数，逐个拷贝结点空间，结点下标保持不变，游标位置也保持不变
+ * Time complexity:	假设类T的赋值操作符时间复杂度为O(m)，则本函数时间复杂度为O(capacity*m)
+ * Input:
+ *		compact_list:	const COMPACT_LIST<T>&类型，要拷贝的链表
+ * Output:
+ * Return:
+ */
+template <typename T>
+COMPACT_LIST<T>::COMPACT_LIST(const COMPACT_LIST<T>& compact_list):nodes(NULL), capacity(0), used(0), first(COMPACT_LIST_NIL), free_head(COMPACT_LIST_NIL), slider(COMPACT_LIST_NIL), length(0)
+{
+	*this = compact_list;
+}
+
+
+
+/*
+ * Function:		~COMPACT_LIST()
+ * Description:		COMPACT_LIST类的析构函数，一次性释放结点空间
+ * Time complexity:	与类T的析构函数时间复杂度相同
+ * Input:
+ * Output:
+ * Return:
+ */
+template <typename T>
+COMPACT_LIST<T>::~COMPACT_LIST()
+{
+	if (this->nodes != NULL)
+	{
+		delete[] this->nodes;
+		this->nodes = NULL;
+	}
+}
+
+
+
+/*
+ * Function:		operator=()
+ * Description:		赋值操作符，与拷贝构造函数相同，结点下标保持不变
+ * Time complexity:	假设类T的赋值操作符时间复杂度为O(m)，则本函数时间复杂度为O(capacity*m)
+ * Input:
+ *		compact_list:	const COMPACT_LIST<T>&类型，要拷贝的链表
+ * Output:
+ * Return:			COMPACT_LIST&类型，本链表
+ */
+template <typename T>
+COMPACT_LIST<T>& COMPACT_LIST<T>::operator=(const COMPACT_LIST<T>& compact_list)
+{
+	if (this == &compact_list)
+	{
+		return *this;
+	}
+
+	// 申请与被拷贝链表相同容量的空间
+	COMPACT_LIST_NODE<T>* new_nodes = NULL;
+	if (compact_list.capacity > 0)
+	{
+		new_nodes = new COMPACT_LIST_NODE<T>[compact_list.capacity];
+		if (new_nodes == NULL)
+		{
+			cout << "func COMPACT_LIST<T>::operator=() err: new_nodes == NULL" << endl;
+			return *this;
+		}
+
+		// 结点中只有下标，拷贝之后链接关系不变
+		for (uint32_t i = 0; i < compact_list.used; ++i)
+		{
+			new_nodes[i] = compact_list.nodes[i];		// 调用类T重载的赋值操作
+		}
+	}
+
+	if (this->nodes != NULL)
+	{
+		delete[] this->nodes;
+	}
+	this->nodes = new_nodes;
+	this->capacity = compact_list.capacity;
+	this->used = compact_list.used;
+	this->first = compact_list.first;
+	this->free_head = compact_list.free_head;
+	this->slider = compact_list.slider;
+	this->length = compact_list.length;
+
+	return *this;
+}
+
+
+
+/*
+ * Function:		Clear()
+ * Description:		将链表置为空表，结点空间保留，用于之后的插入
+ * Time complexity:	假设类T的赋值操作符时间复杂度为O(m)，则本函数时间复杂度为O(n*m)
+ * Input:
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int COMPACT_LIST<T>::Clear()
+{
+	// 重置已使用过的结点的数据，释放其持有的资源
+	for (uint32_t i = 0; i < this->used; ++i)
+	{
+		this->nodes[i] = COMPACT_LIST_NODE<T>();
+	}
+
+	// 所有结点回到未使用状态，不需要逐个放回空闲链表
+	this->used = 0;
+	this->first = COMPACT_LIST_NIL;
+	this->free_head = COMPACT_LIST_NIL;
+	this->slider = COMPACT_LIST_NIL;
+	this->length = 0;
+
+	return 0;
+}
+
+
+
+/*
+ * Function:		GetLength()
+ * Description:		获取链表长度
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			int类型，操作成功返回链表长度，操作失败返回负数
+ */
+template <typename T>
+int COMPACT_LIST<T>::GetLength() const
+{
+	return this->length;
+}
+
+
+
+/*
+ * Function:		IsEmpty()
+ * Description:		判断链表是否为空表
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			bool类型，如果链表为空表返回true，如果链表不为空表则返回false
+ */
+template <typename T>
+bool COMPACT_LIST<T>::IsEmpty() const
+{
+	return (this->length == 0) ? true : false;
+}
+
+
+
+/*
+ * Function:		GetCapacity()
+ * Description:		获取结点空间能容纳的结点个数
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			int类型，结点空间的容量
+ */
+template <typename T>
+int COMPACT_LIST<T>::GetCapacity() const
+{
+	return (int)this->capacity;
+}
+
+
+
+/*
+ * Function:		Reserve()
+ * Description:		预先申请至少能容纳new_capacity个结点的空间，之后的插入在容量用完之前不再申请空间
+ * Time complexity:	假设类T的赋值操作符时间复杂度为O(m)，则本函数时间复杂度为O(capacity*m)
+ * Input:
+ *		new_capacity:	int类型，需要的容量
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int COMPACT_LIST<T>::Reserve(int new_capacity)
+{
+	// 参数检查，下标COMPACT_LIST_NIL保留为空下标
+	if (new_capacity < 0 || (uint32_t)new_capacity >= COMPACT_LIST_NIL)
+	{
+		cout << "func COMPACT_LIST<T>::Reserve() err: new_capacity < 0 || new_capacity >= COMPACT_LIST_NIL" << endl;
+		return -1;
+	}
+
+	// 容量已经足够
+	if ((uint32_t)new_capacity <= this->capacity)
+	{
+		return 0;
+	}
+
+	// 申请新空间并搬移已使用的结点，下标不变，所以不需要修改任何链接
+	COMPACT_LIST_NODE<T>* new_nodes = new COMPACT_LIST_NODE<T>[new_capacity];
+	if (new_nodes == NULL)
+	{
+		cout << "func COMPACT_LIST<T>::Reserve() err: new_nodes == NULL" << endl;
+		return -2;
+	}
+	for (uint32_t i = 0; i < this->used; ++i)
+	{
+		new_nodes[i] = this->nodes[i];
+	}
+
+	if (this->nodes != NULL)
+	{
+		delete[] this->nodes;
+	}
+	this->nodes = new_nodes;
+	this->capacity = (uint32_t)new_capacity;
+
+	return 0;
+}
+
+
+
+/*
+ * Function:		ResetSlider()
+ * Description:		重置链表的游标，如果链表中有结点，游标指向第一个结点；如果链表中没有结点，游标置COMPACT_LIST_NIL
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int COMPACT_LIST<T>::ResetSlider()
+{
+	this->slider = this->first;				// 空表时first为COMPACT_LIST_NIL
+	return 0;
+}
+
+
+
+/*
+ * Function:		GetSlider()
+ * Description:		获取链表游标指向的结点数据
+ * Time complexity:	与类T的重载的赋值操作符的时间复杂度相同
+ * Input:
+ * Output:
+ *		out_data:	T&类型，通过该引用，将游标指向的结点的数据传给调用者
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int COMPACT_LIST<T>::GetSlider(T& out_data) const
+{
+	// 如果链表为空表时，报错
+	if (this->length == 0)
+	{
+		cout << "func COMPACT_LIST<T>::GetSlider() err: this->length == 0" << endl;
+		return -1;
+	}
+
+	this->nodes[this->slider].GetNodeData(out_data);
+	return 0;
+}
+
+
+
+/*
+ * Function:		SliderForward()
+ * Description:		获取当前游标指向的结点的数据，游标指向其后继结点
+ * Time complexity:	与类T的重载的赋值操作符的时间复杂度相同
+ * Input:
+ * Output:
+ *		out_data:	T&类型，通过该引用，将游标指向的结点的数据传给调用者
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int COMPACT_LIST<T>::SliderForward(T& out_data)
+{
+	// 如果链表为空表，报错
+	if (this->length == 0)
+	{
+		cout << "func COMPACT_LIST<T>::SliderForward() err: this->length == 0" << endl;
+		return -1;
+	}
+
+	this->nodes[this->slider].GetNodeData(out_data);
+	this->slider = this->nodes[this->slider].GetNextIndex();
+	return 0;
+}
+
+
+
+/*
+ * Function:		SliderBackward()
+ * Description:		获取当前游标指向的结点的数据，游标指向其前驱结点
+ * Time complexity:	与类T的重载的赋值操作符的时间复杂度相同
+ * Input:
+ * Output:
+ *		out_data:	T&类型，通过该引用，将游标指向的结点的数据传给调用者
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int COMPACT_LIST<T>::SliderBackward(T& out_data)
+{
+	// 如果链表为空表，报错
+	if (this->length == 0)
+	{
+		cout << "func COMPACT_LIST<T>::SliderBackward() err: this->length == 0" << endl;
+		return -1;
+	}
+
+	this->nodes[this->slider].GetNodeData(out_data);
+	this->slider = this->nodes[this->slider].GetPriorIndex();
+	return 0;
+}
+
+
+
+/*
+ * Function:		InsertBeforeSlider()
+ * Description:		在游标指向的结点前面插入一个结点，并将游标指向插入的结点，在第一个结点之前插入的话，插入的结点成为第一个结点
+ * Time complexity:	均摊与类T的重载的赋值操作符的时间复杂度相同，结点空间用完时需要扩容
+ * Input:
+ *		data:		const T&类型，插入的数据
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int COMPACT_LIST<T>::InsertBeforeSlider(const T& data)
+{
+	// 申请结点，扩容之后nodes的地址可能改变，所以之后都通过下标访问结点
+	uint32_t node_index = this->AllocNode(data);
+	if (node_index == COMPACT_LIST_NIL)
+	{
+		cout << "func COMPACT_LIST<T>::InsertBeforeSlider() err: node_index == COMPACT_LIST_NIL" << endl;
+		return -1;
+	}
+
+	// 如果链表为空表，结点自己构成一个环
+	if (this->length == 0)
+	{
+		this->nodes[node_index].SetNextIndex(node_index);
+		this->nodes[node_index].SetPriorIndex(node_index);
+		this->first = node_index;
+	}
+	// 如果链表不为空，插入到游标指向的结点之前
+	else
+	{
+		uint32_t slider_prior = this->nodes[this->slider].GetPriorIndex();
+
+		this->nodes[node_index].SetNextIndex(this->slider);
+		this->nodes[node_index].SetPriorIndex(slider_prior);
+		this->nodes[slider_prior].SetNextIndex(node_index);
+		this->nodes[this->slider].SetPriorIndex(node_index);
+
+		// 如果插入之前slider指向第一个结点，那么插入之后，插入的结点变成第一个结点
+		if (this->first == this->slider)
+		{
+			this->first = node_index;
+		}
+	}
+
+	// 插入完成之后slider指向插入结点，链表长度加1
+	this->slider = node_index;
+	this->length ++;
+
+	return 0;
+}
+
+
+
+/*
+ * Function:		InsertAfterSlider()
+ * Description:		在游标指向的结点后面插入一个结点，并将游标指向插入的结点
+ * Time complexity:	均摊与类T的重载的赋值操作符的时间复杂度相同，结点空间用完时需要扩容
+ * Input:
+ *		data:		const T&类型，插入的数据
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int COMPACT_LIST<T>::InsertAfterSlider(const T& data)
+{
+	// 申请结点
+	uint32_t node_index = this->AllocNode(data);
+	if (node_index == COMPACT_LIST_NIL)
+	{
+		cout << "func COMPACT_LIST<T>::InsertAfterSlider() err: node_index == COMPACT_LIST_NIL" << endl;
+		return -1;
+	}
+
+	// 如果链表为空表，结点自己构成一个环
+	if (this->length == 0)
+	{
+		this->nodes[node_index].SetNextIndex(node_index);
+		this->nodes[node_index].SetPriorIndex(node_index);
+		this->first = node_index;
+	}
+	// 如果链表不为空，插入到游标指向的结点之后
+	else
+	{
+		uint32_t slider_next = this->nodes[this->slider].GetNextIndex();
+
+		this->nodes[node_index].SetNextIndex(slider_next);
+		this->nodes[node_index].SetPriorIndex(this->slider);
+		this->nodes[this->slider].SetNextIndex(node_index);
+		this->nodes[slider_next].SetPriorIndex(node_index);
+	}
+
+	// 插入完成之后slider指向插入结点，链表长度加1
+	this->slider = node_index;
+	this->length ++;
+
+	return 0;
+}
+
+
+
+/*
+ * Function:			DeleteSlider()
+ * Description:			删除游标指向的结点，获取删除结点的数据，游标指向删除结点的后继结点，结点放回空闲链表。如果删除的是第一个结点，被删除结点的后继结点将会变成第一个结点。如果删除之后链表变为空表，游标置COMPACT_LIST_NIL
+ * Time complexity:		与类T重载的赋值操作符时间复杂度相同
+ * Input:
+ * Output:
+ *		deleted_data:	T&类型，通过该引用将删除的结点数据传出给调用者
+ * Return:				int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int COMPACT_LIST<T>::DeleteSlider(T& deleted_data)
+{
+	// 如果链表为空表，报错
+	if (this->length == 0)
+	{
+		cout << "func COMPACT_LIST<T>::DeleteSlider() err: this->length == 0" << endl;
+		return -1;
+	}
+
+	uint32_t deleted_index = this->slider;
+	this->nodes[deleted_index].GetNodeData(deleted_data);
+
+	// 如果删除结点之后链表变为空表，游标置空
+	if (this->length == 1)
+	{
+		this->first = COMPACT_LIST_NIL;
+		this->slider = COMPACT_LIST_NIL;
+	}
+	// 如果删除结点之后还有其他结点，游标指向其后继结点
+	else
+	{
+		uint32_t slider_prior = this->nodes[deleted_index].GetPriorIndex();
+		uint32_t slider_next = this->nodes[deleted_index].GetNextIndex();
+
+		this->nodes[slider_prior].SetNextIndex(slider_next);
+		this->nodes[slider_next].SetPriorIndex(slider_prior);
+		this->slider = slider_next;
+
+		// 如果删除的结点是第一个结点，则其后继结点成为第一个结点
+		if (this->first == deleted_index)
+		{
+			this->first = slider_next;
+		}
+	}
+
+	// 结点放回空闲链表，链表长度减1
+	this->FreeNode(deleted_index);
+	this->length --;
+
+	return 0;
+}
+
+
+
+/*
+ * Function:		SetSlider()
+ * Description:		如果链表中存在某个结点包含数据data，将游标指向第一个包含该数据的结点
+ * Time complexity:	假设类T重载的==操作符时间复杂度为O(m)，则该函数时间复杂度为O(n*m)
+ * Input:
+ *		data:		const T&类型，在链表中匹配该数据
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int COMPACT_LIST<T>::SetSlider(const T& data)
+{
+	// 如果链表为空表，报错
+	if (this->length == 0)
+	{
+		cout << "func COMPACT_LIST<T>::SetSlider() err: this->length == 0" << endl;
+		return -1;
+	}
+
+	// 遍历链表，查找第一个包含data的结点
+	uint32_t current_index = this->first;
+	for (int i = 0; i < this->length; ++i)
+	{
+		if (data == this->nodes[current_index].GetDataRef())
+		{
+			this->slider = current_index;
+			return 0;
+		}
+		current_index = this->nodes[current_index].GetNextIndex();
+	}
+
+	// 如果没有找到，报错
+	cout << "func COMPACT_LIST<T>::SetSlider() err: data not found" << endl;
+	return -2;
+}
+
+
+
+/*
+ * Function:		Traverse()
+ * Description:		遍历链表，每个结点的数据data作为参数，调用函数visit()，不改变游标
+ * Time complexity:	假设类T重载的赋值操作符时间复杂度为O(m)，visit()的时间复杂度为O(t)，则本函数时间复杂度为O(n*m + n*t)
+ * Input:
+ *		visit:		int (*)(T& data)类型，函数指针，以类T的引用为参数
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int COMPACT_LIST<T>::Traverse(int (*visit)(T& data))
+{
+	uint32_t current_index = this->first;
+	for (int i = 0; i < this->length; ++i)
+	{
+		T current_node_data;								// 用来暂存当前结点的数据
+		this->nodes[current_index].GetNodeData(current_node_data);
+
+		int func_status = visit(current_node_data);
+		if (func_status != 0)
+		{
+			cout << "func COMPACT_LIST<T>::Traverse() err: func_status != 0" << endl;
+			return -1;
+		}
+
+		current_index = this->nodes[current_index].GetNextIndex();
+	}
+	return 0;
+}
+
+
+
+/*
+ * Function:		GetImageSize()
+ * Description:		获取SaveImage()需要的缓冲区大小，即链表元数据加上已使用的结点空间的字节数
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			int类型，缓冲区的字节数
+ */
+template <typename T>
+int COMPACT_LIST<T>::GetImageSize() const
+{
+	return (int)(sizeof(COMPACT_LIST_IMAGE_HEADER) + sizeof(COMPACT_LIST_NODE<T>) * this->used);
+}
+
+
+
+/*
+ * Function:		SaveImage()
+ * Description:		用memcpy把整个链表（包括游标和空闲链表）写入缓冲区，要求T是可平凡拷贝的类型
+ * Time complexity:	O(used)，一次内存拷贝
+ * Input:
+ *		buffer_size:	int类型，缓冲区的字节数，不能小于GetImageSize()
+ * Output:
+ *		buffer:			void*类型，写入的缓冲区
+ * Return:			int类型，操作成功返回写入的字节数，操作失败返回负数
+ */
+template <typename T>
+int COMPACT_LIST<T>::SaveImage(void* buffer, int buffer_size) const
+{
+	static_assert(std::is_trivially_copyable<T>::value, "COMPACT_LIST<T>::SaveImage() requires a trivially copyable T");
+
+	// 参数检查
+	if (buffer == NULL || buffer_size < this->GetImageSize())
+	{
+		cout << "func COMPACT_LIST<T>::SaveImage() err: buffer == NULL || buffer_size < this->GetImageSize()" << endl;
+		return -1;
+	}
+
+	// 写入元数据
+	COMPACT_LIST_IMAGE_HEADER image_header;
+	image_header.node_size = (uint32_t)sizeof(COMPACT_LIST_NODE<T>);
+	image_header.used = this->used;
+	image_header.first = this->first;
+	image_header.free_head = this->free_head;
+	image_header.slider = this->slider;
+	image_header.length = this->length;
+	memcpy(buffer, &image_header, sizeof(image_header));
+
+	// 结点之间只有下标，整块拷贝即可
+	if (this->used > 0)
+	{
+		memcpy((char*)buffer + sizeof(image_header), this->nodes, sizeof(COMPACT_LIST_NODE<T>) * this->used);
+	}
+
+	return this->GetImageSize();
+}
+
+
+
+/*
+ * Function:		LoadImage()
+ * Description:		用memcpy从SaveImage()写入的缓冲区恢复整个链表，原有结点被丢弃，要求T是可平凡拷贝的类型。
+ *					先检查元数据和每个结点的下标，缓冲区被截断或损坏时返回-2，原有结点保持不变
+ * Time complexity:	O(used)，一次检查和一次内存拷贝
+ * Input:
+ *		buffer:			const void*类型，SaveImage()写入的缓冲区
+ *		buffer_size:	int类型，缓冲区的字节数
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int COMPACT_LIST<T>::LoadImage(const void* buffer, int buffer_size)
+{
+	static_assert(std::is_trivially_copyable<T>::value, "COMPACT_LIST<T>::LoadImage() requires a trivially copyable T");
+
+	// 参数检查
+	if (buffer == NULL || buffer_size < (int)sizeof(COMPACT_LIST_IMAGE_HEADER))
+	{
+		cout << "func COMPACT_LIST<T>::LoadImage() err: buffer == NULL || buffer_size < sizeof(COMPACT_LIST_IMAGE_HEADER)" << endl;
+		return -1;
+	}
+
+	// 读取并检查元数据：结点数不超过int的范围，下标都小于used或为COMPACT_LIST_NIL，空表与非空表的下标一致
+	COMPACT_LIST_IMAGE_HEADER image_header;
+	memcpy(&image_header, buffer, sizeof(image_header));
+	if (image_header.node_size != sizeof(COMPACT_LIST_NODE<T>)
+		|| image_header.used > (uint32_t)INT_MAX
+		|| (uint64_t)buffer_size < sizeof(image_header) + (uint64_t)sizeof(COMPACT_LIST_NODE<T>) * image_header.used
+		|| image_header.length < 0 || (uint32_t)image_header.length > image_header.used
+		|| (image_header.free_head != COMPACT_LIST_NIL && image_header.free_head >= image_header.used)
+		|| (image_header.length == 0 && (image_header.first != COMPACT_LIST_NIL || image_header.slider != COMPACT_LIST_NIL))
+		|| (image_header.length > 0 && (image_header.first >= image_header.used || image_header.slider >= image_header.used)))
+	{
+		cout << "func COMPACT_LIST<T>::LoadImage() err: image does not match" << endl;
+		return -2;
+	}
+
+	// 检查每个结点的下标，之后的遍历、插入和删除都不会越界
+	for (uint32_t i = 0; i < image_header.used; ++i)
+	{
+		COMPACT_LIST_NODE<T> node;
+		memcpy((void*)&node, (const char*)buffer + sizeof(image_header) + sizeof(COMPACT_LIST_NODE<T>) * i, sizeof(COMPACT_LIST_NODE<T>));
+		if ((node.GetNextIndex() != COMPACT_LIST_NIL && node.GetNextIndex() >= image_header.used)
+			|| (node.GetPriorIndex() != COMPACT_LIST_NIL && node.GetPriorIndex() >= image_header.used))
+		{
+			cout << "func COMPACT_LIST<T>::LoadImage() err: node index out of range" << endl;
+			return -2;
+		}
+	}
+
+	// 丢弃原有结点，保证空间足够后整块拷贝
+	this->Clear();
+	if (this->Reserve((int)image_header.used) != 0)
+	{
+		cout << "func COMPACT_LIST<T>::LoadImage() err: this->Reserve() != 0" << endl;
+		return -3;
+	}
+	if (image_header.used > 0)
+	{
+		memcpy((void*)this->nodes, (const char*)buffer + sizeof(image_header), sizeof(COMPACT_LIST_NODE<T>) * image_header.used);
+	}
+
+	this->used = image_header.used;
+	this->first = image_header.first;
+	this->free_head = image_header.free_head;
+	this->slider = image_header.slider;
+	this->length = image_header.length;
+
+	return 0;
+}
+
+
+
+/*
+ * Function:		AllocNode()
+ * Description:		从空闲链表或未使用的结点中取出一个结点，都用完时扩容，并设置结点数据
+ * Time complexity:	均摊与类T的重载的赋值操作符的时间复杂度相同
+ * Input:
+ *		data:		const T&类型，结点的数据
+ * Output:
+ * Return:			uint32_t类型，结点的下标，操作失败返回COMPACT_LIST_NIL
+ */
+template <typename T>
+uint32_t COMPACT_LIST<T>::AllocNode(const T& data)
+{
+	uint32_t node_index = COMPACT_LIST_NIL;
+
+	// 优先使用空闲链表中的结点
+	if (this->free_head != COMPACT_LIST_NIL)
+	{
+		node_index = this->free_head;
+		this->free_head = this->nodes[node_index].GetNextIndex();
+	}
+	// 其次使用从未使用过的结点，用完时容量翻倍
+	else
+	{
+		if (this->used == this->capacity)
+		{
+			uint64_t new_capacity = (this->capacity < COMPACT_LIST_MIN_CAPACITY) ? COMPACT_LIST_MIN_CAPACITY : (uint64_t)this->capacity * 2;
+			if (new_capacity >= COMPACT_LIST_NIL)
+			{
+				new_capacity = COMPACT_LIST_NIL - 1;
+			}
+			if (new_capacity <= this->capacity || this->Reserve((int)new_capacity) != 0)
+			{
+				return COMPACT_LIST_NIL;
+			}
+		}
+		node_index = this->used;
+		this->used ++;
+	}
+
+	this->nodes[node_index].SetData(data);
+	return node_index;
+}
+
+
+
+/*
+ * Function:		FreeNode()
+ * Description:		将结点的数据重置为T()以释放其持有的资源，并将结点放回空闲链表
+ * Time complexity:	与类T的重载的赋值操作符的时间复杂度相同
+ * Input:
+ *		index:		uint32_t类型，结点的下标
+ * Output:
+ * Return:
+ */
+template <typename T>
+void COMPACT_LIST<T>::FreeNode(uint32_t index)
+{
+	this->nodes[index].SetData(T());
+	this->nodes[index].SetPriorIndex(COMPACT_LIST_NIL);
+	this->nodes[index].SetNextIndex(this->free_head);
+	this->free_head = index;
+}
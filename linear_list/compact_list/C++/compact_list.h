@@ -0,0 +1,379 @@
+/*****************************************************************************************************************************
+ * File name:	compact_list.h
+ * Author:	guoke
+ * Date:	2026.10.19
+ * Description:	C++紧凑双向循环链表的头文件，该文件包含了模板类COMPACT_LIST_NODE和COMPACT_LIST的声明，其实现包含在文件compact_list.cpp中。
+ *				所有结点存放在一块可增长的连续空间中，结点之间用32位下标而不是指针链接，空闲结点通过下标串成空闲链表。
+ *				因为链表中不保存任何地址，整个链表可以整体搬移，T为可平凡拷贝的类型时可以直接用memcpy序列化。
+ * History:	1. 2026.10.19 创建并完成初始版本
+ *			2. 2026.10.19 LoadImage()检查缓冲区中的元数据和结点下标
+ ****************************************************************************************************************************/
+
+#ifndef _COMPACT_LIST_H_
+#define _COMPACT_LIST_H_
+
+#include <stdint.h>
+
+#define COMPACT_LIST_NIL	0xFFFFFFFFu		// 空下标，相当于链式存储中的NULL
+
+/****************************************************************** COMPACT_LIST_NODE类型，紧凑链表中的结点 ****************************************************************/
+template <typename T>
+class COMPACT_LIST_NODE{
+private:
+	uint32_t	next;								// 后继结点的下标，空闲结点中为下一个空闲结点的下标
+	uint32_t	prior;								// 前驱结点的下标
+	T			data;								// 数据域
+
+public:
+	/*
+	 * Function:		COMPACT_LIST_NODE()
+	 * Description:		COMPACT_LIST_NODE类的无参构造函数，数据域调用其无参构造函数，下标都置为COMPACT_LIST_NIL
+	 * Time complexity:	与类T的无参构造函数时间复杂度相同
+	 * Input:
+	 * Output:
+	 * Return:
+	 */
+	COMPACT_LIST_NODE();
+
+public:
+	/*
+	 * Function:		SetNextIndex()
+	 * Description:		设置该结点的后继结点的下标
+	 * Time complexity:	O(1)
+	 * Input:
+	 *		index:		uint32_t类型，后继结点的下标
+	 * Output:
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int SetNextIndex(uint32_t index);
+
+	/*
+	 * Function:		SetPriorIndex()
+	 * Description:		设置该结点的前驱结点的下标
+	 * Time complexity:	O(1)
+	 * Input:
+	 *		index:		uint32_t类型，前驱结点的下标
+	 * Output:
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int SetPriorIndex(uint32_t index);
+
+	/*
+	 * Function:		GetNextIndex()
+	 * Description:		获取该结点的后继结点的下标
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			uint32_t类型，后继结点的下标
+	 */
+	uint32_t GetNextIndex() const;
+
+	/*
+	 * Function:		GetPriorIndex()
+	 * Description:		获取该结点的前驱结点的下标
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			uint32_t类型，前驱结点的下标
+	 */
+	uint32_t GetPriorIndex() const;
+
+	/*
+	 * Function:		SetData()
+	 * Description:		设置该结点的数据域的值
+	 * Time complexity:	与类T的重载的赋值操作符时间复杂度相同
+	 * Input:
+	 *		data:		const T&类型，要设置的数据域的值
+	 * Output:
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int SetData(const T& data);
+
+	/*
+	 * Function:		GetNodeData()
+	 * Description:		获取该结点的数据域的值
+	 * Time complexity:	与类T的重载的赋值操作符时间复杂度相同
+	 * Input:
+	 * Output:
+	 *		out_data:	T&类型，通过该引用将该结点的数据传给调用者
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int GetNodeData(T& out_data) const;
+
+	/*
+	 * Function:		GetDataRef()
+	 * Description:		获取该结点数据域的常引用，比较时不需要拷贝数据
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			const T&类型，结点数据域的常引用
+	 */
+	const T& GetDataRef() const;
+};
+
+
+
+/****************************************************************** COMPACT_LIST类型，下标链接的双向循环链表 ****************************************************************/
+template <typename T>
+class COMPACT_LIST{
+private:
+	COMPACT_LIST_NODE<T>*	nodes;				// 存放所有结点的连续空间
+	uint32_t				capacity;			// nodes中结点的个数
+	uint32_t				used;				// nodes中曾经被使用过的结点个数，下标不小于used的结点从未使用过
+	uint32_t				first;				// 第一个结点的下标，空表时为COMPACT_LIST_NIL
+	uint32_t				free_head;			// 空闲链表的第一个结点的下标
+	uint32_t				slider;				// 游标，用来辅助定位，空表时为COMPACT_LIST_NIL
+	int						length;				// 链表长度
+
+public:
+	/*
+	 * Function:		COMPACT_LIST()
+	 * Description:		COMPACT_LIST类的无参构造函数，构造一个空的链表，不申请结点空间
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:
+	 */
+	COMPACT_LIST();
+
+	/*
+	 * Function:		COMPACT_LIST()
+	 * Description:		COMPACT_LIST类的拷贝构造函数，逐个拷贝结点空间，结点下标保持不变，游标位置也保持不变
+	 * Time complexity:	假设类T的赋值操作符时间复杂度为O(m)，则本函数时间复杂度为O(capacity*m)
+	 * Input:
+	 *		compact_list:	const COMPACT_LIST<T>&类型，要拷贝的链表
+	 * Output:
+	 * Return:
+	 */
+	COMPACT_LIST(const COMPACT_LIST& compact_list);
+
+	/*
+	 * Function:		~COMPACT_LIST()
+	 * Description:		COMPACT_LIST类的析构函数，一次性释放结点空间
+	 * Time complexity:	与类T的析构函数时间复杂度相同
+	 * Input:
+	 * Output:
+	 * Return:
+	 */
+	~COMPACT_LIST();
+
+	/*
+	 * Function:		operator=()
+	 * Description:		赋值操作符，与拷贝构造函数相同，结点下标保持不变
+	 * Time complexity:	假设类T的赋值操作符时间复杂度为O(m)，则本函数时间复杂度为O(capacity*m)
+	 * Input:
+	 *		compact_list:	const COMPACT_LIST<T>&类型，要拷贝的链表
+	 * Output:
+	 * Return:			COMPACT_LIST&类型，本链表
+	 */
+	COMPACT_LIST& operator=(const COMPACT_LIST& compact_list);
+
+public:
+	/*
+	 * Function:		Clear()
+	 * Description:		将链表置为空表，结点空间保留，用于之后的插入
+	 * Time complexity:	假设类T的赋值操作符时间复杂度为O(m)，则本函数时间复杂度为O(n*m)
+	 * Input:
+	 * Output:
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int Clear();
+
+	/*
+	 * Function:		GetLength()
+	 * Description:		获取链表长度
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			int类型，操作成功返回链表长度，操作失败返回负数
+	 */
+	int GetLength() const;
+
+	/*
+	 * Function:		IsEmpty()
+	 * Description:		判断链表是否为空表
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			bool类型，如果链表为空表返回true，如果链表不为空表则返回false
+	 */
+	bool IsEmpty() const;
+
+	/*
+	 * Function:		GetCapacity()
+	 * Description:		获取结点空间能容纳的结点个数
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			int类型，结点空间的容量
+	 */
+	int GetCapacity() const;
+
+	/*
+	 * Function:		Reserve()
+	 * Description:		预先申请至少能容纳new_capacity个结点的空间，之后的插入在容量用完之前不再申请空间
+	 * Time complexity:	假设类T的赋值操作符时间复杂度为O(m)，则本函数时间复杂度为O(capacity*m)
+	 * Input:
+	 *		new_capacity:	int类型，需要的容量
+	 * Output:
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int Reserve(int new_capacity);
+
+	/*
+	 * Function:		ResetSlider()
+	 * Description:		重置链表的游标，如果链表中有结点，游标指向第一个结点；如果链表中没有结点，游标置COMPACT_LIST_NIL
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int ResetSlider();
+
+	/*
+	 * Function:		GetSlider()
+	 * Description:		获取链表游标指向的结点数据
+	 * Time complexity:	与类T的重载的赋值操作符的时间复杂度相同
+	 * Input:
+	 * Output:
+	 *		out_data:	T&类型，通过该引用，将游标指向的结点的数据传给调用者
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int GetSlider(T& out_data) const;
+
+	/*
+	 * Function:		SliderForward()
+	 * Description:		获取当前游标指向的结点的数据，游标指向其后继结点
+	 * Time complexity:	与类T的重载的赋值操作符的时间复杂度相同
+	 * Input:
+	 * Output:
+	 *		out_data:	T&类型，通过该引用，将游标指向的结点的数据传给调用者
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int SliderForward(T& out_data);
+
+	/*
+	 * Function:		SliderBackward()
+	 * Description:		获取当前游标指向的结点的数据，游标指向其前驱结点
+	 * Time complexity:	与类T的重载的赋值操作符的时间复杂度相同
+	 * Input:
+	 * Output:
+	 *		out_data:	T&类型，通过该引用，将游标指向的结点的数据传给调用者
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int SliderBackward(T& out_data);
+
+	/*
+	 * Function:		InsertBeforeSlider()
+	 * Description:		在游标指向的结点前面插入一个结点，并将游标指向插入的结点，在第一个结点之前插入的话，插入的结点成为第一个结点
+	 * Time complexity:	均摊与类T的重载的赋值操作符的时间复杂度相同，结点空间用完时需要扩容
+	 * Input:
+	 *		data:		const T&类型，插入的数据
+	 * Output:
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int InsertBeforeSlider(const T& data);
+
+	/*
+	 * Function:		InsertAfterSlider()
+	 * Description:		在游标指向的结点后面插入一个结点，并将游标指向插入的结点
+	 * Time complexity:	均摊与类T的重载的赋值操作符的时间复杂度相同，结点空间用完时需要扩容
+	 * Input:
+	 *		data:		const T&类型，插入的数据
+	 * Output:
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int InsertAfterSlider(const T& data);
+
+	/*
+	 * Function:			DeleteSlider()
+	 * Description:			删除游标指向的结点，获取删除结点的数据，游标指向删除结点的后继结点，结点放回空闲链表。如果删除的是第一个结点，被删除结点的后继结点将会变成第一个结点。如果删除之后链表变为空表，游标置COMPACT_LIST_NIL
+	 * Time complexity:		与类T重载的赋值操作符时间复杂度相同
+	 * Input:
+	 * Output:
+	 *		deleted_data:	T&类型，通过该引用将删除的结点数据传出给调用者
+	 * Return:				int类型，操作成功返回0，操作失败返回负数
+	 */
+	int DeleteSlider(T& deleted_data);
+
+	/*
+	 * Function:		SetSlider()
+	 * Description:		如果链表中存在某个结点包含数据data，将游标指向第一个包含该数据的结点
+	 * Time complexity:	假设类T重载的==操作符时间复杂度为O(m)，则该函数时间复杂度为O(n*m)
+	 * Input:
+	 *		data:		const T&类型，在链表中匹配该数据
+	 * Output:
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int SetSlider(const T& data);
+
+	/*
+	 * Function:		Traverse()
+	 * Description:		遍历链表，每个结点的数据data作为参数，调用函数visit()，不改变游标
+	 * Time complexity:	假设类T重载的赋值操作符时间复杂度为O(m)，visit()的时间复杂度为O(t)，则本函数时间复杂度为O(n*m + n*t)
+	 * Input:
+	 *		visit:		int (*)(T& data)类型，函数指针，以类T的引用为参数
+	 * Output:
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int Traverse(int (*visit)(T& data));
+
+	/*
+	 * Function:		GetImageSize()
+	 * Description:		获取SaveImage()需要的缓冲区大小，即链表元数据加上已使用的结点空间的字节数
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			int类型，缓冲区的字节数
+	 */
+	int GetImageSize() const;
+
+	/*
+	 * Function:		SaveImage()
+	 * Description:		用memcpy把整个链表（包括游标和空闲链表）写入缓冲区，要求T是可平凡拷贝的类型
+	 * Time complexity:	O(used)，一次内存拷贝
+	 * Input:
+	 *		buffer_size:	int类型，缓冲区的字节数，不能小于GetImageSize()
+	 * Output:
+	 *		buffer:			void*类型，写入的缓冲区
+	 * Return:			int类型，操作成功返回写入的字节数，操作失败返回负数
+	 */
+	int SaveImage(void* buffer, int buffer_size) const;
+
+	/*
+	 * Function:		LoadImage()
+	 * Description:		用memcpy从SaveImage()写入的缓冲区恢复整个链表，原有结点被丢弃，要求T是可平凡拷贝的类型。
+	 *					缓冲区被截断或元数据、结点下标损坏时返回-2，此时原有结点保持不变
+	 * Time complexity:	O(used)，一次内存拷贝
+	 * Input:
+	 *		buffer:			const void*类型，SaveImage()写入的缓冲区
+	 *		buffer_size:	int类型，缓冲区的字节数
+	 * Output:
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int LoadImage(const void* buffer, int buffer_size);
+
+private:
+	/*
+	 * Function:		AllocNode()
+	 * Description:		从空闲链表或未使用的结点中取出一个结点，都用完时扩容，并设置结点数据
+	 * Time complexity:	均摊与类T的重载的赋值操作符的时间复杂度相同
+	 * Input:
+	 *		data:		const T&类型，结点的数据
+	 * Output:
+	 * Return:			uint32_t类型，结点的下标，操作失败返回COMPACT_LIST_NIL
+	 */
+	uint32_t AllocNode(const T& data);
+
+	/*
+	 * Function:		FreeNode()
+	 * Description:		将结点的数据重置为T()以释放其持有的资源，并将结点放回空闲链表
+	 * Time complexity:	与类T的重载的赋值操作符的时间复杂度相同
+	 * Input:
+	 *		index:		uint32_t类型，结点的下标
+	 * Output:
+	 * Return:
+	 */
+	void FreeNode(uint32_t index);
+};
+#endif
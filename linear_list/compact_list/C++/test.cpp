@@ -0,0 +1,190 @@
+/******************************************************************************************************************************************
+ * File name:	test.cpp
+ * Author:	guoke
+ * Date:	2026.10.19
+ * Description:	C++紧凑双向循环链表库compact_list.cpp、compact_list.h的API测试程序
+ * History:	1. 2026.10.19 创建并完成初始版本
+ *			2. 2026.10.19 增加加载截断和损坏的缓冲区的测试
+ *****************************************************************************************************************************************/
+
+#include <iostream>
+#include <string>
+#include <cstring>
+#include "compact_list.cpp"
+
+using namespace std;
+
+
+// TEACHER类型
+class TEACHER{
+private:
+	int age;
+	string name;
+public:
+	TEACHER():age(0),name(""){}											// Constructor
+	TEACHER(int _age, const string _name):age(_age),name(_name){}		// Constructor with parameter
+	TEACHER(const TEACHER& t):age(t.age),name(t.name){}					// Copy constructor
+
+public:
+	/* 输出类信息 */
+	int PrintInfo(){cout << "age = " << age << "\tname = " << name << endl; return 0;}
+
+public:
+	/* 重载赋值操作符 */
+	TEACHER& operator=(const TEACHER& t);
+
+	/* 重载==操作符 */
+	bool operator==(const TEACHER& t) const;
+};
+
+// 打印TEACHER类信息
+int PrintTeacher(TEACHER& t);
+
+// 打印int类型数据
+int PrintInt(int& data);
+
+int main(void)
+{
+	TEACHER t1(21, "teacher_01"), t2(22, "teacher_02"), t3(23, "teacher_03"), t4(24, "teacher_04"), t5(25, "teacher_05");
+	TEACHER tmp;
+
+	// 结点大小
+	cout << "\n***************************************** 结点大小 **********************************" << endl;
+	cout << "sizeof(COMPACT_LIST_NODE<int>) = " << sizeof(COMPACT_LIST_NODE<int>) << endl;
+
+	// 创建链表并插入元素
+	cout << "\n***************************************** 创建链表并插入元素 **********************************" << endl;
+	COMPACT_LIST<TEACHER> teacher_list;
+	teacher_list.InsertAfterSlider(t1);
+	teacher_list.InsertAfterSlider(t2);
+	teacher_list.InsertAfterSlider(t4);
+	teacher_list.InsertBeforeSlider(t3);
+	teacher_list.ResetSlider();
+	teacher_list.SliderBackward(tmp);
+	teacher_list.InsertAfterSlider(t5);
+	cout << "length = " << teacher_list.GetLength() << "\tcapacity = " << teacher_list.GetCapacity() << endl;
+	teacher_list.Traverse(PrintTeacher);
+
+	// 初始化并向后移动游标
+	cout << "\n***************************************** 初始化并向后移动游标 **********************************" << endl;
+	teacher_list.ResetSlider();
+	teacher_list.SliderBackward(tmp);
+	for (int i = 0; i < teacher_list.GetLength(); ++i)
+	{
+		teacher_list.SliderBackward(tmp);
+		tmp.PrintInfo();
+	}
+
+	// 删除结点后再插入，复用空闲结点
+	cout << "\n***************************************** 删除结点后再插入 **********************************" << endl;
+	teacher_list.SetSlider(t3);
+	teacher_list.DeleteSlider(tmp);
+	cout << "deleted: ";
+	tmp.PrintInfo();
+	teacher_list.InsertBeforeSlider(TEACHER(30, "teacher_30"));
+	cout << "length = " << teacher_list.GetLength() << "\tcapacity = " << teacher_list.GetCapacity() << endl;
+	teacher_list.Traverse(PrintTeacher);
+
+	// 拷贝链表，下标不变
+	cout << "\n***************************************** 拷贝链表 **********************************" << endl;
+	COMPACT_LIST<TEACHER> teacher_list_copy(teacher_list);
+	teacher_list.Clear();
+	cout << "original length = " << teacher_list.GetLength() << ", copy length = " << teacher_list_copy.GetLength() << ", copy slider is ";
+	teacher_list_copy.GetSlider(tmp);
+	tmp.PrintInfo();
+	teacher_list_copy.Traverse(PrintTeacher);
+
+	// 大量插入删除之后用memcpy保存和恢复
+	cout << "\n***************************************** 保存和恢复 **********************************" << endl;
+	COMPACT_LIST<int> int_list;
+	int_list.Reserve(1000);
+	for (int i = 0; i < 1000; ++i)
+	{
+		int_list.InsertAfterSlider(i);
+	}
+	int_list.ResetSlider();
+	while (int_list.GetLength() > 5)
+	{
+		int deleted_data = 0;
+		int_list.DeleteSlider(deleted_data);
+	}
+	cout << "length = " << int_list.GetLength() << "\tcapacity = " << int_list.GetCapacity() << "\timage size = " << int_list.GetImageSize() << endl;
+
+	char* image = new char[int_list.GetImageSize()];
+	int image_size = int_list.SaveImage(image, int_list.GetImageSize());
+
+	COMPACT_LIST<int> loaded_list;
+	loaded_list.LoadImage(image, image_size);
+
+	// 截断或损坏的缓冲区被拒绝，链表保持不变；元数据依次为node_size、used、first、free_head、slider、length，各4字节
+	{
+		COMPACT_LIST<int> corrupt_list;
+		char* corrupt_image = new char[image_size];
+		uint32_t bad_index = 0xFFFFFFF0u;
+		int32_t bad_length = 100000;
+
+		corrupt_list.InsertAfterSlider(7);
+		cout << "truncated: " << corrupt_list.LoadImage(image, image_size - 1) << "\t";
+		memcpy(corrupt_image, image, image_size);
+		memcpy(corrupt_image + 8, &bad_index, sizeof(bad_index));
+		cout << "bad first: " << corrupt_list.LoadImage(corrupt_image, image_size) << "\t";
+		memcpy(corrupt_image, image, image_size);
+		memcpy(corrupt_image + 12, &bad_index, sizeof(bad_index));
+		cout << "bad free_head: " << corrupt_list.LoadImage(corrupt_image, image_size) << "\t";
+		memcpy(corrupt_image, image, image_size);
+		memcpy(corrupt_image + 20, &bad_length, sizeof(bad_length));
+		cout << "bad length: " << corrupt_list.LoadImage(corrupt_image, image_size) << "\t";
+		memcpy(corrupt_image, image, image_size);
+		memcpy(corrupt_image + 24, &bad_index, sizeof(bad_index));		// 第0个结点的next
+		cout << "bad node: " << corrupt_list.LoadImage(corrupt_image, image_size) << "\t";
+		cout << "length = " << corrupt_list.GetLength() << ", data: ";
+		corrupt_list.Traverse(PrintInt);
+		cout << endl;
+		delete[] corrupt_image;
+	}
+	delete[] image;
+
+	int slider_data = 0;
+	loaded_list.GetSlider(slider_data);
+	cout << "loaded length = " << loaded_list.GetLength() << ", slider = " << slider_data << ", data: ";
+	loaded_list.Traverse(PrintInt);
+	cout << endl;
+	loaded_list.InsertAfterSlider(2021);
+	cout << "insert after slider: ";
+	loaded_list.Traverse(PrintInt);
+	cout << endl;
+
+	cout << "Hello world!" << endl;
+	return 0;
+}
+
+
+/* Class of TEACHER overloads = */
+TEACHER& TEACHER::operator=(const TEACHER& t)
+{
+	this->age = t.age;
+	this->name = t.name;
+	return *this;
+}
+
+/* Class of TEACHER overloads == */
+bool TEACHER::operator==(const TEACHER& t) const
+{
+	return (age == t.age && name == t.name) ? true : false;
+}
+
+
+
+// 打印TEACHER类信息
+int PrintTeacher(TEACHER& t)
+{
+	t.PrintInfo();
+	return 0;
+}
+
+// 打印int类型数据
+int PrintInt(int& data)
+{
+	cout << data << " ";
+	return 0;
+}
@@ -0,0 +1,124 @@
+/******************************************************************************************************************************************
+ * File name:	bench.cpp
+ * Author:	guoke
+ * Date:	2026.10.19
+ * Description:	细粒度锁链表FINE_LOCK_LIST与用一把std::mutex保护的LINK_LIST的扩展性对比程序。
+ *				键空间按线程数均分，每个线程只在自己的区间内随机插入和删除，线程数从1倍增到上限。
+ *				用法：./bench [线程数上限] [每线程操作数] [键范围]
+ * History:	1. 2026.10.19 创建并完成初始版本
+ *****************************************************************************************************************************************/
+
+#include <iostream>
+#include <cstdlib>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "fine_lock_list.cpp"
+#include "../../link_list/C++/link_list.cpp"
+
+using namespace std;
+
+/* 用一把互斥锁保护的有序LINK_LIST，作为对照组 */
+class MUTEX_LIST{
+private:
+	LINK_LIST<int>	list;
+	std::mutex		list_mutex;
+
+public:
+	/* 按序插入，数据已存在返回-2 */
+	int Insert(int data)
+	{
+		std::lock_guard<std::mutex> guard(list_mutex);
+		LINK_LIST<int>::iterator it = list.begin();
+		while (it != list.end() && *it < data)
+		{
+			++it;
+		}
+		if (it != list.end() && *it == data)
+		{
+			return -2;
+		}
+		list.Insert(it, data);
+		return 0;
+	}
+
+	/* 删除数据，数据不存在返回-2 */
+	int Erase(int data)
+	{
+		std::lock_guard<std::mutex> guard(list_mutex);
+		LINK_LIST<int>::iterator it = list.begin();
+		while (it != list.end() && *it < data)
+		{
+			++it;
+		}
+		if (it == list.end() || *it != data)
+		{
+			return -2;
+		}
+		list.Erase(it);
+		return 0;
+	}
+};
+
+// 工作线程，在[low, high)区间内随机插入和删除
+template <typename LIST>
+void Worker(LIST* list, int id, int op_num, int low, int high)
+{
+	unsigned int seed = id * 7919 + 1;
+	for (int i = 0; i < op_num; ++i)
+	{
+		seed = seed * 1103515245 + 12345;
+		int key = low + (int)((seed >> 8) % (high - low));
+		if ((seed >> 4) & 1)
+		{
+			list->Insert(key);
+		}
+		else
+		{
+			list->Erase(key);
+		}
+	}
+}
+
+// 预先填入一半的键，再用thread_num个线程各自操作一个区间，返回每秒操作数
+template <typename LIST>
+double Run(int thread_num, int op_num, int key_range)
+{
+	LIST list;
+	for (int key = 0; key < key_range; key += 2)
+	{
+		list.Insert(key);
+	}
+
+	int region = key_range / thread_num;
+	vector<thread> threads;
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	for (int i = 0; i < thread_num; ++i)
+	{
+		threads.push_back(thread(Worker<LIST>, &list, i, op_num, i * region, (i + 1) * region));
+	}
+	for (int i = 0; i < thread_num; ++i)
+	{
+		threads[i].join();
+	}
+	double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+	return (double)thread_num * op_num / seconds;
+}
+
+int main(int argc, char* argv[])
+{
+	int max_threads = (argc > 1) ? atoi(argv[1]) : 64;
+	int op_num = (argc > 2) ? atoi(argv[2]) : 2000;
+	int key_range = (argc > 3) ? atoi(argv[3]) : 1024;
+
+	cout << "hardware threads = " << thread::hardware_concurrency() << ", ops per thread = " << op_num << ", key range = " << key_range << endl;
+	cout << "threads\tmutex LINK_LIST (ops/s)\tFINE_LOCK_LIST (ops/s)\tspeedup" << endl;
+	for (int thread_num = 1; thread_num <= max_threads; thread_num *= 2)
+	{
+		double mutex_ops = Run<MUTEX_LIST>(thread_num, op_num, key_range);
+		double fine_ops = Run<FINE_LOCK_LIST<int> >(thread_num, op_num, key_range);
+		cout << thread_num << "\t" << (long long)mutex_ops << "\t\t\t" << (long long)fine_ops << "\t\t\t" << fine_ops / mutex_ops << endl;
+	}
+	return 0;
+}
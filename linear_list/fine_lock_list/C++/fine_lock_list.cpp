@@ -0,0 +1,529 @@
+/*****************************************************************************************************************************
+ * File name:	fine_lock_list.cpp
+ * Author:	guoke
+ * Date:	2026.10.19
+ * Description:	C++细粒度锁并发有序双向链表的源文件，该文件包含了fine_lock_list.h中模板类FINE_LOCK_LIST_NODE和FINE_LOCK_LIST的实现。
+ * History:	1. 2026.10.19 创建并完成初始版本
+ ****************************************************************************************************************************/
+
+#include <iostream>
+#include <thread>
+#include "fine_lock_list.h"
+
+using namespace std;
+
+
+/****************************************************************** FINE_LOCK_LIST_NODE类型API ****************************************************************/
+
+/*
+ * Function:		FINE_LOCK_LIST_NODE()
+ * Description:		FINE_LOCK_LIST_NODE类的无参构造函数，用于构造头尾哨兵结点，前驱后继都置NULL
+ * Time complexity:	与类T的无参构造函数时间复杂度相同
+ * Input:
+ * Output:
+ * Return:
+ */
+template <typename T>
+FINE_LOCK_LIST_NODE<T>::FINE_LOCK_LIST_NODE():next(NULL), prior(NULL), data()
+{
+}
+
+
+
+/*
+ * Function:		FINE_LOCK_LIST_NODE()
+ * Description:		FINE_LOCK_LIST_NODE类的有参构造函数，数据域由调用者指定，前驱后继都置NULL
+ * Time complexity:	与类T的拷贝构造函数时间复杂度相同
+ * Input:
+ *		my_data:	const T&类型，初始化结点的数据域的数据
+ * Output:
+ * Return:
+ */
+template <typename T>
+FINE_LOCK_LIST_NODE<T>::FINE_LOCK_LIST_NODE(const T& my_data):next(NULL), prior(NULL), data(my_data)
+{
+}
+
+
+
+/*
+ * Function:		SetNextNode()
+ * Description:		设置后继结点
+ * Time complexity:	O(1)
+ * Input:
+ *		next_node:	FINE_LOCK_LIST_NODE*类型，后继结点
+ * Output:
+ * Return:
+ */
+template <typename T>
+void FINE_LOCK_LIST_NODE<T>::SetNextNode(FINE_LOCK_LIST_NODE* next_node)
+{
+	this->next = next_node;
+}
+
+
+
+/*
+ * Function:		GetNextNode()
+ * Description:		获取后继结点
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			FINE_LOCK_LIST_NODE*类型，后继结点
+ */
+template <typename T>
+FINE_LOCK_LIST_NODE<T>* FINE_LOCK_LIST_NODE<T>::GetNextNode() const
+{
+	return this->next;
+}
+
+
+
+/*
+ * Function:		SetPriorNode()
+ * Description:		设置前驱结点
+ * Time complexity:	O(1)
+ * Input:
+ *		prior_node:	FINE_LOCK_LIST_NODE*类型，前驱结点
+ * Output:
+ * Return:
+ */
+template <typename T>
+void FINE_LOCK_LIST_NODE<T>::SetPriorNode(FINE_LOCK_LIST_NODE* prior_node)
+{
+	this->prior = prior_node;
+}
+
+
+
+/*
+ * Function:		GetPriorNode()
+ * Description:		获取前驱结点
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			FINE_LOCK_LIST_NODE*类型，前驱结点
+ */
+template <typename T>
+FINE_LOCK_LIST_NODE<T>* FINE_LOCK_LIST_NODE<T>::GetPriorNode() const
+{
+	return this->prior;
+}
+
+
+
+/*
+ * Function:		Lock()
+ * Description:		锁住结点，阻塞直到获得结点锁
+ * Time complexity:	O(1)，不计等待时间
+ * Input:
+ * Output:
+ * Return:
+ */
+template <typename T>
+void FINE_LOCK_LIST_NODE<T>::Lock()
+{
+	this->node_mutex.lock();
+}
+
+
+
+/*
+ * Function:		TryLock()
+ * Description:		尝试锁住结点，不阻塞
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			bool类型，获得结点锁返回true，否则返回false
+ */
+template <typename T>
+bool FINE_LOCK_LIST_NODE<T>::TryLock()
+{
+	return this->node_mutex.try_lock();
+}
+
+
+
+/*
+ * Function:		Unlock()
+ * Description:		释放结点锁
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:
+ */
+template <typename T>
+void FINE_LOCK_LIST_NODE<T>::Unlock()
+{
+	this->node_mutex.unlock();
+}
+
+
+
+/*
+ * Function:		GetDataRef()
+ * Description:		获取该结点数据域的常引用
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			const T&类型，结点数据域的常引用
+ */
+template <typename T>
+const T& FINE_LOCK_LIST_NODE<T>::GetDataRef() const
+{
+	return this->data;
+}
+
+
+/****************************************************************** FINE_LOCK_LIST类型API ****************************************************************/
+
+/*
+ * Function:		FINE_LOCK_LIST()
+ * Description:		FINE_LOCK_LIST类的无参构造函数，构造一个空链表
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:
+ */
+template <typename T>
+FINE_LOCK_LIST<T>::FINE_LOCK_LIST():header(), tail(), length(0)
+{
+	this->header.SetNextNode(&this->tail);
+	this->tail.SetPriorNode(&this->header);
+}
+
+
+
+/*
+ * Function:		~FINE_LOCK_LIST()
+ * Description:		FINE_LOCK_LIST类的析构函数，调用时不能有其他线程访问链表
+ * Time complexity:	O(n)
+ * Input:
+ * Output:
+ * Return:
+ */
+template <typename T>
+FINE_LOCK_LIST<T>::~FINE_LOCK_LIST()
+{
+	FINE_LOCK_LIST_NODE<T>* current_node = this->header.GetNextNode();
+	while (current_node != &this->tail)
+	{
+		FINE_LOCK_LIST_NODE<T>* next_node = current_node->GetNextNode();
+		delete current_node;
+		current_node = next_node;
+	}
+}
+
+
+
+/*
+ * Function:		GetLength()
+ * Description:		获取链表长度，有其他线程并发修改时只是近似值
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			int类型，链表长度
+ */
+template <typename T>
+int FINE_LOCK_LIST<T>::GetLength() const
+{
+	return this->length.load();
+}
+
+
+
+/*
+ * Function:		IsEmpty()
+ * Description:		判断链表是否为空表
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			bool类型，如果链表为空表返回true，否则返回false
+ */
+template <typename T>
+bool FINE_LOCK_LIST<T>::IsEmpty() const
+{
+	return (this->length.load() == 0) ? true : false;
+}
+
+
+
+/*
+ * Function:		Insert()
+ * Description:		按序插入数据，链表中已存在相等的数据时不插入。可以被多个线程同时调用
+ * Time complexity:	O(n)
+ * Input:
+ *		data:		const T&类型，插入的数据
+ * Output:
+ * Return:			int类型，插入成功返回0，数据已存在返回-2，其他错误返回负数
+ */
+template <typename T>
+int FINE_LOCK_LIST<T>::Insert(const T& data)
+{
+	// 在加锁之前申请结点空间，缩短持锁时间
+	FINE_LOCK_LIST_NODE<T>* list_node = new FINE_LOCK_LIST_NODE<T>(data);
+	if (list_node == NULL)
+	{
+		cout << "func FINE_LOCK_LIST<T>::Insert() err: list_node == NULL" << endl;
+		return -3;
+	}
+
+	FINE_LOCK_LIST_NODE<T>* prev = NULL;
+	FINE_LOCK_LIST_NODE<T>* curr = NULL;
+	this->LockPosition(data, prev, curr);
+
+	if (curr != &this->tail && curr->GetDataRef() == data)
+	{
+		curr->Unlock();
+		prev->Unlock();
+		delete list_node;
+		return -2;
+	}
+
+	// 持有prev和curr的锁，两者之间的链接不会被其他线程修改
+	list_node->SetPriorNode(prev);
+	list_node->SetNextNode(curr);
+	prev->SetNextNode(list_node);
+	curr->SetPriorNode(list_node);
+	this->length ++;
+
+	curr->Unlock();
+	prev->Unlock();
+	return 0;
+}
+
+
+
+/*
+ * Function:		Erase()
+ * Description:		删除与data相等的结点。可以被多个线程同时调用
+ * Time complexity:	O(n)
+ * Input:
+ *		data:		const T&类型，删除的数据
+ * Output:
+ * Return:			int类型，删除成功返回0，数据不存在返回-2，其他错误返回负数
+ */
+template <typename T>
+int FINE_LOCK_LIST<T>::Erase(const T& data)
+{
+	FINE_LOCK_LIST_NODE<T>* prev = NULL;
+	FINE_LOCK_LIST_NODE<T>* curr = NULL;
+	this->LockPosition(data, prev, curr);
+
+	if (curr == &this->tail || !(curr->GetDataRef() == data))
+	{
+		curr->Unlock();
+		prev->Unlock();
+		return -2;
+	}
+
+	// 修改后继的前驱指针也需要持有后继的锁，仍按从头到尾的顺序加锁
+	FINE_LOCK_LIST_NODE<T>* next = curr->GetNextNode();
+	next->Lock();
+	prev->SetNextNode(next);
+	next->SetPriorNode(prev);
+	this->length --;
+	next->Unlock();
+
+	// 其他线程要锁curr必须先锁prev，当前没有线程等待curr的锁，释放后即可删除
+	curr->Unlock();
+	prev->Unlock();
+	delete curr;
+	return 0;
+}
+
+
+
+/*
+ * Function:		Find()
+ * Description:		查找链表中是否存在与data相等的结点。可以被多个线程同时调用
+ * Time complexity:	O(n)
+ * Input:
+ *		data:		const T&类型，查找的数据
+ * Output:
+ * Return:			int类型，找到返回0，不存在返回-2
+ */
+template <typename T>
+int FINE_LOCK_LIST<T>::Find(const T& data)
+{
+	FINE_LOCK_LIST_NODE<T>* prev = NULL;
+	FINE_LOCK_LIST_NODE<T>* curr = NULL;
+	this->LockPosition(data, prev, curr);
+
+	bool found = (curr != &this->tail && curr->GetDataRef() == data);
+	curr->Unlock();
+	prev->Unlock();
+	return found ? 0 : -2;
+}
+
+
+
+/*
+ * Function:		Traverse()
+ * Description:		按从小到大的顺序遍历链表，每个结点的数据data的拷贝作为参数调用visit()，调用visit()时持有该结点的锁
+ * Time complexity:	假设类T重载的赋值操作符时间复杂度为O(m)，visit()的时间复杂度为O(t)，则本函数时间复杂度为O(n*m + n*t)
+ * Input:
+ *		visit:		int (*)(T& data)类型，函数指针，以类T的引用为参数
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int FINE_LOCK_LIST<T>::Traverse(int (*visit)(T& data))
+{
+	FINE_LOCK_LIST_NODE<T>* curr = &this->header;
+	curr->Lock();
+	while (true)
+	{
+		FINE_LOCK_LIST_NODE<T>* next = curr->GetNextNode();
+		next->Lock();
+		curr->Unlock();
+		curr = next;
+		if (curr == &this->tail)
+		{
+			break;
+		}
+
+		T current_node_data = curr->GetDataRef();
+		if (visit(current_node_data) != 0)
+		{
+			cout << "func FINE_LOCK_LIST<T>::Traverse() err: func_status != 0" << endl;
+			curr->Unlock();
+			return -2;
+		}
+	}
+	curr->Unlock();
+	return 0;
+}
+
+
+
+/*
+ * Function:		TraverseBackward()
+ * Description:		按从大到小的顺序遍历链表，每个结点的数据data的拷贝作为参数调用visit()。
+ *					向前驱加锁时不能阻塞（会与正向加锁的线程死锁），加锁失败时放开锁，再从头找到最后一个小于上次访问数据的结点继续
+ * Time complexity:	无冲突时与Traverse()相同，每次冲突额外花费O(n)
+ * Input:
+ *		visit:		int (*)(T& data)类型，函数指针，以类T的引用为参数
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int FINE_LOCK_LIST<T>::TraverseBackward(int (*visit)(T& data))
+{
+	bool visited = false;				// 是否已访问过结点
+	T last_data = T();					// 上次访问的数据，用于冲突后重新定位
+
+	FINE_LOCK_LIST_NODE<T>* curr = &this->tail;
+	curr->Lock();
+	while (true)
+	{
+		// 持有curr的锁时其前驱不会被删除，可以安全地尝试加锁
+		FINE_LOCK_LIST_NODE<T>* prev = curr->GetPriorNode();
+		if (prev->TryLock())
+		{
+			curr->Unlock();
+			curr = prev;
+		}
+		else
+		{
+			// 有正向加锁的线程持有prev并可能在等待curr，必须放开curr
+			curr->Unlock();
+			std::this_thread::yield();
+			if (!visited)
+			{
+				curr = &this->tail;
+				curr->Lock();
+				continue;
+			}
+			FINE_LOCK_LIST_NODE<T>* next = NULL;
+			this->LockPosition(last_data, curr, next);
+			next->Unlock();
+		}
+
+		if (curr == &this->header)
+		{
+			break;
+		}
+
+		T current_node_data = curr->GetDataRef();
+		if (visit(current_node_data) != 0)
+		{
+			cout << "func FINE_LOCK_LIST<T>::TraverseBackward() err: func_status != 0" << endl;
+			curr->Unlock();
+			return -2;
+		}
+		last_data = curr->GetDataRef();
+		visited = true;
+	}
+	curr->Unlock();
+	return 0;
+}
+
+
+
+/*
+ * Function:		CheckLinks()
+ * Description:		检查前驱后继指针是否一致、数据是否严格有序、结点数是否等于链表长度，调用时不能有其他线程修改链表
+ * Time complexity:	O(n)
+ * Input:
+ * Output:
+ * Return:			int类型，一致返回0，否则返回负数
+ */
+template <typename T>
+int FINE_LOCK_LIST<T>::CheckLinks()
+{
+	int count = 0;
+	FINE_LOCK_LIST_NODE<T>* curr = &this->header;
+	while (curr != &this->tail)
+	{
+		FINE_LOCK_LIST_NODE<T>* next = curr->GetNextNode();
+		if (next == NULL || next->GetPriorNode() != curr)
+		{
+			return -1;
+		}
+		if (curr != &this->header && next != &this->tail && !(curr->GetDataRef() < next->GetDataRef()))
+		{
+			return -2;
+		}
+		if (next != &this->tail)
+		{
+			count ++;
+		}
+		curr = next;
+	}
+	return (count == this->length.load()) ? 0 : -3;
+}
+
+
+
+/*
+ * Function:		LockPosition()
+ * Description:		交替加锁向后查找，返回时持有out_prev和out_curr两把锁，out_curr是第一个不小于data的结点（或尾哨兵结点）
+ * Time complexity:	O(n)
+ * Input:
+ *		data:		const T&类型，查找的数据
+ * Output:
+ *		out_prev:	FINE_LOCK_LIST_NODE<T>*&类型，out_curr的前驱
+ *		out_curr:	FINE_LOCK_LIST_NODE<T>*&类型，第一个不小于data的结点或尾哨兵结点
+ * Return:
+ */
+template <typename T>
+void FINE_LOCK_LIST<T>::LockPosition(const T& data, FINE_LOCK_LIST_NODE<T>*& out_prev, FINE_LOCK_LIST_NODE<T>*& out_curr)
+{
+	FINE_LOCK_LIST_NODE<T>* prev = &this->header;
+	prev->Lock();
+	FINE_LOCK_LIST_NODE<T>* curr = prev->GetNextNode();
+	curr->Lock();
+
+	// 先锁住下一个结点再放开最前面的结点，保证持有的两把锁始终相邻
+	while (curr != &this->tail && curr->GetDataRef() < data)
+	{
+		prev->Unlock();
+		prev = curr;
+		curr = curr->GetNextNode();
+		curr->Lock();
+	}
+
+	out_prev = prev;
+	out_curr = curr;
+}
@@ -0,0 +1,275 @@
+/*****************************************************************************************************************************
+ * File name:	fine_lock_list.h
+ * Author:	guoke
+ * Date:	2026.10.19
+ * Description:	C++细粒度锁并发有序双向链表的头文件，该文件包含了模板类FINE_LOCK_LIST_NODE和FINE_LOCK_LIST的声明，
+ *				其实现包含在文件fine_lock_list.cpp中。
+ *				每个结点带有一把互斥锁，正向查找时采用交替加锁（hand-over-hand）：先锁住后继再释放前驱，任何时刻最多持有相邻的几把锁，
+ *				所以在链表不同区域进行的插入和删除可以并行执行。所有正向操作都按从头到尾的顺序加锁，不会死锁；
+ *				反向遍历不能按相反顺序阻塞等锁，遇到冲突时放开已持有的锁并从头重新定位。
+ *				链表中的数据互不相同，类T需要重载<操作符和==操作符。
+ * History:	1. 2026.10.19 创建并完成初始版本
+ ****************************************************************************************************************************/
+
+#ifndef _FINE_LOCK_LIST_H_
+#define _FINE_LOCK_LIST_H_
+
+#include <atomic>
+#include <mutex>
+
+/****************************************************************** FINE_LOCK_LIST_NODE类型，细粒度锁链表中的结点 ****************************************************************/
+template <typename T>
+class FINE_LOCK_LIST_NODE{
+private:
+	FINE_LOCK_LIST_NODE*	next;					// 后继结点，只有同时持有本结点和后继结点的锁时才能修改
+	FINE_LOCK_LIST_NODE*	prior;					// 前驱结点，只有同时持有本结点和前驱结点的锁时才能修改
+	std::mutex				node_mutex;				// 结点锁
+	T						data;					// 数据域，结点插入链表之后不再改变
+
+public:
+	/*
+	 * Function:		FINE_LOCK_LIST_NODE()
+	 * Description:		FINE_LOCK_LIST_NODE类的无参构造函数，用于构造头尾哨兵结点，前驱后继都置NULL
+	 * Time complexity:	与类T的无参构造函数时间复杂度相同
+	 * Input:
+	 * Output:
+	 * Return:
+	 */
+	FINE_LOCK_LIST_NODE();
+
+	/*
+	 * Function:		FINE_LOCK_LIST_NODE()
+	 * Description:		FINE_LOCK_LIST_NODE类的有参构造函数，数据域由调用者指定，前驱后继都置NULL
+	 * Time complexity:	与类T的拷贝构造函数时间复杂度相同
+	 * Input:
+	 *		my_data:	const T&类型，初始化结点的数据域的数据
+	 * Output:
+	 * Return:
+	 */
+	FINE_LOCK_LIST_NODE(const T& my_data);
+
+private:
+	FINE_LOCK_LIST_NODE(const FINE_LOCK_LIST_NODE&);				// 禁止拷贝
+	FINE_LOCK_LIST_NODE& operator=(const FINE_LOCK_LIST_NODE&);
+
+public:
+	/*
+	 * Function:		SetNextNode()
+	 * Description:		设置后继结点
+	 * Time complexity:	O(1)
+	 * Input:
+	 *		next_node:	FINE_LOCK_LIST_NODE*类型，后继结点
+	 * Output:
+	 * Return:
+	 */
+	void SetNextNode(FINE_LOCK_LIST_NODE* next_node);
+
+	/*
+	 * Function:		GetNextNode()
+	 * Description:		获取后继结点
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			FINE_LOCK_LIST_NODE*类型，后继结点
+	 */
+	FINE_LOCK_LIST_NODE* GetNextNode() const;
+
+	/*
+	 * Function:		SetPriorNode()
+	 * Description:		设置前驱结点
+	 * Time complexity:	O(1)
+	 * Input:
+	 *		prior_node:	FINE_LOCK_LIST_NODE*类型，前驱结点
+	 * Output:
+	 * Return:
+	 */
+	void SetPriorNode(FINE_LOCK_LIST_NODE* prior_node);
+
+	/*
+	 * Function:		GetPriorNode()
+	 * Description:		获取前驱结点
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			FINE_LOCK_LIST_NODE*类型，前驱结点
+	 */
+	FINE_LOCK_LIST_NODE* GetPriorNode() const;
+
+	/*
+	 * Function:		Lock()
+	 * Description:		锁住结点，阻塞直到获得结点锁
+	 * Time complexity:	O(1)，不计等待时间
+	 * Input:
+	 * Output:
+	 * Return:
+	 */
+	void Lock();
+
+	/*
+	 * Function:		TryLock()
+	 * Description:		尝试锁住结点，不阻塞
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			bool类型，获得结点锁返回true，否则返回false
+	 */
+	bool TryLock();
+
+	/*
+	 * Function:		Unlock()
+	 * Description:		释放结点锁
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:
+	 */
+	void Unlock();
+
+	/*
+	 * Function:		GetDataRef()
+	 * Description:		获取该结点数据域的常引用
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			const T&类型，结点数据域的常引用
+	 */
+	const T& GetDataRef() const;
+};
+
+
+
+/****************************************************************** FINE_LOCK_LIST类型，细粒度锁并发有序双向链表 ****************************************************************/
+template <typename T>
+class FINE_LOCK_LIST{
+private:
+	FINE_LOCK_LIST_NODE<T>		header;				// 头哨兵结点，后继指向链表第一个结点
+	FINE_LOCK_LIST_NODE<T>		tail;				// 尾哨兵结点，前驱指向链表最后一个结点
+	std::atomic<int>			length;				// 链表长度，并发修改时只是近似值
+
+public:
+	/*
+	 * Function:		FINE_LOCK_LIST()
+	 * Description:		FINE_LOCK_LIST类的无参构造函数，构造一个空链表
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:
+	 */
+	FINE_LOCK_LIST();
+
+	/*
+	 * Function:		~FINE_LOCK_LIST()
+	 * Description:		FINE_LOCK_LIST类的析构函数，调用时不能有其他线程访问链表
+	 * Time complexity:	O(n)
+	 * Input:
+	 * Output:
+	 * Return:
+	 */
+	~FINE_LOCK_LIST();
+
+private:
+	FINE_LOCK_LIST(const FINE_LOCK_LIST&);				// 禁止拷贝
+	FINE_LOCK_LIST& operator=(const FINE_LOCK_LIST&);
+
+public:
+	/*
+	 * Function:		GetLength()
+	 * Description:		获取链表长度，有其他线程并发修改时只是近似值
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			int类型，链表长度
+	 */
+	int GetLength() const;
+
+	/*
+	 * Function:		IsEmpty()
+	 * Description:		判断链表是否为空表
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			bool类型，如果链表为空表返回true，否则返回false
+	 */
+	bool IsEmpty() const;
+
+	/*
+	 * Function:		Insert()
+	 * Description:		按序插入数据，链表中已存在相等的数据时不插入。可以被多个线程同时调用
+	 * Time complexity:	O(n)
+	 * Input:
+	 *		data:		const T&类型，插入的数据
+	 * Output:
+	 * Return:			int类型，插入成功返回0，数据已存在返回-2，其他错误返回负数
+	 */
+	int Insert(const T& data);
+
+	/*
+	 * Function:		Erase()
+	 * Description:		删除与data相等的结点。可以被多个线程同时调用
+	 * Time complexity:	O(n)
+	 * Input:
+	 *		data:		const T&类型，删除的数据
+	 * Output:
+	 * Return:			int类型，删除成功返回0，数据不存在返回-2，其他错误返回负数
+	 */
+	int Erase(const T& data);
+
+	/*
+	 * Function:		Find()
+	 * Description:		查找链表中是否存在与data相等的结点。可以被多个线程同时调用
+	 * Time complexity:	O(n)
+	 * Input:
+	 *		data:		const T&类型，查找的数据
+	 * Output:
+	 * Return:			int类型，找到返回0，不存在返回-2
+	 */
+	int Find(const T& data);
+
+	/*
+	 * Function:		Traverse()
+	 * Description:		按从小到大的顺序遍历链表，每个结点的数据data的拷贝作为参数调用visit()，调用visit()时持有该结点的锁
+	 * Time complexity:	假设类T重载的赋值操作符时间复杂度为O(m)，visit()的时间复杂度为O(t)，则本函数时间复杂度为O(n*m + n*t)
+	 * Input:
+	 *		visit:		int (*)(T& data)类型，函数指针，以类T的引用为参数
+	 * Output:
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int Traverse(int (*visit)(T& data));
+
+	/*
+	 * Function:		TraverseBackward()
+	 * Description:		按从大到小的顺序遍历链表，每个结点的数据data的拷贝作为参数调用visit()。
+	 *					向前驱加锁时不能阻塞（会与正向加锁的线程死锁），加锁失败时放开锁，再从头找到最后一个小于上次访问数据的结点继续
+	 * Time complexity:	无冲突时与Traverse()相同，每次冲突额外花费O(n)
+	 * Input:
+	 *		visit:		int (*)(T& data)类型，函数指针，以类T的引用为参数
+	 * Output:
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int TraverseBackward(int (*visit)(T& data));
+
+	/*
+	 * Function:		CheckLinks()
+	 * Description:		检查前驱后继指针是否一致、数据是否严格有序、结点数是否等于链表长度，调用时不能有其他线程修改链表
+	 * Time complexity:	O(n)
+	 * Input:
+	 * Output:
+	 * Return:			int类型，一致返回0，否则返回负数
+	 */
+	int CheckLinks();
+
+private:
+	/*
+	 * Function:		LockPosition()
+	 * Description:		交替加锁向后查找，返回时持有out_prev和out_curr两把锁，out_curr是第一个不小于data的结点（或尾哨兵结点）
+	 * Time complexity:	O(n)
+	 * Input:
+	 *		data:		const T&类型，查找的数据
+	 * Output:
+	 *		out_prev:	FINE_LOCK_LIST_NODE<T>*&类型，out_curr的前驱
+	 *		out_curr:	FINE_LOCK_LIST_NODE<T>*&类型，第一个不小于data的结点或尾哨兵结点
+	 * Return:
+	 */
+	void LockPosition(const T& data, FINE_LOCK_LIST_NODE<T>*& out_prev, FINE_LOCK_LIST_NODE<T>*& out_curr);
+};
+#endif
@@ -0,0 +1,151 @@
+/******************************************************************************************************************************************
+ * File name:	test.cpp
+ * Author:	guoke
+ * Date:	2026.10.19
+ * Description:	C++细粒度锁并发有序双向链表库fine_lock_list.cpp、fine_lock_list.h的API测试程序
+ * History:	1. 2026.10.19 创建并完成初始版本
+ *****************************************************************************************************************************************/
+
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "fine_lock_list.cpp"
+
+using namespace std;
+
+#define THREAD_NUM		8
+#define KEY_RANGE		4096
+#define OP_NUM			80000
+
+// 打印int类型数据
+int PrintInt(int& data);
+
+// 反向遍历时检查数据是否严格递减，只在反向遍历线程中使用
+int CheckDescending(int& data);
+static thread_local int last_data = 0;
+
+// 并发测试的工作线程，每个线程只操作 key % THREAD_NUM == id 的数据，最后统计自己的数据应有的状态
+void Worker(FINE_LOCK_LIST<int>* list, int id, vector<char>* expected);
+
+// 并发测试的反向遍历线程，与工作线程同时运行，统计顺序错误的次数
+void BackwardWorker(FINE_LOCK_LIST<int>* list, int* error_count);
+
+int main(void)
+{
+	// 创建链表
+	cout << "\n***************************************** 创建链表 **********************************" << endl;
+	FINE_LOCK_LIST<int> int_list;
+	cout << "length = " << int_list.GetLength() << ", empty = " << int_list.IsEmpty() << endl;
+
+	// 乱序插入数据
+	cout << "\n***************************************** 乱序插入数据 **********************************" << endl;
+	int data[] = {5, 3, 9, 1, 7, 3};
+	for (int i = 0; i < (int)(sizeof(data) / sizeof(data[0])); ++i)
+	{
+		cout << "insert " << data[i] << ": " << int_list.Insert(data[i]) << endl;
+	}
+	cout << "length = " << int_list.GetLength() << endl;
+	int_list.Traverse(PrintInt);
+
+	// 反向遍历
+	cout << "\n***************************************** 反向遍历 **********************************" << endl;
+	int_list.TraverseBackward(PrintInt);
+
+	// 查找与删除数据
+	cout << "\n***************************************** 查找与删除数据 **********************************" << endl;
+	cout << "find 7: " << int_list.Find(7) << ", find 8: " << int_list.Find(8) << endl;
+	cout << "erase 7: " << int_list.Erase(7) << ", erase 7 again: " << int_list.Erase(7) << endl;
+	cout << "erase 1: " << int_list.Erase(1) << ", erase 9: " << int_list.Erase(9) << endl;
+	cout << "length = " << int_list.GetLength() << ", links = " << int_list.CheckLinks() << endl;
+	int_list.Traverse(PrintInt);
+
+	// 多线程并发插入、删除和反向遍历
+	cout << "\n***************************************** 多线程并发插入、删除和反向遍历 **********************************" << endl;
+	FINE_LOCK_LIST<int> shared_list;
+	vector<char> expected(KEY_RANGE, 0);
+	int backward_errors = 0;
+	vector<thread> threads;
+	for (int i = 0; i < THREAD_NUM; ++i)
+	{
+		threads.push_back(thread(Worker, &shared_list, i, &expected));
+	}
+	threads.push_back(thread(BackwardWorker, &shared_list, &backward_errors));
+	for (int i = 0; i < (int)threads.size(); ++i)
+	{
+		threads[i].join();
+	}
+
+	int expected_length = 0;
+	int mismatch = 0;
+	for (int key = 0; key < KEY_RANGE; ++key)
+	{
+		expected_length += expected[key];
+		if ((shared_list.Find(key) == 0) != (expected[key] != 0))
+		{
+			mismatch ++;
+		}
+	}
+	cout << "length = " << shared_list.GetLength() << ", expected = " << expected_length << ", mismatch = " << mismatch
+		 << ", links = " << shared_list.CheckLinks() << ", backward errors = " << backward_errors << endl;
+
+	cout << "Hello world!" << endl;
+	return 0;
+}
+
+
+
+// 打印int类型数据
+int PrintInt(int& data)
+{
+	cout << data << endl;
+	return 0;
+}
+
+// 反向遍历时检查数据是否严格递减，只在反向遍历线程中使用
+int CheckDescending(int& data)
+{
+	if (data >= last_data)
+	{
+		return -1;
+	}
+	last_data = data;
+	return 0;
+}
+
+// 并发测试的工作线程，每个线程只操作 key % THREAD_NUM == id 的数据，最后统计自己的数据应有的状态
+void Worker(FINE_LOCK_LIST<int>* list, int id, vector<char>* expected)
+{
+	unsigned int seed = id + 1;
+	for (int i = 0; i < OP_NUM / THREAD_NUM; ++i)
+	{
+		seed = seed * 1103515245 + 12345;
+		int key = (int)((seed >> 8) % (KEY_RANGE / THREAD_NUM)) * THREAD_NUM + id;
+		if ((seed >> 4) & 1)
+		{
+			if (list->Insert(key) == 0)
+			{
+				(*expected)[key] = 1;
+			}
+		}
+		else
+		{
+			if (list->Erase(key) == 0)
+			{
+				(*expected)[key] = 0;
+			}
+		}
+	}
+}
+
+// 并发测试的反向遍历线程，与工作线程同时运行，统计顺序错误的次数
+void BackwardWorker(FINE_LOCK_LIST<int>* list, int* error_count)
+{
+	for (int i = 0; i < 20; ++i)
+	{
+		last_data = KEY_RANGE;
+		if (list->TraverseBackward(CheckDescending) != 0)
+		{
+			(*error_count) ++;
+		}
+	}
+}
@@ -0,0 +1,104 @@
+/******************************************************************************************************************************************
+ * File name:	bench.cpp
+ * Author:	guoke
+ * Date:	2026.10.19
+ * Description:	C++侵入式链表与LINK_LIST的性能对比程序。模拟连接池：随机取一个连接，空闲则从空闲链表中取出，忙则放回空闲链表。
+ *				LINK_LIST<CONNECTION*>删除前要用SetSlider()查找指针，插入时申请结点；INTRUSIVE_LIST按对象指针O(1)删除，不申请内存。
+ *				用法：./bench [连接数] [操作次数]
+ * History:	1. 2026.10.19 创建并完成初始版本
+ *****************************************************************************************************************************************/
+
+#include <iostream>
+#include <cstdlib>
+#include <chrono>
+#include <vector>
+#include "intrusive_list.cpp"
+#include "../../link_list/C++/link_list.cpp"
+
+using namespace std;
+
+// 连接池中的连接
+struct CONNECTION{
+	int			fd;					// 文件描述符
+	bool		idle;				// 是否空闲
+	LIST_HOOK	idle_hook;			// 空闲连接链表的钩子
+};
+
+// 获取当前时间，单位为秒
+double NowSeconds();
+
+int main(int argc, char* argv[])
+{
+	int connection_num = (argc > 1) ? atoi(argv[1]) : 10000;
+	int op_num = (argc > 2) ? atoi(argv[2]) : 100000;
+
+	vector<CONNECTION> pool(connection_num);
+	vector<int> picks(op_num);
+	srand(1);
+	for (int i = 0; i < op_num; ++i)
+	{
+		picks[i] = rand() % connection_num;
+	}
+	cout << "connections = " << connection_num << ", operations = " << op_num << endl;
+
+	// LINK_LIST<CONNECTION*>：按指针查找后删除
+	LINK_LIST<CONNECTION*> pointer_list;
+	for (int i = 0; i < connection_num; ++i)
+	{
+		pool[i].fd = i;
+		pool[i].idle = true;
+		pointer_list.InsertAfterSlider(&pool[i]);
+	}
+	double start = NowSeconds();
+	for (int i = 0; i < op_num; ++i)
+	{
+		CONNECTION* connection = &pool[picks[i]];
+		if (connection->idle)
+		{
+			CONNECTION* deleted = NULL;
+			pointer_list.SetSlider(connection);
+			pointer_list.DeleteSlider(deleted);
+		}
+		else
+		{
+			pointer_list.InsertAfterSlider(connection);
+		}
+		connection->idle = !connection->idle;
+	}
+	double pointer_time = NowSeconds() - start;
+	int pointer_length = pointer_list.GetLength();
+
+	// INTRUSIVE_LIST：按对象指针O(1)删除
+	INTRUSIVE_LIST<CONNECTION, &CONNECTION::idle_hook> idle_list;
+	for (int i = 0; i < connection_num; ++i)
+	{
+		pool[i].idle = true;
+		idle_list.PushBack(&pool[i]);
+	}
+	start = NowSeconds();
+	for (int i = 0; i < op_num; ++i)
+	{
+		CONNECTION* connection = &pool[picks[i]];
+		if (connection->idle)
+		{
+			idle_list.Erase(connection);
+		}
+		else
+		{
+			idle_list.PushBack(connection);
+		}
+		connection->idle = !connection->idle;
+	}
+	double intrusive_time = NowSeconds() - start;
+
+	cout << "LINK_LIST<CONNECTION*> " << pointer_time << " s\tINTRUSIVE_LIST " << intrusive_time << " s\tspeedup " << pointer_time / intrusive_time
+		 << "\tidle " << ((pointer_length == idle_list.GetLength()) ? "equal" : "DIFFERENT") << endl;
+	idle_list.Clear();
+	return 0;
+}
+
+// 获取当前时间，单位为秒
+double NowSeconds()
+{
+	return chrono::duration<double>(chrono::steady_clock::now().time_since_epoch()).count();
+}
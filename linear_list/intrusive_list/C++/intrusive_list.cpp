@@ -0,0 +1,526 @@
+/*****************************************************************************************************************************
+ * File name:	intrusive_list.cpp
+ * Author:	guoke
+ * Date:	2026.10.19
+ * Description:	C++侵入式双向循环链表的源文件，该文件包含了intrusive_list.h中类LIST_HOOK和模板类INTRUSIVE_LIST的实现。
+ * History:	1. 2026.10.19 创建并完成初始版本
+ ****************************************************************************************************************************/
+
+#include <iostream>
+#include "intrusive_list.h"
+
+using namespace std;
+
+/****************************************************************** LIST_HOOK类型API ****************************************************************/
+
+/*
+ * Function:		LIST_HOOK()
+ * Description:		LIST_HOOK类的无参构造函数，钩子不在任何链表中
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:
+ */
+inline LIST_HOOK::LIST_HOOK():next(NULL), prior(NULL)
+{
+}
+
+
+
+/*
+ * Function:		LIST_HOOK()
+ * Description:		LIST_HOOK类的拷贝构造函数，拷贝对象不会把新对象放入原对象所在的链表，新钩子不在任何链表中
+ * Time complexity:	O(1)
+ * Input:
+ *		hook:		const LIST_HOOK&类型，被拷贝的钩子，不使用
+ * Output:
+ * Return:
+ */
+inline LIST_HOOK::LIST_HOOK(const LIST_HOOK& hook):next(NULL), prior(NULL)
+{
+	(void)hook;
+}
+
+
+
+/*
+ * Function:		operator=()
+ * Description:		赋值操作符，对象赋值不改变其所在的链表，钩子保持不变
+ * Time complexity:	O(1)
+ * Input:
+ *		hook:		const LIST_HOOK&类型，赋值的钩子，不使用
+ * Output:
+ * Return:			LIST_HOOK&类型，自身的引用
+ */
+inline LIST_HOOK& LIST_HOOK::operator=(const LIST_HOOK& hook)
+{
+	(void)hook;
+	return *this;
+}
+
+
+
+/*
+ * Function:		IsLinked()
+ * Description:		判断钩子是否在某个链表中
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			bool类型，在链表中返回true，否则返回false
+ */
+inline bool LIST_HOOK::IsLinked() const
+{
+	return (this->next != NULL) ? true : false;
+}
+
+
+
+/****************************************************************** INTRUSIVE_LIST类型API ****************************************************************/
+
+/*
+ * Function:		INTRUSIVE_LIST()
+ * Description:		INTRUSIVE_LIST类的无参构造函数，构造一个空链表
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:
+ */
+template <typename T, LIST_HOOK T::* HOOK>
+INTRUSIVE_LIST<T, HOOK>::INTRUSIVE_LIST():sentinel(), length(0)
+{
+	this->sentinel.next = &this->sentinel;
+	this->sentinel.prior = &this->sentinel;
+}
+
+
+
+/*
+ * Function:		~INTRUSIVE_LIST()
+ * Description:		INTRUSIVE_LIST类的析构函数，调用Clear()把所有对象摘下，不释放对象
+ * Time complexity:	O(n)
+ * Input:
+ * Output:
+ * Return:
+ */
+template <typename T, LIST_HOOK T::* HOOK>
+INTRUSIVE_LIST<T, HOOK>::~INTRUSIVE_LIST()
+{
+	this->Clear();
+}
+
+
+
+/*
+ * Function:		Clear()
+ * Description:		把所有对象从链表上摘下，各对象的钩子置为不在链表中，不释放对象
+ * Time complexity:	O(n)
+ * Input:
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T, LIST_HOOK T::* HOOK>
+int INTRUSIVE_LIST<T, HOOK>::Clear()
+{
+	// 链表不拥有对象，只需把每个钩子置为不在链表中，之后这些对象可以放入其他链表
+	LIST_HOOK* current_hook = this->sentinel.next;
+	while (current_hook != &this->sentinel)
+	{
+		LIST_HOOK* next_hook = current_hook->next;
+		current_hook->next = NULL;
+		current_hook->prior = NULL;
+		current_hook = next_hook;
+	}
+	this->sentinel.next = &this->sentinel;
+	this->sentinel.prior = &this->sentinel;
+	this->length = 0;
+	return 0;
+}
+
+
+
+/*
+ * Function:		GetLength()
+ * Description:		获取链表长度
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			int类型，链表长度
+ */
+template <typename T, LIST_HOOK T::* HOOK>
+int INTRUSIVE_LIST<T, HOOK>::GetLength() const
+{
+	return this->length;
+}
+
+
+
+/*
+ * Function:		IsEmpty()
+ * Description:		判断链表是否为空表
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			bool类型，如果链表为空表返回true，否则返回false
+ */
+template <typename T, LIST_HOOK T::* HOOK>
+bool INTRUSIVE_LIST<T, HOOK>::IsEmpty() const
+{
+	return (this->length == 0) ? true : false;
+}
+
+
+
+/*
+ * Function:		PushFront()
+ * Description:		把对象插入到链表头部
+ * Time complexity:	O(1)
+ * Input:
+ *		object:		T*类型，插入的对象，其钩子不能已经在某个链表中
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T, LIST_HOOK T::* HOOK>
+int INTRUSIVE_LIST<T, HOOK>::PushFront(T* object)
+{
+	if (object == NULL || ToHook(object)->IsLinked())
+	{
+		cout << "func INTRUSIVE_LIST<T, HOOK>::PushFront() err: object == NULL || object is linked" << endl;
+		return -1;
+	}
+
+	this->LinkBetween(ToHook(object), &this->sentinel, this->sentinel.next);
+	return 0;
+}
+
+
+
+/*
+ * Function:		PushBack()
+ * Description:		把对象插入到链表尾部
+ * Time complexity:	O(1)
+ * Input:
+ *		object:		T*类型，插入的对象，其钩子不能已经在某个链表中
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T, LIST_HOOK T::* HOOK>
+int INTRUSIVE_LIST<T, HOOK>::PushBack(T* object)
+{
+	if (object == NULL || ToHook(object)->IsLinked())
+	{
+		cout << "func INTRUSIVE_LIST<T, HOOK>::PushBack() err: object == NULL || object is linked" << endl;
+		return -1;
+	}
+
+	this->LinkBetween(ToHook(object), this->sentinel.prior, &this->sentinel);
+	return 0;
+}
+
+
+
+/*
+ * Function:		InsertBefore()
+ * Description:		把对象插入到链表中pos对象的前面
+ * Time complexity:	O(1)
+ * Input:
+ *		pos:		T*类型，本链表中的对象
+ *		object:		T*类型，插入的对象，其钩子不能已经在某个链表中
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T, LIST_HOOK T::* HOOK>
+int INTRUSIVE_LIST<T, HOOK>::InsertBefore(T* pos, T* object)
+{
+	if (pos == NULL || object == NULL || !ToHook(pos)->IsLinked() || ToHook(object)->IsLinked())
+	{
+		cout << "func INTRUSIVE_LIST<T, HOOK>::InsertBefore() err: pos is not linked || object is linked" << endl;
+		return -1;
+	}
+
+	LIST_HOOK* pos_hook = ToHook(pos);
+	this->LinkBetween(ToHook(object), pos_hook->prior, pos_hook);
+	return 0;
+}
+
+
+
+/*
+ * Function:		InsertAfter()
+ * Description:		把对象插入到链表中pos对象的后面
+ * Time complexity:	O(1)
+ * Input:
+ *		pos:		T*类型，本链表中的对象
+ *		object:		T*类型，插入的对象，其钩子不能已经在某个链表中
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T, LIST_HOOK T::* HOOK>
+int INTRUSIVE_LIST<T, HOOK>::InsertAfter(T* pos, T* object)
+{
+	if (pos == NULL || object == NULL || !ToHook(pos)->IsLinked() || ToHook(object)->IsLinked())
+	{
+		cout << "func INTRUSIVE_LIST<T, HOOK>::InsertAfter() err: pos is not linked || object is linked" << endl;
+		return -1;
+	}
+
+	LIST_HOOK* pos_hook = ToHook(pos);
+	this->LinkBetween(ToHook(object), pos_hook, pos_hook->next);
+	return 0;
+}
+
+
+
+/*
+ * Function:		Erase()
+ * Description:		把对象从链表上摘下，不需要查找，钩子置为不在链表中，不释放对象
+ * Time complexity:	O(1)
+ * Input:
+ *		object:		T*类型，本链表中的对象
+ * Output:
+ * Return:			int类型，操作成功返回0，对象不在链表中返回-2
+ */
+template <typename T, LIST_HOOK T::* HOOK>
+int INTRUSIVE_LIST<T, HOOK>::Erase(T* object)
+{
+	if (object == NULL || !ToHook(object)->IsLinked())
+	{
+		return -2;
+	}
+
+	this->Unlink(ToHook(object));
+	return 0;
+}
+
+
+
+/*
+ * Function:		PopFront()
+ * Description:		摘下链表的第一个对象
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			T*类型，摘下的对象，空表返回NULL
+ */
+template <typename T, LIST_HOOK T::* HOOK>
+T* INTRUSIVE_LIST<T, HOOK>::PopFront()
+{
+	if (this->length == 0)
+	{
+		return NULL;
+	}
+
+	LIST_HOOK* first_hook = this->sentinel.next;
+	this->Unlink(first_hook);
+	return ToObject(first_hook);
+}
+
+
+
+/*
+ * Function:		PopBack()
+ * Description:		摘下链表的最后一个对象
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			T*类型，摘下的对象，空表返回NULL
+ */
+template <typename T, LIST_HOOK T::* HOOK>
+T* INTRUSIVE_LIST<T, HOOK>::PopBack()
+{
+	if (this->length == 0)
+	{
+		return NULL;
+	}
+
+	LIST_HOOK* last_hook = this->sentinel.prior;
+	this->Unlink(last_hook);
+	return ToObject(last_hook);
+}
+
+
+
+/*
+ * Function:		GetFirst()
+ * Description:		获取链表的第一个对象
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			T*类型，第一个对象，空表返回NULL
+ */
+template <typename T, LIST_HOOK T::* HOOK>
+T* INTRUSIVE_LIST<T, HOOK>::GetFirst() const
+{
+	return (this->length == 0) ? NULL : ToObject(this->sentinel.next);
+}
+
+
+
+/*
+ * Function:		GetLast()
+ * Description:		获取链表的最后一个对象
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			T*类型，最后一个对象，空表返回NULL
+ */
+template <typename T, LIST_HOOK T::* HOOK>
+T* INTRUSIVE_LIST<T, HOOK>::GetLast() const
+{
+	return (this->length == 0) ? NULL : ToObject(this->sentinel.prior);
+}
+
+
+
+/*
+ * Function:		GetNext()
+ * Description:		获取链表中object的后一个对象
+ * Time complexity:	O(1)
+ * Input:
+ *		object:		T*类型，本链表中的对象
+ * Output:
+ * Return:			T*类型，后一个对象，object是最后一个对象时返回NULL
+ */
+template <typename T, LIST_HOOK T::* HOOK>
+T* INTRUSIVE_LIST<T, HOOK>::GetNext(T* object) const
+{
+	if (object == NULL || !ToHook(object)->IsLinked())
+	{
+		return NULL;
+	}
+
+	LIST_HOOK* next_hook = ToHook(object)->next;
+	return (next_hook == &this->sentinel) ? NULL : ToObject(next_hook);
+}
+
+
+
+/*
+ * Function:		GetPrior()
+ * Description:		获取链表中object的前一个对象
+ * Time complexity:	O(1)
+ * Input:
+ *		object:		T*类型，本链表中的对象
+ * Output:
+ * Return:			T*类型，前一个对象，object是第一个对象时返回NULL
+ */
+template <typename T, LIST_HOOK T::* HOOK>
+T* INTRUSIVE_LIST<T, HOOK>::GetPrior(T* object) const
+{
+	if (object == NULL || !ToHook(object)->IsLinked())
+	{
+		return NULL;
+	}
+
+	LIST_HOOK* prior_hook = ToHook(object)->prior;
+	return (prior_hook == &this->sentinel) ? NULL : ToObject(prior_hook);
+}
+
+
+
+/*
+ * Function:		Traverse()
+ * Description:		从第一个对象开始遍历链表，以每个对象的引用为参数调用visit()。visit()可以把当前对象从本链表中删除
+ * Time complexity:	假设visit()的时间复杂度为O(t)，则本函数时间复杂度为O(n*t)
+ * Input:
+ *		visit:		int (*)(T& object)类型，函数指针，以类T的引用为参数
+ * Output:
+ * Return:			int类型，操作成功返回0，visit()返回非0时停止遍历并返回负数
+ */
+template <typename T, LIST_HOOK T::* HOOK>
+int INTRUSIVE_LIST<T, HOOK>::Traverse(int (*visit)(T& object))
+{
+	LIST_HOOK* current_hook = this->sentinel.next;
+	while (current_hook != &this->sentinel)
+	{
+		// 先取后继，visit()删除当前对象之后仍能继续
+		LIST_HOOK* next_hook = current_hook->next;
+		if (visit(*ToObject(current_hook)) != 0)
+		{
+			cout << "func INTRUSIVE_LIST<T, HOOK>::Traverse() err: func_status != 0" << endl;
+			return -1;
+		}
+		current_hook = next_hook;
+	}
+	return 0;
+}
+
+
+
+/*
+ * Function:		ToHook()
+ * Description:		获取对象中本链表使用的钩子
+ * Time complexity:	O(1)
+ * Input:
+ *		object:		T*类型，对象
+ * Output:
+ * Return:			LIST_HOOK*类型，钩子的地址
+ */
+template <typename T, LIST_HOOK T::* HOOK>
+LIST_HOOK* INTRUSIVE_LIST<T, HOOK>::ToHook(T* object)
+{
+	return &(object->*HOOK);
+}
+
+
+
+/*
+ * Function:		ToObject()
+ * Description:		由钩子的地址减去钩子成员在类T中的偏移，得到包含该钩子的对象
+ * Time complexity:	O(1)
+ * Input:
+ *		hook:		LIST_HOOK*类型，钩子的地址，不能是哨兵
+ * Output:
+ * Return:			T*类型，对象的地址
+ */
+template <typename T, LIST_HOOK T::* HOOK>
+T* INTRUSIVE_LIST<T, HOOK>::ToObject(LIST_HOOK* hook)
+{
+	// 在一块与T对齐的内存上计算钩子成员的地址得到偏移，只做地址运算，不构造也不访问对象
+	alignas(T) static char probe[sizeof(T)];
+	static const ptrdiff_t offset = (char*)&(((T*)probe)->*HOOK) - probe;
+	return (T*)((char*)hook - offset);
+}
+
+
+
+/*
+ * Function:		LinkBetween()
+ * Description:		把钩子接到prior_hook和next_hook之间，链表长度加1
+ * Time complexity:	O(1)
+ * Input:
+ *		hook:		LIST_HOOK*类型，插入的钩子
+ *		prior_hook:	LIST_HOOK*类型，前驱钩子
+ *		next_hook:	LIST_HOOK*类型，后继钩子
+ * Output:
+ * Return:
+ */
+template <typename T, LIST_HOOK T::* HOOK>
+void INTRUSIVE_LIST<T, HOOK>::LinkBetween(LIST_HOOK* hook, LIST_HOOK* prior_hook, LIST_HOOK* next_hook)
+{
+	hook->prior = prior_hook;
+	hook->next = next_hook;
+	prior_hook->next = hook;
+	next_hook->prior = hook;
+	this->length ++;
+}
+
+
+
+/*
+ * Function:		Unlink()
+ * Description:		把钩子从链表上摘下并置为不在链表中，链表长度减1
+ * Time complexity:	O(1)
+ * Input:
+ *		hook:		LIST_HOOK*类型，链表中的钩子
+ * Output:
+ * Return:
+ */
+template <typename T, LIST_HOOK T::* HOOK>
+void INTRUSIVE_LIST<T, HOOK>::Unlink(LIST_HOOK* hook)
+{
+	hook->prior->next = hook->next;
+	hook->next->prior = hook->prior;
+	hook->next = NULL;
+	hook->prior = NULL;
+	this->length --;
+}
@@ -0,0 +1,316 @@
+/*****************************************************************************************************************************
+ * File name:	intrusive_list.h
+ * Author:	guoke
+ * Date:	2026.10.19
+ * Description:	C++侵入式双向循环链表的头文件，该文件包含了类LIST_HOOK和模板类INTRUSIVE_LIST的声明，其实现包含在文件intrusive_list.cpp中。
+ *				LINK_LIST<T>为每个数据申请一个LIST_NODE<T>并拷贝数据；侵入式链表则由类T自己包含LIST_HOOK成员（前驱后继指针），
+ *				链表只把这些钩子串起来，插入删除只修改指针，不申请内存也不拷贝对象，链表不拥有对象，对象的生存期由调用者管理。
+ *				一个类可以包含多个LIST_HOOK成员，同一个对象就可以同时位于多个链表中，链表类型由钩子成员指针区分，例如：
+ *					struct CONNECTION{ int fd; LIST_HOOK all_hook; LIST_HOOK idle_hook; };
+ *					INTRUSIVE_LIST<CONNECTION, &CONNECTION::all_hook>	all_list;
+ *					INTRUSIVE_LIST<CONNECTION, &CONNECTION::idle_hook>	idle_list;
+ *				对象知道自己的钩子，按对象指针删除是O(1)的，不需要先查找。
+ * History:	1. 2026.10.19 创建并完成初始版本
+ ****************************************************************************************************************************/
+
+#ifndef _INTRUSIVE_LIST_H_
+#define _INTRUSIVE_LIST_H_
+
+#include <cstddef>
+
+/****************************************************************** LIST_HOOK类型，嵌入在对象中的链表钩子 ****************************************************************/
+class LIST_HOOK{
+	template <typename T, LIST_HOOK T::* HOOK> friend class INTRUSIVE_LIST;
+
+private:
+	LIST_HOOK*	next;								// 指向后继钩子，不在链表中时为NULL
+	LIST_HOOK*	prior;								// 指向前驱钩子，不在链表中时为NULL
+
+public:
+	/*
+	 * Function:		LIST_HOOK()
+	 * Description:		LIST_HOOK类的无参构造函数，钩子不在任何链表中
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:
+	 */
+	LIST_HOOK();
+
+	/*
+	 * Function:		LIST_HOOK()
+	 * Description:		LIST_HOOK类的拷贝构造函数，拷贝对象不会把新对象放入原对象所在的链表，新钩子不在任何链表中
+	 * Time complexity:	O(1)
+	 * Input:
+	 *		hook:		const LIST_HOOK&类型，被拷贝的钩子，不使用
+	 * Output:
+	 * Return:
+	 */
+	LIST_HOOK(const LIST_HOOK& hook);
+
+	/*
+	 * Function:		operator=()
+	 * Description:		赋值操作符，对象赋值不改变其所在的链表，钩子保持不变
+	 * Time complexity:	O(1)
+	 * Input:
+	 *		hook:		const LIST_HOOK&类型，赋值的钩子，不使用
+	 * Output:
+	 * Return:			LIST_HOOK&类型，自身的引用
+	 */
+	LIST_HOOK& operator=(const LIST_HOOK& hook);
+
+public:
+	/*
+	 * Function:		IsLinked()
+	 * Description:		判断钩子是否在某个链表中
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			bool类型，在链表中返回true，否则返回false
+	 */
+	bool IsLinked() const;
+};
+
+
+
+/****************************************************************** INTRUSIVE_LIST类型，侵入式双向循环链表 ****************************************************************/
+template <typename T, LIST_HOOK T::* HOOK>
+class INTRUSIVE_LIST{
+private:
+	LIST_HOOK		sentinel;			// 哨兵钩子，后继为第一个对象的钩子，前驱为最后一个对象的钩子
+	int				length;				// 链表长度
+
+public:
+	/*
+	 * Function:		INTRUSIVE_LIST()
+	 * Description:		INTRUSIVE_LIST类的无参构造函数，构造一个空链表
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:
+	 */
+	INTRUSIVE_LIST();
+
+	/*
+	 * Function:		~INTRUSIVE_LIST()
+	 * Description:		INTRUSIVE_LIST类的析构函数，调用Clear()把所有对象摘下，不释放对象
+	 * Time complexity:	O(n)
+	 * Input:
+	 * Output:
+	 * Return:
+	 */
+	~INTRUSIVE_LIST();
+
+private:
+	INTRUSIVE_LIST(const INTRUSIVE_LIST&);				// 禁止拷贝，同一个钩子不能在两个链表中
+	INTRUSIVE_LIST& operator=(const INTRUSIVE_LIST&);
+
+public:
+	/*
+	 * Function:		Clear()
+	 * Description:		把所有对象从链表上摘下，各对象的钩子置为不在链表中，不释放对象
+	 * Time complexity:	O(n)
+	 * Input:
+	 * Output:
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int Clear();
+
+	/*
+	 * Function:		GetLength()
+	 * Description:		获取链表长度
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			int类型，链表长度
+	 */
+	int GetLength() const;
+
+	/*
+	 * Function:		IsEmpty()
+	 * Description:		判断链表是否为空表
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			bool类型，如果链表为空表返回true，否则返回false
+	 */
+	bool IsEmpty() const;
+
+	/*
+	 * Function:		PushFront()
+	 * Description:		把对象插入到链表头部
+	 * Time complexity:	O(1)
+	 * Input:
+	 *		object:		T*类型，插入的对象，其钩子不能已经在某个链表中
+	 * Output:
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int PushFront(T* object);
+
+	/*
+	 * Function:		PushBack()
+	 * Description:		把对象插入到链表尾部
+	 * Time complexity:	O(1)
+	 * Input:
+	 *		object:		T*类型，插入的对象，其钩子不能已经在某个链表中
+	 * Output:
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int PushBack(T* object);
+
+	/*
+	 * Function:		InsertBefore()
+	 * Description:		把对象插入到链表中pos对象的前面
+	 * Time complexity:	O(1)
+	 * Input:
+	 *		pos:		T*类型，本链表中的对象
+	 *		object:		T*类型，插入的对象，其钩子不能已经在某个链表中
+	 * Output:
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int InsertBefore(T* pos, T* object);
+
+	/*
+	 * Function:		InsertAfter()
+	 * Description:		把对象插入到链表中pos对象的后面
+	 * Time complexity:	O(1)
+	 * Input:
+	 *		pos:		T*类型，本链表中的对象
+	 *		object:		T*类型，插入的对象，其钩子不能已经在某个链表中
+	 * Output:
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int InsertAfter(T* pos, T* object);
+
+	/*
+	 * Function:		Erase()
+	 * Description:		把对象从链表上摘下，不需要查找，钩子置为不在链表中，不释放对象
+	 * Time complexity:	O(1)
+	 * Input:
+	 *		object:		T*类型，本链表中的对象
+	 * Output:
+	 * Return:			int类型，操作成功返回0，对象不在链表中返回-2
+	 */
+	int Erase(T* object);
+
+	/*
+	 * Function:		PopFront()
+	 * Description:		摘下链表的第一个对象
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			T*类型，摘下的对象，空表返回NULL
+	 */
+	T* PopFront();
+
+	/*
+	 * Function:		PopBack()
+	 * Description:		摘下链表的最后一个对象
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			T*类型，摘下的对象，空表返回NULL
+	 */
+	T* PopBack();
+
+	/*
+	 * Function:		GetFirst()
+	 * Description:		获取链表的第一个对象
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			T*类型，第一个对象，空表返回NULL
+	 */
+	T* GetFirst() const;
+
+	/*
+	 * Function:		GetLast()
+	 * Description:		获取链表的最后一个对象
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			T*类型，最后一个对象，空表返回NULL
+	 */
+	T* GetLast() const;
+
+	/*
+	 * Function:		GetNext()
+	 * Description:		获取链表中object的后一个对象
+	 * Time complexity:	O(1)
+	 * Input:
+	 *		object:		T*类型，本链表中的对象
+	 * Output:
+	 * Return:			T*类型，后一个对象，object是最后一个对象时返回NULL
+	 */
+	T* GetNext(T* object) const;
+
+	/*
+	 * Function:		GetPrior()
+	 * Description:		获取链表中object的前一个对象
+	 * Time complexity:	O(1)
+	 * Input:
+	 *		object:		T*类型，本链表中的对象
+	 * Output:
+	 * Return:			T*类型，前一个对象，object是第一个对象时返回NULL
+	 */
+	T* GetPrior(T* object) const;
+
+	/*
+	 * Function:		Traverse()
+	 * Description:		从第一个对象开始遍历链表，以每个对象的引用为参数调用visit()。visit()可以把当前对象从本链表中删除
+	 * Time complexity:	假设visit()的时间复杂度为O(t)，则本函数时间复杂度为O(n*t)
+	 * Input:
+	 *		visit:		int (*)(T& object)类型，函数指针，以类T的引用为参数
+	 * Output:
+	 * Return:			int类型，操作成功返回0，visit()返回非0时停止遍历并返回负数
+	 */
+	int Traverse(int (*visit)(T& object));
+
+private:
+	/*
+	 * Function:		ToHook()
+	 * Description:		获取对象中本链表使用的钩子
+	 * Time complexity:	O(1)
+	 * Input:
+	 *		object:		T*类型，对象
+	 * Output:
+	 * Return:			LIST_HOOK*类型，钩子的地址
+	 */
+	static LIST_HOOK* ToHook(T* object);
+
+	/*
+	 * Function:		ToObject()
+	 * Description:		由钩子的地址减去钩子成员在类T中的偏移，得到包含该钩子的对象
+	 * Time complexity:	O(1)
+	 * Input:
+	 *		hook:		LIST_HOOK*类型，钩子的地址，不能是哨兵
+	 * Output:
+	 * Return:			T*类型，对象的地址
+	 */
+	static T* ToObject(LIST_HOOK* hook);
+
+	/*
+	 * Function:		LinkBetween()
+	 * Description:		把钩子接到prior_hook和next_hook之间，链表长度加1
+	 * Time complexity:	O(1)
+	 * Input:
+	 *		hook:		LIST_HOOK*类型，插入的钩子
+	 *		prior_hook:	LIST_HOOK*类型，前驱钩子
+	 *		next_hook:	LIST_HOOK*类型，后继钩子
+	 * Output:
+	 * Return:
+	 */
+	void LinkBetween(LIST_HOOK* hook, LIST_HOOK* prior_hook, LIST_HOOK* next_hook);
+
+	/*
+	 * Function:		Unlink()
+	 * Description:		把钩子从链表上摘下并置为不在链表中，链表长度减1
+	 * Time complexity:	O(1)
+	 * Input:
+	 *		hook:		LIST_HOOK*类型，链表中的钩子
+	 * Output:
+	 * Return:
+	 */
+	void Unlink(LIST_HOOK* hook);
+};
+#endif
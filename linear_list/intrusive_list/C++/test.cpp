@@ -0,0 +1,120 @@
+/******************************************************************************************************************************************
+ * File name:	test.cpp
+ * Author:	guoke
+ * Date:	2026.10.19
+ * Description:	C++侵入式链表库intrusive_list.cpp、intrusive_list.h的API测试程序
+ * History:	1. 2026.10.19 创建并完成初始版本
+ *****************************************************************************************************************************************/
+
+#include <iostream>
+#include <string>
+#include "intrusive_list.cpp"
+
+using namespace std;
+
+// 连接池中的连接，同时可以位于全部连接链表和空闲连接链表中
+struct CONNECTION{
+	int			fd;					// 文件描述符
+	string		peer;				// 对端地址
+	LIST_HOOK	all_hook;			// 全部连接链表的钩子
+	LIST_HOOK	idle_hook;			// 空闲连接链表的钩子
+};
+
+typedef INTRUSIVE_LIST<CONNECTION, &CONNECTION::all_hook>	ALL_LIST;
+typedef INTRUSIVE_LIST<CONNECTION, &CONNECTION::idle_hook>	IDLE_LIST;
+
+// 打印连接
+int PrintConnection(CONNECTION& connection);
+
+// 关闭fd为奇数的连接，遍历时删除当前对象
+static ALL_LIST* closing_list = NULL;
+int CloseOdd(CONNECTION& connection);
+
+int main(void)
+{
+	// 连接池中的对象由调用者管理，链表不申请内存也不拷贝对象
+	CONNECTION pool[6];
+	for (int i = 0; i < 6; ++i)
+	{
+		pool[i].fd = i + 3;
+		pool[i].peer = "10.0.0." + to_string(i + 1);
+	}
+
+	// 插入
+	cout << "\n***************************************** 插入 **********************************" << endl;
+	ALL_LIST all_list;
+	IDLE_LIST idle_list;
+	for (int i = 0; i < 6; ++i)
+	{
+		all_list.PushBack(&pool[i]);
+	}
+	idle_list.PushFront(&pool[1]);
+	idle_list.PushFront(&pool[4]);
+	idle_list.InsertAfter(&pool[4], &pool[2]);
+	idle_list.InsertBefore(&pool[4], &pool[5]);
+	cout << "all length = " << all_list.GetLength() << ", idle length = " << idle_list.GetLength() << endl;
+	all_list.Traverse(PrintConnection);
+	cout << "idle:" << endl;
+	idle_list.Traverse(PrintConnection);
+
+	// 同一个钩子不能插入两次，对象拷贝之后钩子不在链表中
+	cout << "push linked object again: " << all_list.PushBack(&pool[0]) << endl;
+	CONNECTION copy = pool[0];
+	cout << "copy linked: " << copy.all_hook.IsLinked() << ", original linked: " << pool[0].all_hook.IsLinked() << endl;
+
+	// 按对象指针删除，不需要查找，其他链表不受影响
+	cout << "\n***************************************** 按对象删除 **********************************" << endl;
+	cout << "erase pool[2] from idle: " << idle_list.Erase(&pool[2]) << ", again: " << idle_list.Erase(&pool[2]) << endl;
+	cout << "pool[2] in all: " << pool[2].all_hook.IsLinked() << ", in idle: " << pool[2].idle_hook.IsLinked() << endl;
+	cout << "idle:" << endl;
+	idle_list.Traverse(PrintConnection);
+
+	// 前后移动和两端摘下
+	cout << "\n***************************************** 前后移动和两端摘下 **********************************" << endl;
+	cout << "first idle fd = " << idle_list.GetFirst()->fd << ", last idle fd = " << idle_list.GetLast()->fd << endl;
+	cout << "next of pool[4] in idle fd = " << idle_list.GetNext(&pool[4])->fd << ", prior of first is NULL: " << (idle_list.GetPrior(idle_list.GetFirst()) == NULL) << endl;
+	CONNECTION* popped = idle_list.PopFront();
+	cout << "pop front fd = " << popped->fd << ", pop back fd = " << idle_list.PopBack()->fd << ", idle length = " << idle_list.GetLength() << endl;
+	idle_list.PushBack(popped);
+	cout << "idle:" << endl;
+	idle_list.Traverse(PrintConnection);
+
+	// 遍历时删除
+	cout << "\n***************************************** 遍历时删除 **********************************" << endl;
+	closing_list = &all_list;
+	all_list.Traverse(CloseOdd);
+	cout << "all length = " << all_list.GetLength() << endl;
+	all_list.Traverse(PrintConnection);
+
+	// 清空之后对象可以重新插入
+	cout << "\n***************************************** 清空 **********************************" << endl;
+	all_list.Clear();
+	idle_list.Clear();
+	cout << "all length = " << all_list.GetLength() << ", empty = " << idle_list.IsEmpty() << ", pop = " << (idle_list.PopFront() == NULL) << endl;
+	cout << "push pool[0] again: " << all_list.PushBack(&pool[0]) << ", length = " << all_list.GetLength() << endl;
+	all_list.Erase(&pool[0]);
+
+	cout << "Hello world!" << endl;
+	return 0;
+}
+
+
+
+// 打印连接
+int PrintConnection(CONNECTION& connection)
+{
+	cout << "fd = " << connection.fd << "\tpeer = " << connection.peer << endl;
+	return 0;
+}
+
+
+
+// 关闭fd为奇数的连接，遍历时删除当前对象
+int CloseOdd(CONNECTION& connection)
+{
+	if (connection.fd % 2 == 1)
+	{
+		closing_list->Erase(&connection);
+	}
+	return 0;
+}
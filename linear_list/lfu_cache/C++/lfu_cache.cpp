@@ -0,0 +1,568 @@
+/*****************************************************************************************************************************
+ * File name:	lfu_cache.cpp
+ * Author:	guoke
+ * Date:	2026.10.19
+ * Description:	C++ LFU缓存的源文件，该文件包含了lfu_cache.h中模板类LFU_CACHE的实现。
+ * History:	1. 2026.10.19 创建并完成初始版本
+ *			2. 2026.10.19 缓存项结点放入空闲链表时重置键和值，释放被淘汰的值持有的资源
+ ****************************************************************************************************************************/
+
+#include <iostream>
+#include <utility>
+#include "lfu_cache.h"
+#include "../../link_list/C++/link_list.cpp"
+
+using namespace std;
+
+/****************************************************************** LFU_CACHE类型API ****************************************************************/
+
+/*
+ * Function:		LFU_CACHE()
+ * Description:		LFU_CACHE类的有参构造函数，构造一个空缓存并为哈希表预留capacity个位置
+ * Time complexity:	O(capacity)
+ * Input:
+ *		my_capacity:	int类型，缓存容量，小于1时按1处理
+ * Output:
+ * Return:
+ */
+template <typename K, typename V>
+LFU_CACHE<K, V>::LFU_CACHE(int my_capacity):buckets(), free_entries(NULL), free_buckets(NULL), index(), capacity(my_capacity), size(0)
+{
+	if (this->capacity < 1)
+	{
+		this->capacity = 1;
+	}
+	this->index.reserve(this->capacity);		// 预留位置，缓存装满之前哈希表不会重新散列
+}
+
+
+
+/*
+ * Function:		~LFU_CACHE()
+ * Description:		LFU_CACHE类的析构函数，释放所有缓存项、桶和空闲结点
+ * Time complexity:	O(n)
+ * Input:
+ * Output:
+ * Return:
+ */
+template <typename K, typename V>
+LFU_CACHE<K, V>::~LFU_CACHE()
+{
+	this->Clear();
+	while (this->free_entries != NULL)
+	{
+		ENTRY_NODE* next_node = this->free_entries->GetNextNode();
+		delete this->free_entries;
+		this->free_entries = next_node;
+	}
+	while (this->free_buckets != NULL)
+	{
+		BUCKET_NODE* next_node = this->free_buckets->GetNextNode();
+		delete this->free_buckets;
+		this->free_buckets = next_node;
+	}
+}
+
+
+
+/*
+ * Function:		Clear()
+ * Description:		清空缓存，缓存项的键和值重置为默认值，所有结点放入空闲链表
+ * Time complexity:	O(n)
+ * Input:
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename K, typename V>
+int LFU_CACHE<K, V>::Clear()
+{
+	BUCKET_NODE* bucket_node = this->buckets.GetNextNode();
+	while (bucket_node != &this->buckets)
+	{
+		BUCKET_NODE* next_bucket = bucket_node->GetNextNode();
+		ENTRY_NODE* sentinel = &bucket_node->GetDataRef().entries;
+		ENTRY_NODE* entry_node = sentinel->GetNextNode();
+		while (entry_node != sentinel)
+		{
+			ENTRY_NODE* next_entry = entry_node->GetNextNode();
+			entry_node->GetDataRef() = LFU_CACHE_ENTRY<K, V>();
+			entry_node->SetNextNode(this->free_entries);
+			this->free_entries = entry_node;
+			entry_node = next_entry;
+		}
+
+		// 桶内链表恢复为空，桶结点放入空闲链表
+		sentinel->SetNextNode(sentinel);
+		sentinel->SetPriorNode(sentinel);
+		bucket_node->SetNextNode(this->free_buckets);
+		this->free_buckets = bucket_node;
+		bucket_node = next_bucket;
+	}
+	this->buckets.SetNextNode(&this->buckets);
+	this->buckets.SetPriorNode(&this->buckets);
+	this->index.clear();
+	this->size = 0;
+	return 0;
+}
+
+
+
+/*
+ * Function:		GetSize()
+ * Description:		获取缓存项个数
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			int类型，缓存项个数
+ */
+template <typename K, typename V>
+int LFU_CACHE<K, V>::GetSize() const
+{
+	return this->size;
+}
+
+
+
+/*
+ * Function:		GetCapacity()
+ * Description:		获取缓存容量
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			int类型，缓存容量
+ */
+template <typename K, typename V>
+int LFU_CACHE<K, V>::GetCapacity() const
+{
+	return this->capacity;
+}
+
+
+
+/*
+ * Function:		IsEmpty()
+ * Description:		判断缓存是否为空
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			bool类型，如果缓存为空返回true，否则返回false
+ */
+template <typename K, typename V>
+bool LFU_CACHE<K, V>::IsEmpty() const
+{
+	return (this->size == 0) ? true : false;
+}
+
+
+
+/*
+ * Function:		Get()
+ * Description:		查找键对应的值，找到时该项的访问频率加1
+ * Time complexity:	O(1)，与类V的赋值操作符时间复杂度相同
+ * Input:
+ *		key:		const K&类型，查找的键
+ * Output:
+ *		out_value:	V&类型，找到时通过该引用将值传给调用者
+ * Return:			int类型，找到返回0，不存在返回-2
+ */
+template <typename K, typename V>
+int LFU_CACHE<K, V>::Get(const K& key, V& out_value)
+{
+	typename std::unordered_map<K, ENTRY_NODE*>::iterator it = this->index.find(key);
+	if (it == this->index.end())
+	{
+		return -2;
+	}
+
+	if (this->Promote(it->second) != 0)
+	{
+		cout << "func LFU_CACHE<K, V>::Get() err: Promote() != 0" << endl;
+		return -3;
+	}
+	out_value = it->second->GetDataRef().value;
+	return 0;
+}
+
+
+
+/*
+ * Function:		Peek()
+ * Description:		查找键对应的值，不改变访问频率
+ * Time complexity:	O(1)，与类V的赋值操作符时间复杂度相同
+ * Input:
+ *		key:		const K&类型，查找的键
+ * Output:
+ *		out_value:	V&类型，找到时通过该引用将值传给调用者
+ * Return:			int类型，找到返回0，不存在返回-2
+ */
+template <typename K, typename V>
+int LFU_CACHE<K, V>::Peek(const K& key, V& out_value) const
+{
+	typename std::unordered_map<K, ENTRY_NODE*>::const_iterator it = this->index.find(key);
+	if (it == this->index.end())
+	{
+		return -2;
+	}
+
+	out_value = it->second->GetDataRef().value;
+	return 0;
+}
+
+
+
+/*
+ * Function:		GetFrequency()
+ * Description:		获取键对应的项的访问频率
+ * Time complexity:	O(1)
+ * Input:
+ *		key:		const K&类型，查找的键
+ * Output:
+ * Return:			int类型，找到返回访问频率（不小于1），不存在返回-2
+ */
+template <typename K, typename V>
+int LFU_CACHE<K, V>::GetFrequency(const K& key) const
+{
+	typename std::unordered_map<K, ENTRY_NODE*>::const_iterator it = this->index.find(key);
+	if (it == this->index.end())
+	{
+		return -2;
+	}
+
+	return it->second->GetDataRef().bucket->GetDataRef().frequency;
+}
+
+
+
+/*
+ * Function:		Put()
+ * Description:		插入或更新键值对。更新时访问频率加1；插入时缓存已满则先淘汰访问频率最小的项（频率相同时淘汰最久未使用的项），新项的访问频率为1
+ * Time complexity:	O(1)，与类K、V的赋值操作符时间复杂度相同
+ * Input:
+ *		key:		const K&类型，键
+ *		value:		const V&类型，值
+ * Output:
+ * Return:			int类型，插入新项返回0，更新已有项返回1，操作失败返回负数
+ */
+template <typename K, typename V>
+int LFU_CACHE<K, V>::Put(const K& key, const V& value)
+{
+	// 已存在，更新值并将频率加1
+	typename std::unordered_map<K, ENTRY_NODE*>::iterator it = this->index.find(key);
+	if (it != this->index.end())
+	{
+		it->second->GetDataRef().value = value;
+		if (this->Promote(it->second) != 0)
+		{
+			cout << "func LFU_CACHE<K, V>::Put() err: Promote() != 0" << endl;
+			return -3;
+		}
+		return 1;
+	}
+
+	// 缓存已满，淘汰频率最小的桶中最久未使用的项，其哈希表结点改为新键后复用
+	typename std::unordered_map<K, ENTRY_NODE*>::node_type index_node;
+	if (this->size >= this->capacity)
+	{
+		ENTRY_NODE* victim = this->buckets.GetNextNode()->GetDataRef().entries.GetPriorNode();
+		index_node = this->index.extract(victim->GetDataRef().key);
+		this->RemoveEntry(victim);
+		this->size --;
+	}
+
+	// 新项的频率为1，放在频率最小的位置
+	BUCKET_NODE* bucket_node = this->GetBucketAfter(&this->buckets, 1);
+	ENTRY_NODE* entry_node = this->free_entries;
+	if (entry_node != NULL)
+	{
+		this->free_entries = entry_node->GetNextNode();
+	}
+	else
+	{
+		entry_node = new ENTRY_NODE();
+	}
+	if (bucket_node == NULL || entry_node == NULL)
+	{
+		cout << "func LFU_CACHE<K, V>::Put() err: bucket_node == NULL || entry_node == NULL" << endl;
+		return -3;
+	}
+
+	entry_node->GetDataRef().key = key;
+	entry_node->GetDataRef().value = value;
+	this->LinkFront(bucket_node, entry_node);
+	if (index_node.empty())
+	{
+		this->index[key] = entry_node;
+	}
+	else
+	{
+		index_node.key() = key;
+		index_node.mapped() = entry_node;
+		this->index.insert(std::move(index_node));
+	}
+	this->size ++;
+	return 0;
+}
+
+
+
+/*
+ * Function:		Touch()
+ * Description:		键对应的项的访问频率加1，不读取值
+ * Time complexity:	O(1)
+ * Input:
+ *		key:		const K&类型，键
+ * Output:
+ * Return:			int类型，操作成功返回0，不存在返回-2，其他错误返回负数
+ */
+template <typename K, typename V>
+int LFU_CACHE<K, V>::Touch(const K& key)
+{
+	typename std::unordered_map<K, ENTRY_NODE*>::iterator it = this->index.find(key);
+	if (it == this->index.end())
+	{
+		return -2;
+	}
+
+	return (this->Promote(it->second) == 0) ? 0 : -3;
+}
+
+
+
+/*
+ * Function:		Erase()
+ * Description:		删除键对应的项，结点放入空闲链表
+ * Time complexity:	O(1)
+ * Input:
+ *		key:		const K&类型，键
+ * Output:
+ * Return:			int类型，操作成功返回0，不存在返回-2
+ */
+template <typename K, typename V>
+int LFU_CACHE<K, V>::Erase(const K& key)
+{
+	typename std::unordered_map<K, ENTRY_NODE*>::iterator it = this->index.find(key);
+	if (it == this->index.end())
+	{
+		return -2;
+	}
+
+	ENTRY_NODE* entry_node = it->second;
+	this->index.erase(it);
+	this->RemoveEntry(entry_node);
+	this->size --;
+	return 0;
+}
+
+
+
+/*
+ * Function:		Evict()
+ * Description:		淘汰访问频率最小的项，频率相同时淘汰最久未使用的项，结点放入空闲链表
+ * Time complexity:	O(1)，与类K、V的赋值操作符时间复杂度相同
+ * Input:
+ * Output:
+ *		out_key:	K&类型，被淘汰项的键
+ *		out_value:	V&类型，被淘汰项的值
+ * Return:			int类型，操作成功返回0，缓存为空返回-2
+ */
+template <typename K, typename V>
+int LFU_CACHE<K, V>::Evict(K& out_key, V& out_value)
+{
+	if (this->size == 0)
+	{
+		return -2;
+	}
+
+	ENTRY_NODE* victim = this->buckets.GetNextNode()->GetDataRef().entries.GetPriorNode();
+	out_key = victim->GetDataRef().key;
+	out_value = victim->GetDataRef().value;
+	this->index.erase(out_key);
+	this->RemoveEntry(victim);
+	this->size --;
+	return 0;
+}
+
+
+
+/*
+ * Function:		Traverse()
+ * Description:		按淘汰顺序的逆序遍历缓存：频率从大到小，同一频率内从最近使用到最久未使用，不改变访问频率
+ * Time complexity:	O(n*t)，t为visit()的时间复杂度
+ * Input:
+ *		visit:		int (*)(const K& key, V& value, int frequency)类型，函数指针，以键、值的引用和访问频率为参数
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename K, typename V>
+int LFU_CACHE<K, V>::Traverse(int (*visit)(const K& key, V& value, int frequency))
+{
+	BUCKET_NODE* bucket_node = this->buckets.GetPriorNode();
+	while (bucket_node != &this->buckets)
+	{
+		ENTRY_NODE* sentinel = &bucket_node->GetDataRef().entries;
+		ENTRY_NODE* entry_node = sentinel->GetNextNode();
+		while (entry_node != sentinel)
+		{
+			if (visit(entry_node->GetDataRef().key, entry_node->GetDataRef().value, bucket_node->GetDataRef().frequency) != 0)
+			{
+				cout << "func LFU_CACHE<K, V>::Traverse() err: func_status != 0" << endl;
+				return -1;
+			}
+			entry_node = entry_node->GetNextNode();
+		}
+		bucket_node = bucket_node->GetPriorNode();
+	}
+	return 0;
+}
+
+
+
+/*
+ * Function:		Promote()
+ * Description:		将缓存项移到频率加1的桶中最近使用的位置，原来的桶变空时将其释放
+ * Time complexity:	O(1)
+ * Input:
+ *		entry_node:	ENTRY_NODE*类型，缓存项结点
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename K, typename V>
+int LFU_CACHE<K, V>::Promote(ENTRY_NODE* entry_node)
+{
+	BUCKET_NODE* old_bucket = entry_node->GetDataRef().bucket;
+
+	// 先取得新桶再摘下缓存项，保证旧桶在新桶插入时仍在链表中
+	BUCKET_NODE* new_bucket = this->GetBucketAfter(old_bucket, old_bucket->GetDataRef().frequency + 1);
+	if (new_bucket == NULL)
+	{
+		return -1;
+	}
+
+	Unlink(entry_node);
+	this->LinkFront(new_bucket, entry_node);
+
+	// 旧桶变空，放入空闲链表
+	ENTRY_NODE* sentinel = &old_bucket->GetDataRef().entries;
+	if (sentinel->GetNextNode() == sentinel)
+	{
+		Unlink(old_bucket);
+		old_bucket->SetNextNode(this->free_buckets);
+		this->free_buckets = old_bucket;
+	}
+	return 0;
+}
+
+
+
+/*
+ * Function:		RemoveEntry()
+ * Description:		将缓存项从其所在的桶中摘下，桶变空时将其释放，缓存项结点的键和值重置为默认值后放入空闲链表
+ * Time complexity:	与类K、V的无参构造函数和赋值操作符时间复杂度相同
+ * Input:
+ *		entry_node:	ENTRY_NODE*类型，缓存项结点
+ * Output:
+ * Return:
+ */
+template <typename K, typename V>
+void LFU_CACHE<K, V>::RemoveEntry(ENTRY_NODE* entry_node)
+{
+	BUCKET_NODE* bucket_node = entry_node->GetDataRef().bucket;
+	Unlink(entry_node);
+	entry_node->GetDataRef() = LFU_CACHE_ENTRY<K, V>();			// 重置键和值，被删除的值持有的资源随之释放，bucket置为NULL
+	entry_node->SetNextNode(this->free_entries);
+	this->free_entries = entry_node;
+
+	ENTRY_NODE* sentinel = &bucket_node->GetDataRef().entries;
+	if (sentinel->GetNextNode() == sentinel)
+	{
+		Unlink(bucket_node);
+		bucket_node->SetNextNode(this->free_buckets);
+		this->free_buckets = bucket_node;
+	}
+}
+
+
+
+/*
+ * Function:		GetBucketAfter()
+ * Description:		获取紧跟在prior_bucket之后、频率为frequency的桶，不存在时从空闲链表取一个桶插入到prior_bucket之后
+ * Time complexity:	O(1)
+ * Input:
+ *		prior_bucket:	BUCKET_NODE*类型，前一个桶，可以是哨兵结点
+ *		frequency:		int类型，桶的访问频率
+ * Output:
+ * Return:			BUCKET_NODE*类型，操作成功返回桶结点，操作失败返回NULL
+ */
+template <typename K, typename V>
+typename LFU_CACHE<K, V>::BUCKET_NODE* LFU_CACHE<K, V>::GetBucketAfter(BUCKET_NODE* prior_bucket, int frequency)
+{
+	BUCKET_NODE* next_bucket = prior_bucket->GetNextNode();
+	if (next_bucket != &this->buckets && next_bucket->GetDataRef().frequency == frequency)
+	{
+		return next_bucket;
+	}
+
+	BUCKET_NODE* bucket_node = this->free_buckets;
+	if (bucket_node != NULL)
+	{
+		this->free_buckets = bucket_node->GetNextNode();
+	}
+	else
+	{
+		bucket_node = new BUCKET_NODE();
+		if (bucket_node == NULL)
+		{
+			return NULL;
+		}
+	}
+
+	bucket_node->GetDataRef().frequency = frequency;
+	bucket_node->SetPriorNode(prior_bucket);
+	bucket_node->SetNextNode(next_bucket);
+	prior_bucket->SetNextNode(bucket_node);
+	next_bucket->SetPriorNode(bucket_node);
+	return bucket_node;
+}
+
+
+
+/*
+ * Function:		LinkFront()
+ * Description:		将缓存项插入到桶中最近使用的位置，并记录所在的桶
+ * Time complexity:	O(1)
+ * Input:
+ *		bucket_node:	BUCKET_NODE*类型，桶结点
+ *		entry_node:		ENTRY_NODE*类型，缓存项结点
+ * Output:
+ * Return:
+ */
+template <typename K, typename V>
+void LFU_CACHE<K, V>::LinkFront(BUCKET_NODE* bucket_node, ENTRY_NODE* entry_node)
+{
+	ENTRY_NODE* sentinel = &bucket_node->GetDataRef().entries;
+	ENTRY_NODE* first_node = sentinel->GetNextNode();
+	entry_node->SetNextNode(first_node);
+	entry_node->SetPriorNode(sentinel);
+	first_node->SetPriorNode(entry_node);
+	sentinel->SetNextNode(entry_node);
+	entry_node->GetDataRef().bucket = bucket_node;
+}
+
+
+
+/*
+ * Function:		Unlink()
+ * Description:		将结点从所在的双向循环链表中摘下，桶结点和缓存项结点通用
+ * Time complexity:	O(1)
+ * Input:
+ *		node:		LIST_NODE<N>*类型，要摘下的结点
+ * Output:
+ * Return:
+ */
+template <typename K, typename V>
+template <typename N>
+void LFU_CACHE<K, V>::Unlink(LIST_NODE<N>* node)
+{
+	node->GetPriorNode()->SetNextNode(node->GetNextNode());
+	node->GetNextNode()->SetPriorNode(node->GetPriorNode());
+}
@@ -0,0 +1,273 @@
+/*****************************************************************************************************************************
+ * File name:	lfu_cache.h
+ * Author:	guoke
+ * Date:	2026.10.19
+ * Description:	C++ LFU缓存的头文件，该文件包含了模板类LFU_CACHE的声明，其实现包含在文件lfu_cache.cpp中。
+ *				缓存由两层带哨兵结点的双向循环链表组成，结点类型都是link_list.h中的LIST_NODE：
+ *				外层是频率桶链表，按访问频率从小到大排列，只保存非空的桶；每个桶内是访问频率相同的缓存项链表，按最近使用的顺序排列。
+ *				缓存项记录自己所在的桶，访问一次就把它移到频率加1的桶（不存在则紧挨着当前桶新建），
+ *				淘汰时取频率最小的桶中最久未使用的项，另用哈希表记录键到结点的映射，查找、频率加1和淘汰都是O(1)。
+ *				缓存项结点和桶结点都放入空闲链表循环使用。
+ *				类K需要能作为std::unordered_map的键（支持std::hash<K>和==操作符）。
+ * History:	1. 2026.10.19 创建并完成初始版本
+ *			2. 2026.10.19 缓存项结点放入空闲链表时重置键和值
+ ****************************************************************************************************************************/
+
+#ifndef _LFU_CACHE_H_
+#define _LFU_CACHE_H_
+
+#include <unordered_map>
+#include "../../link_list/C++/link_list.h"
+
+template <typename K, typename V> struct LFU_CACHE_BUCKET;
+
+/* 缓存项，桶内链表结点的数据域 */
+template <typename K, typename V>
+struct LFU_CACHE_ENTRY{
+	K											key;			// 键
+	V											value;			// 值
+	LIST_NODE< LFU_CACHE_BUCKET<K, V> >*		bucket;			// 缓存项所在的桶
+};
+
+/* 频率桶，外层链表结点的数据域 */
+template <typename K, typename V>
+struct LFU_CACHE_BUCKET{
+	int										frequency;		// 桶内缓存项的访问频率
+	LIST_NODE< LFU_CACHE_ENTRY<K, V> >		entries;		// 桶内缓存项链表的哨兵结点，后继为最近使用的项
+};
+
+
+
+/****************************************************************** LFU_CACHE类型，LFU缓存 ****************************************************************/
+template <typename K, typename V>
+class LFU_CACHE{
+private:
+	typedef LIST_NODE< LFU_CACHE_ENTRY<K, V> >	ENTRY_NODE;
+	typedef LIST_NODE< LFU_CACHE_BUCKET<K, V> >	BUCKET_NODE;
+
+	BUCKET_NODE							buckets;			// 频率桶链表的哨兵结点，后继为频率最小的桶
+	ENTRY_NODE*							free_entries;		// 空闲缓存项结点链表，只用后继指针串联
+	BUCKET_NODE*						free_buckets;		// 空闲桶结点链表，只用后继指针串联
+	std::unordered_map<K, ENTRY_NODE*>	index;				// 键到结点的映射
+	int									capacity;			// 缓存容量
+	int									size;				// 缓存项个数
+
+public:
+	/*
+	 * Function:		LFU_CACHE()
+	 * Description:		LFU_CACHE类的有参构造函数，构造一个空缓存并为哈希表预留capacity个位置
+	 * Time complexity:	O(capacity)
+	 * Input:
+	 *		my_capacity:	int类型，缓存容量，小于1时按1处理
+	 * Output:
+	 * Return:
+	 */
+	LFU_CACHE(int my_capacity);
+
+	/*
+	 * Function:		~LFU_CACHE()
+	 * Description:		LFU_CACHE类的析构函数，释放所有缓存项、桶和空闲结点
+	 * Time complexity:	O(n)
+	 * Input:
+	 * Output:
+	 * Return:
+	 */
+	~LFU_CACHE();
+
+private:
+	LFU_CACHE(const LFU_CACHE&);				// 禁止拷贝
+	LFU_CACHE& operator=(const LFU_CACHE&);
+
+public:
+	/*
+	 * Function:		Clear()
+	 * Description:		清空缓存，缓存项的键和值重置为默认值，所有结点放入空闲链表
+	 * Time complexity:	O(n)
+	 * Input:
+	 * Output:
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int Clear();
+
+	/*
+	 * Function:		GetSize()
+	 * Description:		获取缓存项个数
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			int类型，缓存项个数
+	 */
+	int GetSize() const;
+
+	/*
+	 * Function:		GetCapacity()
+	 * Description:		获取缓存容量
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			int类型，缓存容量
+	 */
+	int GetCapacity() const;
+
+	/*
+	 * Function:		IsEmpty()
+	 * Description:		判断缓存是否为空
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			bool类型，如果缓存为空返回true，否则返回false
+	 */
+	bool IsEmpty() const;
+
+	/*
+	 * Function:		Get()
+	 * Description:		查找键对应的值，找到时该项的访问频率加1
+	 * Time complexity:	O(1)，与类V的赋值操作符时间复杂度相同
+	 * Input:
+	 *		key:		const K&类型，查找的键
+	 * Output:
+	 *		out_value:	V&类型，找到时通过该引用将值传给调用者
+	 * Return:			int类型，找到返回0，不存在返回-2
+	 */
+	int Get(const K& key, V& out_value);
+
+	/*
+	 * Function:		Peek()
+	 * Description:		查找键对应的值，不改变访问频率
+	 * Time complexity:	O(1)，与类V的赋值操作符时间复杂度相同
+	 * Input:
+	 *		key:		const K&类型，查找的键
+	 * Output:
+	 *		out_value:	V&类型，找到时通过该引用将值传给调用者
+	 * Return:			int类型，找到返回0，不存在返回-2
+	 */
+	int Peek(const K& key, V& out_value) const;
+
+	/*
+	 * Function:		GetFrequency()
+	 * Description:		获取键对应的项的访问频率
+	 * Time complexity:	O(1)
+	 * Input:
+	 *		key:		const K&类型，查找的键
+	 * Output:
+	 * Return:			int类型，找到返回访问频率（不小于1），不存在返回-2
+	 */
+	int GetFrequency(const K& key) const;
+
+	/*
+	 * Function:		Put()
+	 * Description:		插入或更新键值对。更新时访问频率加1；插入时缓存已满则先淘汰访问频率最小的项（频率相同时淘汰最久未使用的项），新项的访问频率为1
+	 * Time complexity:	O(1)，与类K、V的赋值操作符时间复杂度相同
+	 * Input:
+	 *		key:		const K&类型，键
+	 *		value:		const V&类型，值
+	 * Output:
+	 * Return:			int类型，插入新项返回0，更新已有项返回1，操作失败返回负数
+	 */
+	int Put(const K& key, const V& value);
+
+	/*
+	 * Function:		Touch()
+	 * Description:		键对应的项的访问频率加1，不读取值
+	 * Time complexity:	O(1)
+	 * Input:
+	 *		key:		const K&类型，键
+	 * Output:
+	 * Return:			int类型，操作成功返回0，不存在返回-2，其他错误返回负数
+	 */
+	int Touch(const K& key);
+
+	/*
+	 * Function:		Erase()
+	 * Description:		删除键对应的项，结点放入空闲链表
+	 * Time complexity:	O(1)
+	 * Input:
+	 *		key:		const K&类型，键
+	 * Output:
+	 * Return:			int类型，操作成功返回0，不存在返回-2
+	 */
+	int Erase(const K& key);
+
+	/*
+	 * Function:		Evict()
+	 * Description:		淘汰访问频率最小的项，频率相同时淘汰最久未使用的项，结点放入空闲链表
+	 * Time complexity:	O(1)，与类K、V的赋值操作符时间复杂度相同
+	 * Input:
+	 * Output:
+	 *		out_key:	K&类型，被淘汰项的键
+	 *		out_value:	V&类型，被淘汰项的值
+	 * Return:			int类型，操作成功返回0，缓存为空返回-2
+	 */
+	int Evict(K& out_key, V& out_value);
+
+	/*
+	 * Function:		Traverse()
+	 * Description:		按淘汰顺序的逆序遍历缓存：频率从大到小，同一频率内从最近使用到最久未使用，不改变访问频率
+	 * Time complexity:	O(n*t)，t为visit()的时间复杂度
+	 * Input:
+	 *		visit:		int (*)(const K& key, V& value, int frequency)类型，函数指针，以键、值的引用和访问频率为参数
+	 * Output:
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int Traverse(int (*visit)(const K& key, V& value, int frequency));
+
+private:
+	/*
+	 * Function:		Promote()
+	 * Description:		将缓存项移到频率加1的桶中最近使用的位置，原来的桶变空时将其释放
+	 * Time complexity:	O(1)
+	 * Input:
+	 *		entry_node:	ENTRY_NODE*类型，缓存项结点
+	 * Output:
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int Promote(ENTRY_NODE* entry_node);
+
+	/*
+	 * Function:		RemoveEntry()
+	 * Description:		将缓存项从其所在的桶中摘下，桶变空时将其释放，缓存项结点的键和值重置为默认值后放入空闲链表
+	 * Time complexity:	与类K、V的无参构造函数和赋值操作符时间复杂度相同
+	 * Input:
+	 *		entry_node:	ENTRY_NODE*类型，缓存项结点
+	 * Output:
+	 * Return:
+	 */
+	void RemoveEntry(ENTRY_NODE* entry_node);
+
+	/*
+	 * Function:		GetBucketAfter()
+	 * Description:		获取紧跟在prior_bucket之后、频率为frequency的桶，不存在时从空闲链表取一个桶插入到prior_bucket之后
+	 * Time complexity:	O(1)
+	 * Input:
+	 *		prior_bucket:	BUCKET_NODE*类型，前一个桶，可以是哨兵结点
+	 *		frequency:		int类型，桶的访问频率
+	 * Output:
+	 * Return:			BUCKET_NODE*类型，操作成功返回桶结点，操作失败返回NULL
+	 */
+	BUCKET_NODE* GetBucketAfter(BUCKET_NODE* prior_bucket, int frequency);
+
+	/*
+	 * Function:		LinkFront()
+	 * Description:		将缓存项插入到桶中最近使用的位置，并记录所在的桶
+	 * Time complexity:	O(1)
+	 * Input:
+	 *		bucket_node:	BUCKET_NODE*类型，桶结点
+	 *		entry_node:		ENTRY_NODE*类型，缓存项结点
+	 * Output:
+	 * Return:
+	 */
+	void LinkFront(BUCKET_NODE* bucket_node, ENTRY_NODE* entry_node);
+
+	/*
+	 * Function:		Unlink()
+	 * Description:		将结点从所在的双向循环链表中摘下，桶结点和缓存项结点通用
+	 * Time complexity:	O(1)
+	 * Input:
+	 *		node:		LIST_NODE<N>*类型，要摘下的结点
+	 * Output:
+	 * Return:
+	 */
+	template <typename N>
+	static void Unlink(LIST_NODE<N>* node);
+};
+#endif
@@ -0,0 +1,182 @@
+/******************************************************************************************************************************************
+ * File name:	test.cpp
+ * Author:	guoke
+ * Date:	2026.10.19
+ * Description:	C++ LFU缓存库lfu_cache.cpp、lfu_cache.h的API测试程序
+ * History:	1. 2026.10.19 创建并完成初始版本
+ *			2. 2026.10.19 增加被淘汰的值不再被空闲结点持有的测试
+ *****************************************************************************************************************************************/
+
+#include <iostream>
+#include <cstdlib>
+#include <string>
+#include <map>
+#include <memory>
+#include "lfu_cache.cpp"
+
+using namespace std;
+
+/* 参考模型中的缓存项：访问频率和最近一次访问的时刻 */
+struct MODEL_ENTRY{
+	int value;
+	int frequency;
+	int last_use;
+};
+
+// 打印缓存项
+int PrintEntry(const int& key, string& value, int frequency);
+
+// 在参考模型中找到应被淘汰的键：频率最小，频率相同时最久未使用
+int ModelVictim(const map<int, MODEL_ENTRY>& model);
+
+int main(void)
+{
+	string value;
+	int key = 0;
+
+	// 创建缓存
+	cout << "\n***************************************** 创建缓存 **********************************" << endl;
+	LFU_CACHE<int, string> cache(3);
+	cout << "capacity = " << cache.GetCapacity() << ", size = " << cache.GetSize() << ", empty = " << cache.IsEmpty() << endl;
+
+	// 插入和访问缓存项
+	cout << "\n***************************************** 插入和访问缓存项 **********************************" << endl;
+	cout << "put 1: " << cache.Put(1, "one") << endl;
+	cout << "put 2: " << cache.Put(2, "two") << endl;
+	cout << "put 3: " << cache.Put(3, "three") << endl;
+	cout << "get 1: " << cache.Get(1, value) << ", value = " << value << endl;
+	cout << "get 1: " << cache.Get(1, value) << ", value = " << value << endl;
+	cout << "put 2 again: " << cache.Put(2, "TWO") << endl;
+	cout << "touch 9: " << cache.Touch(9) << ", peek 3: " << cache.Peek(3, value) << ", value = " << value << endl;
+	cout << "frequency of 1, 2, 3: " << cache.GetFrequency(1) << ", " << cache.GetFrequency(2) << ", " << cache.GetFrequency(3) << endl;
+	cache.Traverse(PrintEntry);
+
+	// 缓存已满时插入，淘汰访问频率最小的项
+	cout << "\n***************************************** 缓存已满时插入 **********************************" << endl;
+	cout << "put 4: " << cache.Put(4, "four") << endl;
+	cout << "get 3: " << cache.Get(3, value) << endl;
+	cout << "put 5: " << cache.Put(5, "five") << endl;
+	cout << "get 4: " << cache.Get(4, value) << endl;
+	cache.Traverse(PrintEntry);
+
+	// 删除和淘汰
+	cout << "\n***************************************** 删除和淘汰 **********************************" << endl;
+	cout << "erase 1: " << cache.Erase(1) << ", erase 1 again: " << cache.Erase(1) << endl;
+	cout << "evict: " << cache.Evict(key, value) << ", key = " << key << ", value = " << value << endl;
+	cout << "size = " << cache.GetSize() << endl;
+	cache.Traverse(PrintEntry);
+	cache.Clear();
+	cout << "clear: size = " << cache.GetSize() << ", evict: " << cache.Evict(key, value) << endl;
+
+	// 与参考模型比较随机访问序列的结果
+	cout << "\n***************************************** 与参考模型比较 **********************************" << endl;
+	LFU_CACHE<int, int> int_cache(64);
+	map<int, MODEL_ENTRY> model;
+	int mismatch = 0;
+	srand(1);
+	for (int tick = 0; tick < 200000; ++tick)
+	{
+		int k = rand() % 256;
+		int v = 0;
+		map<int, MODEL_ENTRY>::iterator it = model.find(k);
+		if (rand() % 4 == 0)
+		{
+			// 写入：已存在时更新并计一次访问，否则可能先淘汰
+			if (it != model.end())
+			{
+				it->second.value = tick;
+				it->second.frequency ++;
+				it->second.last_use = tick;
+			}
+			else
+			{
+				if ((int)model.size() >= int_cache.GetCapacity())
+				{
+					model.erase(ModelVictim(model));
+				}
+				MODEL_ENTRY entry = {tick, 1, tick};
+				model[k] = entry;
+			}
+			int_cache.Put(k, tick);
+		}
+		else
+		{
+			// 读取：命中时计一次访问
+			int status = int_cache.Get(k, v);
+			if (it != model.end())
+			{
+				it->second.frequency ++;
+				it->second.last_use = tick;
+				if (status != 0 || v != it->second.value)
+				{
+					mismatch ++;
+				}
+			}
+			else if (status != -2)
+			{
+				mismatch ++;
+			}
+		}
+	}
+	for (map<int, MODEL_ENTRY>::iterator it = model.begin(); it != model.end(); ++it)
+	{
+		if (int_cache.GetFrequency(it->first) != it->second.frequency)
+		{
+			mismatch ++;
+		}
+	}
+	cout << "size = " << int_cache.GetSize() << ", model size = " << model.size() << ", mismatch = " << mismatch << endl;
+
+	// 被删除或淘汰的值不再被空闲结点持有
+	cout << "\n***************************************** 释放被淘汰的值 **********************************" << endl;
+	{
+		LFU_CACHE<int, shared_ptr<int> > ptr_cache(2);
+		shared_ptr<int> ptrs[4] = {make_shared<int>(0), make_shared<int>(1), make_shared<int>(2), make_shared<int>(3)};
+		shared_ptr<int> got_ptr;
+		int evicted_key = 0;
+
+		ptr_cache.Put(0, ptrs[0]);
+		ptr_cache.Put(1, ptrs[1]);
+		ptr_cache.Get(1, got_ptr);
+		got_ptr.reset();
+		ptr_cache.Put(2, ptrs[2]);					// 淘汰使用次数最少的0
+		ptr_cache.Erase(1);
+		ptr_cache.Evict(evicted_key, got_ptr);		// 淘汰2
+		got_ptr.reset();
+		ptr_cache.Put(3, ptrs[3]);
+		ptr_cache.Clear();
+		cout << "use_count:";
+		for (int i = 0; i < 4; ++i)
+		{
+			cout << " " << ptrs[i].use_count();
+		}
+		cout << endl;
+	}
+
+	cout << "Hello world!" << endl;
+	return 0;
+}
+
+
+
+// 打印缓存项
+int PrintEntry(const int& key, string& value, int frequency)
+{
+	cout << "key = " << key << "\tvalue = " << value << "\tfrequency = " << frequency << endl;
+	return 0;
+}
+
+// 在参考模型中找到应被淘汰的键：频率最小，频率相同时最久未使用
+int ModelVictim(const map<int, MODEL_ENTRY>& model)
+{
+	map<int, MODEL_ENTRY>::const_iterator victim = model.begin();
+	for (map<int, MODEL_ENTRY>::const_iterator it = model.begin(); it != model.end(); ++it)
+	{
+		if (it->second.frequency < victim->second.frequency
+			|| (it->second.frequency == victim->second.frequency && it->second.last_use < victim->second.last_use))
+		{
+			victim = it;
+		}
+	}
+	return victim->first;
+}
@@ -0,0 +1,366 @@
+/******************************************************************************************************************************************
+ * File name:	bench.cpp
+ * Author:	guoke
+ * Date:	2026.10.19
+ * Description:	C++双向循环链表遍历与查找的性能对比程序：Traverse()与TraversePrefetch()，逐个调用SetSlider()与SetSliderBatch()。
+ *				多个链表交替插入结点，使同一链表的相邻结点在内存中不连续，硬件预取难以生效。
+ *				另外比较一个链表刚建立、反复删除插入之后、Compact()之后三种状态下的顺序遍历速度，
+ *				以及逐个调用InsertAfterSlider()与按批调用InsertRangeAfterSlider()的插入速度，visit()耗时较多时ParallelReduce()在不同线程数下的速度，
+ *				有序链表中每次从表头查找插入位置与InsertSorted()从游标出发查找、MergeSorted()一次合并的速度。
+ *				用法：./bench [链表个数] [每个链表的结点数] [查找次数] [重排和批量插入测试的结点数]
+ * History:	1. 2026.10.19 创建并完成初始版本
+ *			2. 2026.10.19 增加Compact()前后的遍历速度对比
+ *			3. 2026.10.19 增加逐个插入与批量插入的对比
+ *			4. 2026.10.19 增加并行归约的对比
+ *			5. 2026.10.19 增加有序插入的对比
+ *****************************************************************************************************************************************/
+
+#include <iostream>
+#include <cstdlib>
+#include <chrono>
+#include <vector>
+#include <algorithm>
+#include "link_list.cpp"
+
+using namespace std;
+
+static long long sum = 0;
+
+// 累加结点数据，模拟需要读取数据的visit()
+int SumVisit(int& data);
+
+// 获取当前时间，单位为秒
+double NowSeconds();
+
+// 用迭代器顺序遍历链表求和，返回所用时间
+double ScanSeconds(LINK_LIST<int>& list, long long& out_sum);
+
+// 比较刚建立时、反复删除插入之后、Compact()之后的顺序遍历速度
+void CompactBench(int churn_num);
+
+// 比较逐个插入与每批batch_size个批量插入range_num个结点的速度
+void RangeBench(int range_num, int batch_size);
+
+// 耗时较多的累积函数，对结点数据做若干次整数哈希后累加
+void HeavyAccumulate(long long& acc, int& data);
+
+// 合并部分和
+void AddPart(long long& result, const long long& part);
+
+// 比较不同线程数下ParallelReduce()的速度
+void ParallelBench(int node_num);
+
+// 比较有序链表中从表头查找、从游标查找和一次合并的插入速度，插入的数据按随机游走变化，前后相近
+void SortedBench(int node_num, int insert_num);
+
+int main(int argc, char* argv[])
+{
+	int list_num = (argc > 1) ? atoi(argv[1]) : 64;
+	int node_num = (argc > 2) ? atoi(argv[2]) : 16384;
+	int query_num = (argc > 3) ? atoi(argv[3]) : 2048;
+	int churn_num = (argc > 4) ? atoi(argv[4]) : 1000000;
+
+	// 在堆还没有被其他测试打乱时先做重排测试
+	srand(1);
+	CompactBench(churn_num);
+	RangeBench(churn_num, 64);
+	ParallelBench(churn_num / 4);
+	SortedBench(churn_num / 20, 10000);
+
+	// 随机选择链表插入结点
+	vector<LINK_LIST<int>*> lists(list_num);
+	vector<int> counts(list_num, 0);
+	for (int i = 0; i < list_num; ++i)
+	{
+		lists[i] = new LINK_LIST<int>();
+	}
+	srand(1);
+	for (int i = 0; i < list_num * node_num; )
+	{
+		int j = rand() % list_num;
+		if (counts[j] == node_num)
+		{
+			continue;
+		}
+		lists[j]->Insert(lists[j]->end(), j * node_num + counts[j]);
+		counts[j] ++;
+		++i;
+	}
+	cout << "lists = " << list_num << ", nodes per list = " << node_num << ", queries = " << query_num << endl;
+
+	// 遍历
+	sum = 0;
+	double start = NowSeconds();
+	for (int i = 0; i < list_num; ++i)
+	{
+		lists[i]->Traverse(SumVisit);
+	}
+	double plain_time = NowSeconds() - start;
+	long long plain_sum = sum;
+
+	sum = 0;
+	start = NowSeconds();
+	for (int i = 0; i < list_num; ++i)
+	{
+		lists[i]->TraversePrefetch(SumVisit);
+	}
+	double prefetch_time = NowSeconds() - start;
+	cout << "traverse:\tplain " << plain_time << " s\tprefetch " << prefetch_time << " s\tspeedup " << plain_time / prefetch_time
+		 << "\tsum " << ((plain_sum == sum) ? "equal" : "DIFFERENT") << endl;
+
+	// 查找：每次在随机的链表中查找一个随机的已有数据
+	vector<LINK_LIST<int>*> query_lists(query_num);
+	vector<int> query_datas(query_num);
+	vector<int> results(query_num);
+	for (int i = 0; i < query_num; ++i)
+	{
+		int j = rand() % list_num;
+		query_lists[i] = lists[j];
+		query_datas[i] = j * node_num + rand() % node_num;
+	}
+
+	start = NowSeconds();
+	for (int i = 0; i < query_num; ++i)
+	{
+		query_lists[i]->SetSlider(query_datas[i]);
+	}
+	plain_time = NowSeconds() - start;
+
+	start = NowSeconds();
+	LINK_LIST<int>::SetSliderBatch(&query_lists[0], &query_datas[0], query_num, &results[0]);
+	prefetch_time = NowSeconds() - start;
+	int found = 0;
+	for (int i = 0; i < query_num; ++i)
+	{
+		found += (results[i] == 0) ? 1 : 0;
+	}
+	cout << "set slider:\tplain " << plain_time << " s\tbatch " << prefetch_time << " s\tspeedup " << plain_time / prefetch_time
+		 << "\tfound " << found << "/" << query_num << endl;
+
+	for (int i = 0; i < list_num; ++i)
+	{
+		delete lists[i];
+	}
+
+	return 0;
+}
+
+// 累加结点数据，模拟需要读取数据的visit()
+int SumVisit(int& data)
+{
+	sum += data;
+	return 0;
+}
+
+// 获取当前时间，单位为秒
+double NowSeconds()
+{
+	return chrono::duration<double>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// 用迭代器顺序遍历链表求和，返回所用时间
+double ScanSeconds(LINK_LIST<int>& list, long long& out_sum)
+{
+	double start = NowSeconds();
+	long long total = 0;
+	for (LINK_LIST<int>::iterator it = list.begin(); it != list.end(); ++it)
+	{
+		total += *it;
+	}
+	out_sum = total;
+	return NowSeconds() - start;
+}
+
+// 比较刚建立时、反复删除插入之后、Compact()之后的顺序遍历速度
+void CompactBench(int churn_num)
+{
+	// 刚建立时、反复删除插入之后、Compact()之后的顺序遍历
+	LINK_LIST<int> churn_list;
+	for (int i = 0; i < churn_num; ++i)
+	{
+		churn_list.Insert(churn_list.end(), i);
+	}
+	long long fresh_sum = 0;
+	double fresh_time = ScanSeconds(churn_list, fresh_sum);
+
+	// 每轮随机删除约一半的结点，再把它们的数据插入到表尾，释放的内存被乱序复用
+	for (int round = 0; round < 4; ++round)
+	{
+		vector<int> removed;
+		for (LINK_LIST<int>::iterator it = churn_list.begin(); it != churn_list.end(); )
+		{
+			if (rand() & 1)
+			{
+				removed.push_back(*it);
+				it = churn_list.Erase(it);
+			}
+			else
+			{
+				++it;
+			}
+		}
+		for (size_t i = removed.size(); i > 1; --i)
+		{
+			swap(removed[i - 1], removed[rand() % i]);
+		}
+		for (size_t i = 0; i < removed.size(); ++i)
+		{
+			churn_list.Insert(churn_list.end(), removed[i]);
+		}
+	}
+	long long churned_sum = 0;
+	double churned_time = ScanSeconds(churn_list, churned_sum);
+
+	double start = NowSeconds();
+	churn_list.Compact();
+	double compact_time = NowSeconds() - start;
+	long long compacted_sum = 0;
+	double compacted_time = ScanSeconds(churn_list, compacted_sum);
+
+	cout << "scan " << churn_num << " nodes:	fresh " << fresh_time << " s	churned " << churned_time << " s	compacted " << compacted_time
+		 << " s	(Compact() took " << compact_time << " s, sum " << ((fresh_sum == churned_sum && churned_sum == compacted_sum) ? "equal" : "DIFFERENT") << ")" << endl;
+}
+
+// 比较逐个插入与每批batch_size个批量插入range_num个结点的速度
+void RangeBench(int range_num, int batch_size)
+{
+	vector<int> datas(range_num);
+	for (int i = 0; i < range_num; ++i)
+	{
+		datas[i] = i;
+	}
+
+	LINK_LIST<int> single_list;
+	double start = NowSeconds();
+	for (int i = 0; i < range_num; ++i)
+	{
+		single_list.InsertAfterSlider(datas[i]);
+	}
+	double single_time = NowSeconds() - start;
+	long long single_sum = 0;
+	double single_scan = ScanSeconds(single_list, single_sum);
+
+	LINK_LIST<int> range_list;
+	start = NowSeconds();
+	for (int i = 0; i < range_num; i += batch_size)
+	{
+		int end = (i + batch_size < range_num) ? i + batch_size : range_num;
+		range_list.InsertRangeAfterSlider(datas.begin() + i, datas.begin() + end);
+	}
+	double range_time = NowSeconds() - start;
+	long long range_sum = 0;
+	double range_scan = ScanSeconds(range_list, range_sum);
+
+	cout << "insert " << range_num << " nodes:	single " << single_time << " s	batches of " << batch_size << " " << range_time << " s	speedup " << single_time / range_time
+		 << "	(scan " << single_scan << " s / " << range_scan << " s, sum " << ((single_sum == range_sum) ? "equal" : "DIFFERENT") << ")" << endl;
+
+	start = NowSeconds();
+	single_list.Clear();
+	double single_clear = NowSeconds() - start;
+	start = NowSeconds();
+	range_list.Clear();
+	double range_clear = NowSeconds() - start;
+	cout << "clear " << range_num << " nodes:	single " << single_clear << " s	batches " << range_clear << " s" << endl;
+}
+
+// 耗时较多的累积函数，对结点数据做若干次整数哈希后累加
+void HeavyAccumulate(long long& acc, int& data)
+{
+	unsigned int x = (unsigned int)data;
+	for (int i = 0; i < 64; ++i)
+	{
+		x = x * 2654435761u + 0x9e3779b9u;
+		x ^= x >> 15;
+	}
+	acc += x;
+}
+
+// 合并部分和
+void AddPart(long long& result, const long long& part)
+{
+	result += part;
+}
+
+// 比较不同线程数下ParallelReduce()的速度
+void ParallelBench(int node_num)
+{
+	LINK_LIST<int> list;
+	for (int i = 0; i < node_num; ++i)
+	{
+		list.Insert(list.end(), i);
+	}
+	list.EnablePartitions(1024);
+	long long warm_up = 0;
+	list.ParallelReduce(0LL, HeavyAccumulate, AddPart, warm_up, 1);		// 先遍历一次，使结点进入缓存，第一次计时不吃亏
+
+	cout << "parallel reduce " << node_num << " nodes (hardware threads = " << thread::hardware_concurrency() << "):";
+	double base_time = 0;
+	long long base_sum = 0;
+	for (int threads = 1; threads <= 8; threads *= 2)
+	{
+		long long result = 0;
+		double start = NowSeconds();
+		list.ParallelReduce(0LL, HeavyAccumulate, AddPart, result, threads);
+		double time = NowSeconds() - start;
+		if (threads == 1)
+		{
+			base_time = time;
+			base_sum = result;
+		}
+		cout << "	" << threads << " threads " << time << " s (x" << base_time / time << (result == base_sum ? "" : ", DIFFERENT") << ")";
+	}
+	cout << endl;
+}
+
+// 比较有序链表中从表头查找、从游标查找和一次合并的插入速度，插入的数据按随机游走变化，前后相近
+void SortedBench(int node_num, int insert_num)
+{
+	vector<int> keys(insert_num);
+	int key = node_num;
+	for (int i = 0; i < insert_num; ++i)
+	{
+		key += rand() % 41 - 20;
+		key = (key < 0) ? 0 : ((key > 2 * node_num) ? 2 * node_num : key);
+		keys[i] = key;
+	}
+
+	LINK_LIST<int> head_list, finger_list, merge_list;
+	for (int i = 0; i < node_num; ++i)
+	{
+		head_list.Insert(head_list.end(), 2 * i);
+		finger_list.Insert(finger_list.end(), 2 * i);
+		merge_list.Insert(merge_list.end(), 2 * i);
+	}
+
+	// 每次从表头开始找第一个大于key的结点
+	double start = NowSeconds();
+	for (int i = 0; i < insert_num; ++i)
+	{
+		LINK_LIST<int>::iterator it = head_list.begin();
+		while (it != head_list.end() && !(keys[i] < *it))
+		{
+			++it;
+		}
+		head_list.Insert(it, keys[i]);
+	}
+	double head_time = NowSeconds() - start;
+
+	start = NowSeconds();
+	for (int i = 0; i < insert_num; ++i)
+	{
+		finger_list.InsertSorted(keys[i]);
+	}
+	double finger_time = NowSeconds() - start;
+
+	// 整批排序之后一次合并
+	start = NowSeconds();
+	vector<int> sorted_keys(keys);
+	sort(sorted_keys.begin(), sorted_keys.end());
+	merge_list.MergeSorted(sorted_keys.begin(), sorted_keys.end());
+	double merge_time = NowSeconds() - start;
+
+	bool equal = (vector<int>(head_list.begin(), head_list.end()) == vector<int>(finger_list.begin(), finger_list.end()))
+			  && (vector<int>(head_list.begin(), head_list.end()) == vector<int>(merge_list.begin(), merge_list.end()));
+	cout << "sorted insert " << insert_num << " clustered keys into " << node_num << " nodes:	from head " << head_time << " s	InsertSorted() " << finger_time
+		 << " s	MergeSorted() " << merge_time << " s	speedup " << head_time / finger_time << "	" << (equal ? "equal" : "DIFFERENT") << endl;
+}
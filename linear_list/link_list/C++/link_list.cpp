@@ -4,14 +4,30 @@
  * Date:	2021.11.13
  * Description:	C++线性表链式存储（双向循环链表）的源文件，该文件包含了link_list.h中模板类LIST_NODE和LINK_LIST的实现。
  * History:	1. 2021.11.13 创建并完成初始版本
+ *			2. 2026.10.19 增加双向迭代器LIST_ITERATOR的实现，Traverse()不再使用游标；修复DeleteSlider()删除最后一个结点后游标未置NULL的问题
+ *			3. 2026.10.19 Clear()改为一次线性遍历释放所有结点；增加ClearDeferred()和后台回收线程LIST_RECLAIMER的实现
+ *			4. 2026.10.19 增加TraversePrefetch()和SetSliderBatch()的实现
+ *			5. 2026.10.19 增加Compact()的实现，删除结点统一经过FreeNode()以区分连续结点块中的结点
+ *			6. 2026.10.19 增加InsertRangeBeforeSlider()和InsertRangeAfterSlider()的实现，连续结点块按起始地址记录在std::map中
+ *			7. 2026.10.19 增加分区标记的维护和ParallelTraverse()、ParallelReduce()的实现
+ *			8. 2026.10.19 增加InsertSorted()和MergeSorted()的实现
  ****************************************************************************************************************************/
 
 #include <iostream>
 #include <cstring>
+#include <new>
+#include <utility>
 #include "link_list.h"
 
 using namespace std;
 
+/* 软件预取，只是提示，不支持的编译器上什么也不做 */
+#if defined(__GNUC__)
+#define LINK_LIST_PREFETCH(addr)	__builtin_prefetch((addr))
+#else
+#define LINK_LIST_PREFETCH(addr)	((void)0)
+#endif
+
 /****************************************************************** LIST_NODE类型API ****************************************************************/
 
 /*
@@ -174,469 +190,2195 @@ LIST_NODE<T>* LIST_NODE<T>::GetPriorNode() const
 }
 
 
-/****************************************************************** LINK_LIST类型API ****************************************************************/
 
 /*
- * Function:		LINK_LIST()
- * Description:		LINK_LIST类的无参构造函数，头结点调用LIST_NODE类的无参构造函数，length和slider置0
- * Time complexity:	与类LIST_NODE的无参构造函数时间复杂度相同，LIST_NODE类无参构造函数同类T的无参构造函数时间复杂度相同
+ * Function:		GetDataRef()
+ * Description:		获取该结点数据域的引用，供迭代器直接访问数据，不拷贝数据
+ * Time complexity:	O(1)
  * Input:
  * Output:
- * Return:
+ * Return:			T&类型，结点数据域的引用
  */
 template <typename T>
-LINK_LIST<T>::LINK_LIST():header(), length(0), slider(NULL)
+T& LIST_NODE<T>::GetDataRef()
 {
-	this->header.SetNextNode(NULL);
+	return this->data;
 }
 
 
 
 /*
- * Function:		~LINK_LIST()
- * Description:		LINK_LIST类的析构函数，调用Clear()清空链表结点
- * Time complexity:	
+ * Function:		GetDataRef()
+ * Description:		获取该结点数据域的常引用
+ * Time complexity:	O(1)
  * Input:
  * Output:
- * Return:
+ * Return:			const T&类型，结点数据域的常引用
  */
 template <typename T>
-LINK_LIST<T>::~LINK_LIST()
+const T& LIST_NODE<T>::GetDataRef() const
 {
-	// 将链表置为空表
-	this->Clear();
+	return this->data;
 }
 
 
+/****************************************************************** LIST_ITERATOR类型API ****************************************************************/
 
 /*
- * Function:		Clear()
- * Description:		调用DeleteSlider()逐个删除结点，将链表置为空表
- * Time complexity:	假设类T的时间复杂度是O(m)，则该函数的时间复杂的为O(n*m)
+ * Function:		LIST_ITERATOR()
+ * Description:		LIST_ITERATOR类的无参构造函数，构造一个不属于任何链表的迭代器
+ * Time complexity:	O(1)
  * Input:
  * Output:
- * Return:			int类型，操作成功返回0，操作失败返回负数
+ * Return:
  */
-template <typename T>
-int LINK_LIST<T>::Clear()
+template <typename T, typename REF, typename PTR>
+LIST_ITERATOR<T, REF, PTR>::LIST_ITERATOR():node(NULL), list(NULL)
 {
-	// 重置游标
-	this->ResetSlider();
+}
 
-	// 删除结点
-	while(this->length != 0)
-	{
-		T deleted_data;
-		this->DeleteSlider(deleted_data);	// 与类T重载的赋值操作符时间复杂度相同
-	}
-	return 0;
+
+
+/*
+ * Function:		LIST_ITERATOR()
+ * Description:		LIST_ITERATOR类的有参构造函数
+ * Time complexity:	O(1)
+ * Input:
+ *		my_node:	LIST_NODE<T>*类型，迭代器指向的结点，NULL表示end()
+ *		my_list:	const LINK_LIST<T>*类型，迭代器所属的链表
+ * Output:
+ * Return:
+ */
+template <typename T, typename REF, typename PTR>
+LIST_ITERATOR<T, REF, PTR>::LIST_ITERATOR(LIST_NODE<T>* my_node, const LINK_LIST<T>* my_list):node(my_node), list(my_list)
+{
 }
 
 
 
 /*
- * Function:		GetLength()
- * Description:		获取链表长度
+ * Function:		LIST_ITERATOR()
+ * Description:		从可修改的迭代器构造，用于iterator到const_iterator的转换
  * Time complexity:	O(1)
  * Input:
+ *		list_iterator:	const LIST_ITERATOR<T, T&, T*>&类型，可修改的迭代器
  * Output:
- * Return:			int类型，操作成功返回链表长度，操作失败返回负数
+ * Return:
  */
-template <typename T>
-int LINK_LIST<T>::GetLength() const
+template <typename T, typename REF, typename PTR>
+LIST_ITERATOR<T, REF, PTR>::LIST_ITERATOR(const LIST_ITERATOR<T, T&, T*>& list_iterator):node(list_iterator.GetNode()), list(list_iterator.GetList())
 {
-	return this->length;
 }
 
 
 
 /*
- * Function:		IsEmpty()
- * Description:		判断链表是否为空表
+ * Function:		operator*()
+ * Description:		获取迭代器指向的结点数据的引用
  * Time complexity:	O(1)
  * Input:
  * Output:
- * Return:			bool类型，如果链表为空表返回true，如果链表不为空表则返回false
+ * Return:			REF类型，结点数据的引用
  */
-template <typename T>
-bool LINK_LIST<T>::IsEmpty() const
+template <typename T, typename REF, typename PTR>
+REF LIST_ITERATOR<T, REF, PTR>::operator*() const
 {
-	return (this->length == 0) ? true : false;
+	return this->node->GetDataRef();
 }
 
 
 
 /*
- * Function:		ResetSlider()
- * Description:		重置链表的游标，如果链表中有结点，游标指向第一个结点；如果链表中没有结点，游标置NULL
+ * Function:		operator->()
+ * Description:		获取迭代器指向的结点数据的地址
  * Time complexity:	O(1)
  * Input:
  * Output:
- * Return:			int类型，操作成功返回0，操作失败返回负数
+ * Return:			PTR类型，结点数据的地址
  */
-template <typename T>
-int LINK_LIST<T>::ResetSlider()
+template <typename T, typename REF, typename PTR>
+PTR LIST_ITERATOR<T, REF, PTR>::operator->() const
 {
-	// 如果链表为空表，游标置NULL
-	if (this->length == 0)
-	{
-		this->slider = NULL;
-	}
-	// 如果链表不为空，游标指向第一个结点
-	else
-	{
-		this->slider = this->header.GetNextNode();
-	}
-	return 0;
+	return &(this->node->GetDataRef());
 }
 
 
 
 /*
- * Function:		GetSlider()
- * Description:		获取链表游标指向的结点数据 
- * Time complexity:	与类T的重载的赋值操作符的时间复杂度相同
+ * Function:		operator++()
+ * Description:		迭代器指向其后继结点，最后一个结点的后继为end()
+ * Time complexity:	O(1)
  * Input:
  * Output:
- *		out_data:	T&类型，通过该引用，将游标指向的结点的数据传给调用者
- * Return:			int类型，操作成功返回0，操作失败返回负数
+ * Return:			LIST_ITERATOR&类型，移动之后的迭代器
  */
-template <typename T>
-int LINK_LIST<T>::GetSlider(T& out_data) const
+template <typename T, typename REF, typename PTR>
+LIST_ITERATOR<T, REF, PTR>& LIST_ITERATOR<T, REF, PTR>::operator++()
 {
-	// 如果链表为空表时，报错
-	if (this->length == 0)
-	{
-		cout << "func LINK_LIST<T>::GetSlider() err: this->length == 0" << endl;
-		return -1;
-	}
-	// 如果链表不为空表时，返回游标指向结点的数据
-	else
+	// 链表首尾相连，回到第一个结点说明已经越过最后一个结点
+	this->node = this->node->GetNextNode();
+	if (this->node == this->list->header.GetNextNode())
 	{
-		this->slider->GetNodeData(out_data);		// 与类T的重载的赋值操作符的时间复杂度相同
+		this->node = NULL;
 	}
+	return *this;
+}
 
-	return 0;
+
+
+/*
+ * Function:		operator++(int)
+ * Description:		迭代器指向其后继结点，返回移动之前的迭代器
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			LIST_ITERATOR类型，移动之前的迭代器
+ */
+template <typename T, typename REF, typename PTR>
+LIST_ITERATOR<T, REF, PTR> LIST_ITERATOR<T, REF, PTR>::operator++(int)
+{
+	LIST_ITERATOR<T, REF, PTR> old_iterator = *this;
+	++(*this);
+	return old_iterator;
 }
 
 
 
 /*
- * Function:		SliderForward()
- * Description:		获取当前游标指向的结点的数据，游标指向其后继结点
- * Time complexity:	与类T的重载的赋值操作符的时间复杂度相同
+ * Function:		operator--()
+ * Description:		迭代器指向其前驱结点，end()的前驱为最后一个结点
+ * Time complexity:	O(1)
  * Input:
  * Output:
- *		out_data:	T&类型，通过该引用，将游标指向的结点的数据传给调用者
- * Return:			int类型，操作成功返回0，操作失败返回负数
+ * Return:			LIST_ITERATOR&类型，移动之后的迭代器
  */
-template <typename T>
-int LINK_LIST<T>::SliderForward(T& out_data)
+template <typename T, typename REF, typename PTR>
+LIST_ITERATOR<T, REF, PTR>& LIST_ITERATOR<T, REF, PTR>::operator--()
 {
-	// 如果链表为空表，报错
-	if (this->length == 0)
+	// end()的前驱为第一个结点的前驱，即最后一个结点
+	if (this->node == NULL)
 	{
-		cout << "func LINK_LIST<T>::SliderForward() err: this->length == 0" << endl;
-		return -1;
+		this->node = this->list->header.GetNextNode()->GetPriorNode();
 	}
-	// 如果链表不为空表，缓存当前游标指向结点的数据，游标指向其后继结点
 	else
 	{
-		this->slider->GetNodeData(out_data);
-		this->slider = this->slider->GetNextNode();
+		this->node = this->node->GetPriorNode();
 	}
-
-	return 0;
+	return *this;
 }
 
 
 
 /*
- * Function:		SliderBackward()
- * Description:		获取当前游标指向的结点的数据，游标指向其前驱结点
- * Time complexity:	与类T的重载的赋值操作符的时间复杂度相同
+ * Function:		operator--(int)
+ * Description:		迭代器指向其前驱结点，返回移动之前的迭代器
+ * Time complexity:	O(1)
  * Input:
  * Output:
- *		out_data:	T&类型，通过该引用，将游标指向的结点的数据传给调用者
- * Return:			int类型，操作成功返回0，操作失败返回负数
+ * Return:			LIST_ITERATOR类型，移动之前的迭代器
  */
-template <typename T>
-int LINK_LIST<T>::SliderBackward(T& out_data)
+template <typename T, typename REF, typename PTR>
+LIST_ITERATOR<T, REF, PTR> LIST_ITERATOR<T, REF, PTR>::operator--(int)
 {
-	// 如果链表为空表，报错
-	if (this->length == 0)
-	{
-		cout << "func LINK_LIST<T>::SliderBackward() err: this->length == 0" << endl;
-		return -1;
-	}
-	// 如果链表不为空表，缓存当前游标指向结点的数据，游标指向其前驱结点
-	else
-	{
-		this->slider->GetNodeData(out_data);
-		this->slider = this->slider->GetPriorNode();
-	}
+	LIST_ITERATOR<T, REF, PTR> old_iterator = *this;
+	--(*this);
+	return old_iterator;
+}
 
-	return 0;
+
+
+/*
+ * Function:		operator==()
+ * Description:		判断两个迭代器是否指向同一个结点
+ * Time complexity:	O(1)
+ * Input:
+ *		list_iterator:	const LIST_ITERATOR&类型，比较的迭代器
+ * Output:
+ * Return:			bool类型，指向同一个结点返回true，否则返回false
+ */
+template <typename T, typename REF, typename PTR>
+bool LIST_ITERATOR<T, REF, PTR>::operator==(const LIST_ITERATOR<T, REF, PTR>& list_iterator) const
+{
+	return this->node == list_iterator.node;
 }
 
 
 
 /*
- * Function:		InsertBeforeSlider()
- * Description:		在游标指向的结点前面插入一个结点，并将游标指向插入的结点，在第一个结点之前插入的话，头结点会指向插入的结点
- * Time complexity:	与类T的重载的赋值操作符的时间复杂度相同
+ * Function:		operator!=()
+ * Description:		判断两个迭代器是否指向不同的结点
+ * Time complexity:	O(1)
  * Input:
- *		data:		const T&类型，插入的数据
+ *		list_iterator:	const LIST_ITERATOR&类型，比较的迭代器
  * Output:
- * Return:			int类型，操作成功返回0，操作失败返回负数
+ * Return:			bool类型，指向不同的结点返回true，否则返回false
  */
-template <typename T>
-int LINK_LIST<T>::InsertBeforeSlider(const T& data)
+template <typename T, typename REF, typename PTR>
+bool LIST_ITERATOR<T, REF, PTR>::operator!=(const LIST_ITERATOR<T, REF, PTR>& list_iterator) const
 {
-	// 申请结点空间并调用构造函数初始化结点空间
-	LIST_NODE<T>* list_node = new LIST_NODE<T>(data);				// 类LIST_NODE的拷贝构造函数，与类T重载的赋值操作符时间复杂度相同
-	if (list_node == NULL)
-	{
-		cout << "func LINK_LIST<T>::InsertBeforeSlider() err: list_node == NULL" << endl;
-		return -1;
-	}
+	return this->node != list_iterator.node;
+}
 
-	// 如果链表为空表，slider初始值为NULL
-	if ( this->length == 0)
-	{
-		this->header.SetNextNode(list_node);
-		list_node->SetNextNode(list_node);
-		list_node->SetPriorNode(list_node);
-	}
-	// 如果链表不为空，slider初始指向某个结点
-	else
-	{
-		LIST_NODE<T>* slider_prior = this->slider->GetPriorNode();	// 临时变量，指向初始slider指向结点的前驱结点
-		
-		// 设置结点的next指针
-		list_node->SetNextNode(this->slider);
-		slider_prior->SetNextNode(list_node);
 
-		// 设置结点的prior指针
-		this->slider->SetPriorNode(list_node);
-		list_node->SetPriorNode(slider_prior);
-	}
 
-	// 插入完成之后slider指向插入结点
-	this->slider = list_node;
-	
-	// 如果插入之前slider指向第一个结点，那么插入之后，插入的结点变成头结点
-	if (this->header.GetNextNode() == this->slider->GetNextNode())
-	{
-		this->header.SetNextNode(this->slider);
-	}
+/*
+ * Function:		GetNode()
+ * Description:		获取迭代器指向的结点的地址
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			LIST_NODE<T>*类型，迭代器指向的结点的地址，end()返回NULL
+ */
+template <typename T, typename REF, typename PTR>
+LIST_NODE<T>* LIST_ITERATOR<T, REF, PTR>::GetNode() const
+{
+	return this->node;
+}
 
-	// 链表长度加1
-	this->length ++;
-	
-	return 0;
+
+
+/*
+ * Function:		GetList()
+ * Description:		获取迭代器所属的链表的地址
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			const LINK_LIST<T>*类型，迭代器所属的链表的地址
+ */
+template <typename T, typename REF, typename PTR>
+const LINK_LIST<T>* LIST_ITERATOR<T, REF, PTR>::GetList() const
+{
+	return this->list;
 }
 
 
+/****************************************************************** LIST_RECLAIMER类型API ****************************************************************/
+/* LIST_RECLAIMER不是模板类，本文件会同时被编译为link_list.o和被其他源文件包含，所以成员函数都声明为inline */
 
 /*
- * Function:		InsertAfterSlider()
- * Description:		在游标指向的结点后面插入一个结点，并将游标指向插入的结点
- * Time complexity:	与类T的重载的赋值操作符的时间复杂度相同
+ * Function:		Submit()
+ * Description:		提交一条待释放的结点链，立即返回。回收线程无法启动时在当前线程直接释放
+ * Time complexity:	O(1)
  * Input:
- *		data:		const T&类型，插入的数据
+ *		chain:		void*类型，结点链的第一个结点
+ *		destroy:	void (*)(void* chain)类型，释放整条结点链的函数
  * Output:
- * Return:			int类型，操作成功返回0，操作失败返回负数
+ * Return:			int类型，交给回收线程返回0，在当前线程直接释放返回1
  */
-template <typename T>
-int LINK_LIST<T>::InsertAfterSlider(const T& data)
+inline int LIST_RECLAIMER::Submit(void* chain, void (*destroy)(void* chain))
 {
-	// 申请结点空间并调用构造函数初始化结点空间
-	LIST_NODE<T>* list_node = new LIST_NODE<T>(data);				// 临时变量，指向初始slider指向结点的前驱结点
-	if (list_node == NULL)
+	LIST_RECLAIMER& reclaimer = Instance();
+	if (!reclaimer.worker.joinable())
 	{
-		cout << "func LINK_LIST<T>::InsertAfterSlider() err: list_node == NULL" << endl;
-		return -1;
+		destroy(chain);
+		return 1;
 	}
 
-	// 如果链表为空表，slider初始值为NULL
-	if ( this->length == 0)
-	{
-		this->header.SetNextNode(list_node);
-		list_node->SetNextNode(list_node);
-		list_node->SetPriorNode(list_node);
-	}
-	// 如果链表不为空，slider初始指向某个结点
-	else
 	{
-		LIST_NODE<T>* slider_next = this->slider->GetNextNode();	// 临时变量，指向初始slider指向结点的后继结点
-		
-		// 设置结点的next指针
-		list_node->SetNextNode(slider_next);
-		this->slider->SetNextNode(list_node);
-		
-		// 设置prior指针
-		slider_next->SetPriorNode(list_node);
-		list_node->SetPriorNode(this->slider);
+		std::lock_guard<std::mutex> guard(reclaimer.task_mutex);
+		reclaimer.tasks.push_back(std::make_pair(chain, destroy));
 	}
-
-	// 插入完成之后slider指向插入结点
-	this->slider = list_node;
-	
-	// 链表长度加1
-	this->length ++;
-
+	reclaimer.task_cond.notify_all();
 	return 0;
 }
 
 
 
 /*
- * Function:			DeleteSlider()
- * Description:			删除游标指向的结点，获取删除结点的数据，游标指向删除结点的后继结点。如果删除的是第一个结点，被删除结点的后继结点将会变成第一个结点。如果删除之后链表变为空表，游标置NULL
- * Time complexity:		与类T重载的赋值操作符时间复杂度相同
+ * Function:		WaitIdle()
+ * Description:		等待已提交的任务全部完成
+ * Time complexity:	与已提交任务的释放时间相同
  * Input:
  * Output:
- *		deleted_data:	T&类型，通过该引用将删除的结点数据传出给调用者
- * Return:				int类型，操作成功返回0，操作失败返回负数
+ * Return:
  */
-template <typename T>
-int LINK_LIST<T>::DeleteSlider(T& deleted_data)
+inline void LIST_RECLAIMER::WaitIdle()
 {
-	// 如果链表为空表，报错
-	if (this->length == 0)
+	LIST_RECLAIMER& reclaimer = Instance();
+	std::unique_lock<std::mutex> lock(reclaimer.task_mutex);
+	while (!reclaimer.tasks.empty() || reclaimer.busy != 0)
 	{
-		cout << "func LINK_LIST<T>::DeleteSlider() err: this->length == 0" << endl;
-		return -1;
+		reclaimer.task_cond.wait(lock);
 	}
+}
 
-	// 缓存结点数据，通过引用传出
-	// 暂存结点地址，并通过引用传出结点数据
-	LIST_NODE<T>* deleted_node = this->slider;
+
+
+/*
+ * Function:		LIST_RECLAIMER()
+ * Description:		启动回收线程，启动失败时worker保持不可join，由Submit()在当前线程直接释放
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:
+ */
+inline LIST_RECLAIMER::LIST_RECLAIMER():busy(0), stopping(false)
+{
+	try
+	{
+		this->worker = std::thread(&LIST_RECLAIMER::Run, this);
+	}
+	catch (...)
+	{
+		cout << "func LIST_RECLAIMER::LIST_RECLAIMER() err: failed to start reclaimer thread" << endl;
+	}
+}
+
+
+
+/*
+ * Function:		~LIST_RECLAIMER()
+ * Description:		通知回收线程处理完剩余任务后退出，并等待其结束
+ * Time complexity:	与剩余任务的释放时间相同
+ * Input:
+ * Output:
+ * Return:
+ */
+inline LIST_RECLAIMER::~LIST_RECLAIMER()
+{
+	{
+		std::lock_guard<std::mutex> guard(this->task_mutex);
+		this->stopping = true;
+	}
+	this->task_cond.notify_all();
+	if (this->worker.joinable())
+	{
+		this->worker.join();
+	}
+}
+
+
+
+/*
+ * Function:		Instance()
+ * Description:		获取唯一的回收器对象，第一次调用时构造并启动回收线程
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			LIST_RECLAIMER&类型，回收器对象
+ */
+inline LIST_RECLAIMER& LIST_RECLAIMER::Instance()
+{
+	static LIST_RECLAIMER reclaimer;
+	return reclaimer;
+}
+
+
+
+/*
+ * Function:		Run()
+ * Description:		回收线程的主循环，每次取出一个任务在锁外执行，收到退出要求且没有剩余任务时返回
+ * Time complexity:
+ * Input:
+ * Output:
+ * Return:
+ */
+inline void LIST_RECLAIMER::Run()
+{
+	std::unique_lock<std::mutex> lock(this->task_mutex);
+	while (true)
+	{
+		while (this->tasks.empty() && !this->stopping)
+		{
+			this->task_cond.wait(lock);
+		}
+		if (this->tasks.empty())
+		{
+			break;
+		}
+
+		std::pair<void*, DESTROY_FUNC> task = this->tasks.front();
+		this->tasks.pop_front();
+		this->busy ++;
+		lock.unlock();
+		task.second(task.first);
+		lock.lock();
+		this->busy --;
+		this->task_cond.notify_all();
+	}
+}
+
+
+/****************************************************************** LINK_LIST类型API ****************************************************************/
+
+/*
+ * Function:		LINK_LIST()
+ * Description:		LINK_LIST类的无参构造函数，头结点调用LIST_NODE类的无参构造函数，length和slider置0
+ * Time complexity:	与类LIST_NODE的无参构造函数时间复杂度相同，LIST_NODE类无参构造函数同类T的无参构造函数时间复杂度相同
+ * Input:
+ * Output:
+ * Return:
+ */
+template <typename T>
+LINK_LIST<T>::LINK_LIST():header(), length(0), slider(NULL), blocks(),
+	partition_step(0), partition_length(0), partition_deleted(0), partitions(), partition_index()
+{
+	this->header.SetNextNode(NULL);
+}
+
+
+
+/*
+ * Function:		~LINK_LIST()
+ * Description:		LINK_LIST类的析构函数，调用Clear()清空链表结点
+ * Time complexity:	
+ * Input:
+ * Output:
+ * Return:
+ */
+template <typename T>
+LINK_LIST<T>::~LINK_LIST()
+{
+	// 将链表置为空表
+	this->Clear();
+}
+
+
+
+/*
+ * Function:		Clear()
+ * Description:		将链表置为空表，先把所有结点从头结点上摘下，再沿后继指针一次遍历释放，不拷贝数据也不逐个修改前驱后继
+ * Time complexity:	假设类T的析构函数时间复杂度是O(m)，则该函数的时间复杂的为O(n*m)
+ * Input:
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int LINK_LIST<T>::Clear()
+{
+	LIST_CHAIN<T> chain = this->DetachChain();
+	DestroyChain(chain);
+	return 0;
+}
+
+
+
+/*
+ * Function:		ClearDeferred()
+ * Description:		将链表置为空表，摘下的结点链交给后台回收线程LIST_RECLAIMER释放，本函数立即返回。
+ *					结点中的数据在回收线程中析构，调用者不能再持有指向这些数据的引用或迭代器
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int LINK_LIST<T>::ClearDeferred()
+{
+	if (this->header.GetNextNode() == NULL && this->blocks.empty())
+	{
+		return 0;
+	}
+
+	LIST_CHAIN<T>* deferred_chain = new LIST_CHAIN<T>();
+	if (deferred_chain == NULL)
+	{
+		this->Clear();
+		return 0;
+	}
+	LIST_CHAIN<T> chain = this->DetachChain();
+	deferred_chain->first = chain.first;
+	deferred_chain->blocks.swap(chain.blocks);
+	LIST_RECLAIMER::Submit(deferred_chain, DestroyDeferredChain);
+	return 0;
+}
+
+
+
+/*
+ * Function:		GetLength()
+ * Description:		获取链表长度
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			int类型，操作成功返回链表长度，操作失败返回负数
+ */
+template <typename T>
+int LINK_LIST<T>::GetLength() const
+{
+	return this->length;
+}
+
+
+
+/*
+ * Function:		IsEmpty()
+ * Description:		判断链表是否为空表
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			bool类型，如果链表为空表返回true，如果链表不为空表则返回false
+ */
+template <typename T>
+bool LINK_LIST<T>::IsEmpty() const
+{
+	return (this->length == 0) ? true : false;
+}
+
+
+
+/*
+ * Function:		ResetSlider()
+ * Description:		重置链表的游标，如果链表中有结点，游标指向第一个结点；如果链表中没有结点，游标置NULL
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int LINK_LIST<T>::ResetSlider()
+{
+	// 如果链表为空表，游标置NULL
+	if (this->length == 0)
+	{
+		this->slider = NULL;
+	}
+	// 如果链表不为空，游标指向第一个结点
+	else
+	{
+		this->slider = this->header.GetNextNode();
+	}
+	return 0;
+}
+
+
+
+/*
+ * Function:		GetSlider()
+ * Description:		获取链表游标指向的结点数据 
+ * Time complexity:	与类T的重载的赋值操作符的时间复杂度相同
+ * Input:
+ * Output:
+ *		out_data:	T&类型，通过该引用，将游标指向的结点的数据传给调用者
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int LINK_LIST<T>::GetSlider(T& out_data) const
+{
+	// 如果链表为空表时，报错
+	if (this->length == 0)
+	{
+		cout << "func LINK_LIST<T>::GetSlider() err: this->length == 0" << endl;
+		return -1;
+	}
+	// 如果链表不为空表时，返回游标指向结点的数据
+	else
+	{
+		this->slider->GetNodeData(out_data);		// 与类T的重载的赋值操作符的时间复杂度相同
+	}
+
+	return 0;
+}
+
+
+
+/*
+ * Function:		SliderForward()
+ * Description:		获取当前游标指向的结点的数据，游标指向其后继结点
+ * Time complexity:	与类T的重载的赋值操作符的时间复杂度相同
+ * Input:
+ * Output:
+ *		out_data:	T&类型，通过该引用，将游标指向的结点的数据传给调用者
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int LINK_LIST<T>::SliderForward(T& out_data)
+{
+	// 如果链表为空表，报错
+	if (this->length == 0)
+	{
+		cout << "func LINK_LIST<T>::SliderForward() err: this->length == 0" << endl;
+		return -1;
+	}
+	// 如果链表不为空表，缓存当前游标指向结点的数据，游标指向其后继结点
+	else
+	{
+		this->slider->GetNodeData(out_data);
+		this->slider = this->slider->GetNextNode();
+	}
+
+	return 0;
+}
+
+
+
+/*
+ * Function:		SliderBackward()
+ * Description:		获取当前游标指向的结点的数据，游标指向其前驱结点
+ * Time complexity:	与类T的重载的赋值操作符的时间复杂度相同
+ * Input:
+ * Output:
+ *		out_data:	T&类型，通过该引用，将游标指向的结点的数据传给调用者
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int LINK_LIST<T>::SliderBackward(T& out_data)
+{
+	// 如果链表为空表，报错
+	if (this->length == 0)
+	{
+		cout << "func LINK_LIST<T>::SliderBackward() err: this->length == 0" << endl;
+		return -1;
+	}
+	// 如果链表不为空表，缓存当前游标指向结点的数据，游标指向其前驱结点
+	else
+	{
+		this->slider->GetNodeData(out_data);
+		this->slider = this->slider->GetPriorNode();
+	}
+
+	return 0;
+}
+
+
+
+/*
+ * Function:		InsertBeforeSlider()
+ * Description:		在游标指向的结点前面插入一个结点，并将游标指向插入的结点，在第一个结点之前插入的话，头结点会指向插入的结点
+ * Time complexity:	与类T的重载的赋值操作符的时间复杂度相同
+ * Input:
+ *		data:		const T&类型，插入的数据
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int LINK_LIST<T>::InsertBeforeSlider(const T& data)
+{
+	// 申请结点空间并调用构造函数初始化结点空间
+	LIST_NODE<T>* list_node = new LIST_NODE<T>(data);				// 类LIST_NODE的拷贝构造函数，与类T重载的赋值操作符时间复杂度相同
+	if (list_node == NULL)
+	{
+		cout << "func LINK_LIST<T>::InsertBeforeSlider() err: list_node == NULL" << endl;
+		return -1;
+	}
+
+	// 如果链表为空表，slider初始值为NULL
+	if ( this->length == 0)
+	{
+		this->header.SetNextNode(list_node);
+		list_node->SetNextNode(list_node);
+		list_node->SetPriorNode(list_node);
+	}
+	// 如果链表不为空，slider初始指向某个结点
+	else
+	{
+		LIST_NODE<T>* slider_prior = this->slider->GetPriorNode();	// 临时变量，指向初始slider指向结点的前驱结点
+		
+		// 设置结点的next指针
+		list_node->SetNextNode(this->slider);
+		slider_prior->SetNextNode(list_node);
+
+		// 设置结点的prior指针
+		this->slider->SetPriorNode(list_node);
+		list_node->SetPriorNode(slider_prior);
+	}
+
+	// 插入完成之后slider指向插入结点
+	this->slider = list_node;
+	
+	// 如果插入之前slider指向第一个结点，那么插入之后，插入的结点变成头结点
+	if (this->header.GetNextNode() == this->slider->GetNextNode())
+	{
+		this->header.SetNextNode(this->slider);
+	}
+
+	// 链表长度加1
+	this->length ++;
+	
+	return 0;
+}
+
+
+
+/*
+ * Function:		InsertAfterSlider()
+ * Description:		在游标指向的结点后面插入一个结点，并将游标指向插入的结点
+ * Time complexity:	与类T的重载的赋值操作符的时间复杂度相同
+ * Input:
+ *		data:		const T&类型，插入的数据
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int LINK_LIST<T>::InsertAfterSlider(const T& data)
+{
+	// 申请结点空间并调用构造函数初始化结点空间
+	LIST_NODE<T>* list_node = new LIST_NODE<T>(data);				// 临时变量，指向初始slider指向结点的前驱结点
+	if (list_node == NULL)
+	{
+		cout << "func LINK_LIST<T>::InsertAfterSlider() err: list_node == NULL" << endl;
+		return -1;
+	}
+
+	// 如果链表为空表，slider初始值为NULL
+	if ( this->length == 0)
+	{
+		this->header.SetNextNode(list_node);
+		list_node->SetNextNode(list_node);
+		list_node->SetPriorNode(list_node);
+	}
+	// 如果链表不为空，slider初始指向某个结点
+	else
+	{
+		LIST_NODE<T>* slider_next = this->slider->GetNextNode();	// 临时变量，指向初始slider指向结点的后继结点
+		
+		// 设置结点的next指针
+		list_node->SetNextNode(slider_next);
+		this->slider->SetNextNode(list_node);
+		
+		// 设置prior指针
+		slider_next->SetPriorNode(list_node);
+		list_node->SetPriorNode(this->slider);
+	}
+
+	// 插入完成之后slider指向插入结点
+	this->slider = list_node;
+	
+	// 链表长度加1
+	this->length ++;
+
+	return 0;
+}
+
+
+
+/*
+ * Function:		InsertRangeBeforeSlider()
+ * Description:		在游标指向的结点前面按顺序插入[first, last)中的数据，游标指向插入的第一个结点，结果与按逆序逐个调用InsertBeforeSlider()相同。
+ *					所有结点一次申请在一块连续内存中，先在链表外串好，再一次接入链表，length和游标只更新一次
+ * Time complexity:	假设类T的拷贝构造函数时间复杂度为O(m)，插入k个数据，则本函数时间复杂度为O(k*m)
+ * Input:
+ *		first:		ITER类型，输入迭代器范围的开始，至少是前向迭代器，范围要遍历两次
+ *		last:		ITER类型，输入迭代器范围的结束
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+template <typename ITER>
+int LINK_LIST<T>::InsertRangeBeforeSlider(ITER first, ITER last)
+{
+	LIST_NODE<T>* first_node = NULL;
+	LIST_NODE<T>* last_node = NULL;
+	int count = this->BuildRange(first, last, first_node, last_node);
+	if (count < 0)
+	{
+		cout << "func LINK_LIST<T>::InsertRangeBeforeSlider() err: count < 0" << endl;
+		return -1;
+	}
+	if (count == 0)
+	{
+		return 0;
+	}
+
+	// 如果链表为空表，结点链首尾相连即为整个链表
+	if (this->length == 0)
+	{
+		last_node->SetNextNode(first_node);
+		first_node->SetPriorNode(last_node);
+		this->header.SetNextNode(first_node);
+	}
+	// 如果链表不为空，把结点链整体接到游标和其前驱之间，只修改四个指针
+	else
+	{
+		LIST_NODE<T>* slider_prior = this->slider->GetPriorNode();
+		slider_prior->SetNextNode(first_node);
+		first_node->SetPriorNode(slider_prior);
+		last_node->SetNextNode(this->slider);
+		this->slider->SetPriorNode(last_node);
+
+		// 如果插入之前游标指向第一个结点，插入的第一个结点变成第一个结点
+		if (this->header.GetNextNode() == this->slider)
+		{
+			this->header.SetNextNode(first_node);
+		}
+	}
+
+	this->slider = first_node;
+	this->length += count;
+	return 0;
+}
+
+
+
+/*
+ * Function:		InsertRangeAfterSlider()
+ * Description:		在游标指向的结点后面按顺序插入[first, last)中的数据，游标指向插入的最后一个结点，结果与按顺序逐个调用InsertAfterSlider()相同。
+ *					所有结点一次申请在一块连续内存中，先在链表外串好，再一次接入链表，length和游标只更新一次
+ * Time complexity:	假设类T的拷贝构造函数时间复杂度为O(m)，插入k个数据，则本函数时间复杂度为O(k*m)
+ * Input:
+ *		first:		ITER类型，输入迭代器范围的开始，至少是前向迭代器，范围要遍历两次
+ *		last:		ITER类型，输入迭代器范围的结束
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+template <typename ITER>
+int LINK_LIST<T>::InsertRangeAfterSlider(ITER first, ITER last)
+{
+	LIST_NODE<T>* first_node = NULL;
+	LIST_NODE<T>* last_node = NULL;
+	int count = this->BuildRange(first, last, first_node, last_node);
+	if (count < 0)
+	{
+		cout << "func LINK_LIST<T>::InsertRangeAfterSlider() err: count < 0" << endl;
+		return -1;
+	}
+	if (count == 0)
+	{
+		return 0;
+	}
+
+	// 如果链表为空表，结点链首尾相连即为整个链表
+	if (this->length == 0)
+	{
+		last_node->SetNextNode(first_node);
+		first_node->SetPriorNode(last_node);
+		this->header.SetNextNode(first_node);
+	}
+	// 如果链表不为空，把结点链整体接到游标和其后继之间，只修改四个指针
+	else
+	{
+		LIST_NODE<T>* slider_next = this->slider->GetNextNode();
+		this->slider->SetNextNode(first_node);
+		first_node->SetPriorNode(this->slider);
+		last_node->SetNextNode(slider_next);
+		slider_next->SetPriorNode(last_node);
+	}
+
+	this->slider = last_node;
+	this->length += count;
+	return 0;
+}
+
+
+
+/*
+ * Function:		InsertSorted()
+ * Description:		链表按less升序排列时，插入data并保持有序，相等的数据插入到已有数据之后，游标指向插入的结点。
+ *					插入位置从游标出发向前或向后查找（指针查找，finger search），比表头和表尾更远时直接插入到两端，
+ *					连续插入的数据相近时每次只需走过两次插入位置之间的结点
+ * Time complexity:	O(d)，d为游标与插入位置之间的结点数，与类T的拷贝构造函数时间复杂度相同
+ * Input:
+ *		data:		const T&类型，插入的数据
+ *		less:		COMPARE类型，比较函数或函数对象，less(a, b)为true表示a排在b前面，默认为std::less<T>
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+template <typename COMPARE>
+int LINK_LIST<T>::InsertSorted(const T& data, COMPARE less)
+{
+	if (this->length == 0)
+	{
+		return this->InsertAfterSlider(data);
+	}
+
+	LIST_NODE<T>* first_node = this->header.GetNextNode();
+	LIST_NODE<T>* last_node = first_node->GetPriorNode();
+
+	// 比第一个结点小，插入到表头；不比最后一个结点小，插入到表尾
+	if (less(data, first_node->GetDataRef()))
+	{
+		this->slider = first_node;
+		return this->InsertBeforeSlider(data);
+	}
+	if (!less(data, last_node->GetDataRef()))
+	{
+		this->slider = last_node;
+		return this->InsertAfterSlider(data);
+	}
+
+	// 插入位置在表内：在最后一个不大于data的结点之后。两端已经排除，向前向后查找都不会越过表头表尾
+	LIST_NODE<T>* current_node = this->slider;
+	if (!less(data, current_node->GetDataRef()))
+	{
+		while (!less(data, current_node->GetNextNode()->GetDataRef()))
+		{
+			current_node = current_node->GetNextNode();
+		}
+	}
+	else
+	{
+		do
+		{
+			current_node = current_node->GetPriorNode();
+		} while (less(data, current_node->GetDataRef()));
+	}
+
+	this->slider = current_node;
+	return this->InsertAfterSlider(data);
+}
+
+template <typename T>
+int LINK_LIST<T>::InsertSorted(const T& data)
+{
+	return this->InsertSorted(data, std::less<T>());
+}
+
+
+
+/*
+ * Function:		MergeSorted()
+ * Description:		链表按less升序排列时，把按less升序排列的[first, last)合并到链表中。第一个数据用InsertSorted()从游标出发定位，
+ *					之后的数据只从上一个插入的结点向后查找，整批数据一次扫描完成，游标指向最后插入的结点。[first, last)不是升序时不插入任何数据
+ * Time complexity:	O(d + k)，k为插入的数据个数，d为第一个插入位置与游标的距离加上插入位置之间跨过的结点数
+ * Input:
+ *		first:		ITER类型，输入迭代器范围的开始，至少是前向迭代器，范围要遍历两次
+ *		last:		ITER类型，输入迭代器范围的结束
+ *		less:		COMPARE类型，比较函数或函数对象，默认为std::less<T>
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+template <typename ITER, typename COMPARE>
+int LINK_LIST<T>::MergeSorted(ITER first, ITER last, COMPARE less)
+{
+	if (first == last)
+	{
+		return 0;
+	}
+
+	// 先检查输入是否升序，避免插入一半之后才发现
+	ITER prior_it = first;
+	for (ITER it = first; ++it != last; prior_it = it)
+	{
+		if (less(*it, *prior_it))
+		{
+			cout << "func LINK_LIST<T>::MergeSorted() err: input is not sorted" << endl;
+			return -1;
+		}
+	}
+
+	if (this->InsertSorted(*first, less) != 0)
+	{
+		cout << "func LINK_LIST<T>::MergeSorted() err: InsertSorted() failed" << endl;
+		return -1;
+	}
+
+	// 之后每个数据都不小于上一个，插入位置只会在游标之后，走到表尾（后继为第一个结点）就停止
+	LIST_NODE<T>* first_node = this->header.GetNextNode();
+	ITER it = first;
+	for (++it; it != last; ++it)
+	{
+		while (this->slider->GetNextNode() != first_node && !less(*it, this->slider->GetNextNode()->GetDataRef()))
+		{
+			this->slider = this->slider->GetNextNode();
+		}
+		if (this->InsertAfterSlider(*it) != 0)
+		{
+			cout << "func LINK_LIST<T>::MergeSorted() err: InsertAfterSlider() failed" << endl;
+			return -1;
+		}
+	}
+	return 0;
+}
+
+template <typename T>
+template <typename ITER>
+int LINK_LIST<T>::MergeSorted(ITER first, ITER last)
+{
+	return this->MergeSorted(first, last, std::less<T>());
+}
+
+
+
+/*
+ * Function:			DeleteSlider()
+ * Description:			删除游标指向的结点，获取删除结点的数据，游标指向删除结点的后继结点。如果删除的是第一个结点，被删除结点的后继结点将会变成第一个结点。如果删除之后链表变为空表，游标置NULL
+ * Time complexity:		与类T重载的赋值操作符时间复杂度相同
+ * Input:
+ * Output:
+ *		deleted_data:	T&类型，通过该引用将删除的结点数据传出给调用者
+ * Return:				int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int LINK_LIST<T>::DeleteSlider(T& deleted_data)
+{
+	// 如果链表为空表，报错
+	if (this->length == 0)
+	{
+		cout << "func LINK_LIST<T>::DeleteSlider() err: this->length == 0" << endl;
+		return -1;
+	}
+
+	// 缓存结点数据，通过引用传出
+	// 暂存结点地址，并通过引用传出结点数据
+	LIST_NODE<T>* deleted_node = this->slider;
 	deleted_node->GetNodeData(deleted_data);							// 与类T重载的赋值操作符时间复杂度相同
+	this->UnmarkNode(deleted_node);
 	
 	// 如果删除结点之后链表变为空表，则删除之后游标置NULL
 	if (this->length == 1)
 	{
-		this->slider == NULL;
-		this->header.SetNextNode(NULL);									// 删除结点
+		this->slider = NULL;
+		this->header.SetNextNode(NULL);									// 删除结点
+	}
+	// 如果删除结点之后还有其他结点, 游标指向其后继结点
+	else if (this->length > 1)
+	{
+		// 删除结点并移动游标
+		LIST_NODE<T>* slider_prior = this->slider->GetPriorNode();		// 删除之前，游标的前驱结点的地址
+		this->slider = this->slider->GetNextNode();						// 移动游标
+		slider_prior->SetNextNode(this->slider);						// 删除结点
+		this->slider->SetPriorNode(slider_prior);
+
+		// 如果删除的结点是链表的第一个结点，则将头结点指向删除之前的第二个结点（即删除之后游标指向的结点）
+		if (this->header.GetNextNode() == deleted_node)
+		{
+			this->header.SetNextNode(this->slider);
+		}
+	}
+
+	// 释放删除结点空间
+	this->FreeNode(deleted_node);
+
+	// 链表长度减1
+	this->length --;
+
+	return 0;
+}
+
+
+
+/*
+ * Function:		SetSlider()
+ * Description:		如果链表中存在某个结点包含数据data，将游标指向第一个包含该数据的结点
+ * Time complexity:	假设类T重载的==操作符时间复杂度为O(m)，则该函数时间复杂度为O(n*m)
+ * Input:
+ *		data:		const T&类型，在链表中匹配该数据
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int LINK_LIST<T>::SetSlider(const T& data)
+{
+	// 如果链表为空表，报错
+	if (this->length == 0)
+	{
+		cout << "func LINK_LIST<T>::SetSlider() err: this->length == 0" << endl;
+		return -1;
+	}
+
+	// 重置游标
+	this->ResetSlider();
+
+	// 遍历链表，查找第一个包含data的结点
+	int i = 0;
+	for (i = 0; i < this->length; ++i)
+	{
+		T current_node_data;								// 定义一个临时变量暂存游标指向结点的数据。调用类型T的构造函数。
+		this->slider->GetNodeData(current_node_data);		// 获取当前结点的数据
+
+		// 判断当前结点的数据是否等于data，如果是，跳出循环，游标指向第一个包含数据data的结点。调用类型T的重载==操作
+		if (data == current_node_data)						// 类T重载的==操作符
+		{
+			break;
+		}
+		
+		// 游标指向其后继结点
+		this->slider = this->slider->GetNextNode();
+	}
+
+	// 如果没有找到，报错
+	if (i >= this->length)
+	{
+		cout << " func LINK_LIST<T>::SetSlider() err: i >= this->length" << endl;
+		return -2;
+	}
+
+	return 0;
+}
+
+
+
+/*
+ * Function:		Traverse()
+ * Description:		遍历链表，每个结点的数据data作为参数，调用函数visit()，不改变游标
+ * Time complexity:	假设类T重载的赋值操作符时间复杂度为O(m)，visit()的时间复杂度为O(t)，则本函数时间复杂度为O(n*m + n*t)
+ * Input:
+ *		visit:		int (*)(T& data)类型，函数指针，以类T的引用为参数
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int LINK_LIST<T>::Traverse(int (*visit)(T& data))
+{
+	// 使用局部指针遍历链表，不修改游标
+	LIST_NODE<T>* current_node = this->header.GetNextNode();
+	for (int i = 0; i < this->length; ++i)
+	{
+		T current_node_data;								// 用来暂存当前结点的数据
+		current_node->GetNodeData(current_node_data);
+
+		// 结点数据作为参数，调用visit()，并用func_status监控visit()运行情况
+		int func_status = visit(current_node_data);
+		if (func_status != 0)
+		{
+			cout << "func LINK_LIST<T>::Traverse() err: func_status != 0" << endl;
+			return -1;
+		}
+
+		// 指向其后继结点
+		current_node = current_node->GetNextNode();
+	}
+	return 0;
+}
+
+
+
+/*
+ * Function:		TraversePrefetch()
+ * Description:		与Traverse()相同，但另有一个预取指针领先当前结点LINK_LIST_PREFETCH_DISTANCE个结点并预取其后继结点，
+ *					使访存延迟与visit()的执行重叠。结点在内存中分散、visit()耗时与一次缓存缺失相当时效果明显
+ * Time complexity:	与Traverse()相同
+ * Input:
+ *		visit:		int (*)(T& data)类型，函数指针，以类T的引用为参数
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int LINK_LIST<T>::TraversePrefetch(int (*visit)(T& data))
+{
+	// 预取指针先走到领先的位置，沿途预取；链表首尾相连，预取指针不会走到无效地址
+	LIST_NODE<T>* current_node = this->header.GetNextNode();
+	LIST_NODE<T>* prefetch_node = current_node;
+	for (int i = 0; i < LINK_LIST_PREFETCH_DISTANCE && i < this->length; ++i)
+	{
+		prefetch_node = prefetch_node->GetNextNode();
+		LINK_LIST_PREFETCH(prefetch_node);
+	}
+
+	for (int i = 0; i < this->length; ++i)
+	{
+		// 预取指针与当前结点同步前进
+		if (i + LINK_LIST_PREFETCH_DISTANCE < this->length)
+		{
+			prefetch_node = prefetch_node->GetNextNode();
+			LINK_LIST_PREFETCH(prefetch_node);
+		}
+
+		T current_node_data;								// 用来暂存当前结点的数据
+		current_node->GetNodeData(current_node_data);
+
+		int func_status = visit(current_node_data);
+		if (func_status != 0)
+		{
+			cout << "func LINK_LIST<T>::TraversePrefetch() err: func_status != 0" << endl;
+			return -1;
+		}
+
+		current_node = current_node->GetNextNode();
+	}
+	return 0;
+}
+
+
+
+/*
+ * Function:		SetSliderBatch()
+ * Description:		对count个链表分别执行SetSlider()，在lists[i]中查找datas[i]。各链表的查找交错进行，
+ *					每轮每个链表前进一个结点并预取下一个结点，多个链表的访存延迟相互重叠。找不到时不输出错误信息
+ * Time complexity:	假设类T重载的==操作符时间复杂度为O(m)，则本函数时间复杂度为O((n1 + n2 + ... + ncount)*m)
+ * Input:
+ *		lists:		LINK_LIST<T>*[]类型，count个链表的地址，可以重复
+ *		datas:		const T[]类型，在每个链表中查找的数据
+ *		count:		int类型，链表个数
+ * Output:
+ *		results:	int[]类型，results[i]为第i个查找的结果：找到并移动了游标为0，没有找到为-2，参数错误为-1
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int LINK_LIST<T>::SetSliderBatch(LINK_LIST<T>* lists[], const T datas[], int count, int results[])
+{
+	if (lists == NULL || datas == NULL || results == NULL || count < 0)
+	{
+		cout << "func LINK_LIST<T>::SetSliderBatch() err: lists == NULL || datas == NULL || results == NULL || count < 0" << endl;
+		return -1;
+	}
+
+	LIST_NODE<T>* cursors[LINK_LIST_BATCH_MAX];			// 每个查找当前所在的结点
+	int remains[LINK_LIST_BATCH_MAX];					// 每个查找还没有比较的结点数
+	int indexes[LINK_LIST_BATCH_MAX];					// 仍在进行的查找在参数数组中的下标
+
+	// 每次最多交错进行LINK_LIST_BATCH_MAX个查找
+	for (int base = 0; base < count; base += LINK_LIST_BATCH_MAX)
+	{
+		// 初始化本组查找，预取每个链表的第一个结点
+		int active = 0;
+		for (int i = base; i < count && i < base + LINK_LIST_BATCH_MAX; ++i)
+		{
+			if (lists[i] == NULL)
+			{
+				results[i] = -1;
+				continue;
+			}
+			if (lists[i]->length == 0)
+			{
+				results[i] = -2;
+				continue;
+			}
+			cursors[active] = lists[i]->header.GetNextNode();
+			remains[active] = lists[i]->length;
+			indexes[active] = i;
+			LINK_LIST_PREFETCH(cursors[active]);
+			active ++;
+		}
+
+		// 轮流推进每个查找，结束的查找用最后一个查找填补位置
+		while (active > 0)
+		{
+			for (int i = 0; i < active; )
+			{
+				int index = indexes[i];
+				if (datas[index] == cursors[i]->GetDataRef())
+				{
+					lists[index]->slider = cursors[i];
+					results[index] = 0;
+				}
+				else if (-- remains[i] == 0)
+				{
+					results[index] = -2;
+				}
+				else
+				{
+					cursors[i] = cursors[i]->GetNextNode();
+					LINK_LIST_PREFETCH(cursors[i]);
+					++i;
+					continue;
+				}
+
+				active --;
+				cursors[i] = cursors[active];
+				remains[i] = remains[active];
+				indexes[i] = indexes[active];
+			}
+		}
+	}
+	return 0;
+}
+
+
+
+/*
+ * Function:		begin()
+ * Description:		获取指向第一个结点的迭代器，空表时等于end()，不改变游标
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			iterator类型，指向第一个结点的迭代器
+ */
+template <typename T>
+typename LINK_LIST<T>::iterator LINK_LIST<T>::begin()
+{
+	return iterator(this->header.GetNextNode(), this);		// 空表时头结点的后继为NULL，即end()
+}
+
+
+
+/*
+ * Function:		end()
+ * Description:		获取指向最后一个结点之后位置的迭代器
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			iterator类型，尾后迭代器
+ */
+template <typename T>
+typename LINK_LIST<T>::iterator LINK_LIST<T>::end()
+{
+	return iterator(NULL, this);
+}
+
+
+
+/*
+ * Function:		begin()
+ * Description:		获取指向第一个结点的只读迭代器，空表时等于end()
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			const_iterator类型，指向第一个结点的只读迭代器
+ */
+template <typename T>
+typename LINK_LIST<T>::const_iterator LINK_LIST<T>::begin() const
+{
+	return const_iterator(this->header.GetNextNode(), this);
+}
+
+
+
+/*
+ * Function:		end()
+ * Description:		获取指向最后一个结点之后位置的只读迭代器
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			const_iterator类型，尾后只读迭代器
+ */
+template <typename T>
+typename LINK_LIST<T>::const_iterator LINK_LIST<T>::end() const
+{
+	return const_iterator(NULL, this);
+}
+
+
+
+/*
+ * Function:		cbegin()
+ * Description:		获取指向第一个结点的只读迭代器，空表时等于cend()
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			const_iterator类型，指向第一个结点的只读迭代器
+ */
+template <typename T>
+typename LINK_LIST<T>::const_iterator LINK_LIST<T>::cbegin() const
+{
+	return this->begin();
+}
+
+
+
+/*
+ * Function:		cend()
+ * Description:		获取指向最后一个结点之后位置的只读迭代器
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			const_iterator类型，尾后只读迭代器
+ */
+template <typename T>
+typename LINK_LIST<T>::const_iterator LINK_LIST<T>::cend() const
+{
+	return this->end();
+}
+
+
+
+/*
+ * Function:		rbegin()
+ * Description:		获取指向最后一个结点的反向迭代器
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			reverse_iterator类型，指向最后一个结点的反向迭代器
+ */
+template <typename T>
+typename LINK_LIST<T>::reverse_iterator LINK_LIST<T>::rbegin()
+{
+	return reverse_iterator(this->end());
+}
+
+
+
+/*
+ * Function:		rend()
+ * Description:		获取指向第一个结点之前位置的反向迭代器
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			reverse_iterator类型，反向尾后迭代器
+ */
+template <typename T>
+typename LINK_LIST<T>::reverse_iterator LINK_LIST<T>::rend()
+{
+	return reverse_iterator(this->begin());
+}
+
+
+
+/*
+ * Function:		rbegin()
+ * Description:		获取指向最后一个结点的只读反向迭代器
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			const_reverse_iterator类型，指向最后一个结点的只读反向迭代器
+ */
+template <typename T>
+typename LINK_LIST<T>::const_reverse_iterator LINK_LIST<T>::rbegin() const
+{
+	return const_reverse_iterator(this->end());
+}
+
+
+
+/*
+ * Function:		rend()
+ * Description:		获取指向第一个结点之前位置的只读反向迭代器
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			const_reverse_iterator类型，只读反向尾后迭代器
+ */
+template <typename T>
+typename LINK_LIST<T>::const_reverse_iterator LINK_LIST<T>::rend() const
+{
+	return const_reverse_iterator(this->begin());
+}
+
+
+
+/*
+ * Function:		Insert()
+ * Description:		在迭代器pos指向的结点之前插入一个结点，pos为end()时插入到链表末尾，在第一个结点之前插入的话，头结点会指向插入的结点。
+ *					游标不变，空表插入之后游标指向插入的结点
+ * Time complexity:	与类T的拷贝构造函数时间复杂度相同
+ * Input:
+ *		pos:		iterator类型，插入位置
+ *		data:		const T&类型，插入的数据
+ * Output:
+ * Return:			iterator类型，指向插入的结点的迭代器，操作失败返回end()
+ */
+template <typename T>
+typename LINK_LIST<T>::iterator LINK_LIST<T>::Insert(iterator pos, const T& data)
+{
+	// 申请结点空间并调用构造函数初始化结点空间
+	LIST_NODE<T>* list_node = new LIST_NODE<T>(data);
+	if (list_node == NULL)
+	{
+		cout << "func LINK_LIST<T>::Insert() err: list_node == NULL" << endl;
+		return this->end();
+	}
+
+	// 如果链表为空表，插入的结点成为第一个结点，游标指向它
+	if (this->length == 0)
+	{
+		this->header.SetNextNode(list_node);
+		this->slider = list_node;
+	}
+	// 如果链表不为空，插入到pos指向的结点之前，end()之前即第一个结点之前的环上位置
+	else
+	{
+		LIST_NODE<T>* pos_node = (pos.GetNode() == NULL) ? this->header.GetNextNode() : pos.GetNode();
+		LIST_NODE<T>* pos_prior = pos_node->GetPriorNode();
+
+		list_node->SetNextNode(pos_node);
+		list_node->SetPriorNode(pos_prior);
+		pos_prior->SetNextNode(list_node);
+		pos_node->SetPriorNode(list_node);
+
+		// 在第一个结点之前插入的话，插入的结点成为第一个结点
+		if (pos.GetNode() == this->header.GetNextNode())
+		{
+			this->header.SetNextNode(list_node);
+		}
+	}
+
+	// 链表长度加1
+	this->length ++;
+
+	return iterator(list_node, this);
+}
+
+
+
+/*
+ * Function:		Erase()
+ * Description:		删除迭代器pos指向的结点。如果游标指向被删除的结点，游标指向其后继结点；如果删除之后链表变为空表，游标置NULL
+ * Time complexity:	O(1)
+ * Input:
+ *		pos:		iterator类型，删除的位置，不能是end()
+ * Output:
+ * Return:			iterator类型，指向被删除结点的后继结点的迭代器，删除的是最后一个结点时返回end()
+ */
+template <typename T>
+typename LINK_LIST<T>::iterator LINK_LIST<T>::Erase(iterator pos)
+{
+	LIST_NODE<T>* deleted_node = pos.GetNode();
+
+	// 参数检查
+	if (this->length == 0 || deleted_node == NULL)
+	{
+		cout << "func LINK_LIST<T>::Erase() err: this->length == 0 || deleted_node == NULL" << endl;
+		return this->end();
+	}
+
+	this->UnmarkNode(deleted_node);
+	LIST_NODE<T>* next_node = deleted_node->GetNextNode();
+	bool is_last = (next_node == this->header.GetNextNode());		// 删除的是否是最后一个结点
+
+	// 如果删除结点之后链表变为空表
+	if (this->length == 1)
+	{
+		this->header.SetNextNode(NULL);
+		this->slider = NULL;
+		next_node = NULL;
+	}
+	// 如果删除结点之后还有其他结点
+	else
+	{
+		LIST_NODE<T>* prior_node = deleted_node->GetPriorNode();
+		prior_node->SetNextNode(next_node);
+		next_node->SetPriorNode(prior_node);
+
+		// 删除第一个结点时，头结点指向其后继结点
+		if (this->header.GetNextNode() == deleted_node)
+		{
+			this->header.SetNextNode(next_node);
+		}
+
+		// 游标指向被删除的结点时，游标指向其后继结点
+		if (this->slider == deleted_node)
+		{
+			this->slider = next_node;
+		}
+	}
+
+	// 释放删除结点空间，链表长度减1
+	this->FreeNode(deleted_node);
+	this->length --;
+
+	return is_last ? this->end() : iterator(next_node, this);
+}
+
+
+
+/*
+ * Function:		Compact()
+ * Description:		按链表顺序把所有结点的数据移动到一块新申请的连续内存中，并释放原来的结点，头结点和游标随之更新，游标仍指向原来的数据。
+ *					之后顺序遍历依次访问相邻的内存。之后插入的结点仍单独申请；块内的结点被删除时只析构，整块在其中的结点全部删除后释放。
+ *					所有迭代器失效。类T需要有无参构造函数和赋值操作符，C++11之后优先使用移动赋值
+ * Time complexity:	假设类T的赋值操作符时间复杂度为O(m)，则本函数时间复杂度为O(n*m)
+ * Input:
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int LINK_LIST<T>::Compact()
+{
+	if (this->length == 0)
+	{
+		return 0;
+	}
+
+	// 申请连续内存，只申请空间，结点在下面逐个构造
+	LIST_NODE<T>* new_block = (LIST_NODE<T>*)::operator new(sizeof(LIST_NODE<T>) * this->length, std::nothrow);
+	if (new_block == NULL)
+	{
+		cout << "func LINK_LIST<T>::Compact() err: new_block == NULL" << endl;
+		return -1;
+	}
+
+	// 按链表顺序移动数据，原结点移出数据后立即释放；原结点可能在旧的连续结点块中，由FreeNode()区分
+	LIST_NODE<T>* old_node = this->header.GetNextNode();
+	LIST_NODE<T>* new_slider = NULL;
+	for (int i = 0; i < this->length; ++i)
+	{
+		LIST_NODE<T>* next_node = old_node->GetNextNode();
+		new (&new_block[i]) LIST_NODE<T>();
+		new_block[i].GetDataRef() = std::move(old_node->GetDataRef());
+		if (old_node == this->slider)
+		{
+			new_slider = &new_block[i];
+		}
+		this->FreeNode(old_node);
+		old_node = next_node;
+	}
+
+	// 新结点首尾相连
+	for (int i = 0; i < this->length; ++i)
+	{
+		new_block[i].SetNextNode(&new_block[(i + 1) % this->length]);
+		new_block[i].SetPriorNode(&new_block[(i + this->length - 1) % this->length]);
+	}
+
+	this->header.SetNextNode(&new_block[0]);
+	this->slider = new_slider;
+	LIST_BLOCK& block = this->blocks[new_block];
+	block.size = this->length;
+	block.live = this->length;
+
+	// 结点地址全部改变，重建分区标记
+	if (this->partition_step > 0)
+	{
+		this->RebuildPartitions();
+	}
+	return 0;
+}
+
+
+
+/*
+ * Function:		EnablePartitions()
+ * Description:		开始维护分区标记：每隔step个结点标记一个结点，把链表分成若干段供ParallelTraverse()和ParallelReduce()分给多个线程。
+ *					插入结点不影响已有的标记；删除标记结点时标记移到其后继结点；插入删除的结点数超过重建时长度的一半后，下一次并行遍历前重建标记
+ * Time complexity:	O(n)
+ * Input:
+ *		step:		int类型，标记间隔，大于0
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int LINK_LIST<T>::EnablePartitions(int step)
+{
+	if (step <= 0)
+	{
+		cout << "func LINK_LIST<T>::EnablePartitions() err: step <= 0" << endl;
+		return -1;
+	}
+
+	this->partition_step = step;
+	this->RebuildPartitions();
+	return 0;
+}
+
+
+
+/*
+ * Function:		DisablePartitions()
+ * Description:		停止维护分区标记并释放标记占用的内存，之后ParallelTraverse()和ParallelReduce()在调用线程中顺序执行
+ * Time complexity:	O(p)，p为标记数
+ * Input:
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int LINK_LIST<T>::DisablePartitions()
+{
+	this->partition_step = 0;
+	this->partition_length = 0;
+	this->partition_deleted = 0;
+	std::vector<LIST_NODE<T>*>().swap(this->partitions);
+	std::unordered_map<LIST_NODE<T>*, int>().swap(this->partition_index);
+	return 0;
+}
+
+
+
+/*
+ * Function:		ParallelTraverse()
+ * Description:		按分区标记把链表分成若干段，连续的几段交给同一个线程，各线程同时以每个结点的数据为参数调用visit()，不改变游标。
+ *					visit()会被多个线程同时调用，对共享数据的访问需要调用者自己同步；遍历期间不能修改链表。没有分区标记时在调用线程中顺序遍历
+ * Time complexity:	假设visit()的时间复杂度为O(t)，线程数为c，则本函数时间复杂度为O(n*t/c + c)，重建标记时另加O(n)
+ * Input:
+ *		visit:		int (*)(T& data)类型，函数指针，以类T的引用为参数
+ *		thread_num:	int类型，线程数（包括调用线程），不大于0时取std::thread::hardware_concurrency()
+ * Output:
+ * Return:			int类型，操作成功返回0，某次visit()返回非0或线程创建失败返回负数
+ */
+template <typename T>
+int LINK_LIST<T>::ParallelTraverse(int (*visit)(T& data), int thread_num)
+{
+	if (visit == NULL)
+	{
+		cout << "func LINK_LIST<T>::ParallelTraverse() err: visit == NULL" << endl;
+		return -1;
+	}
+	if (this->length == 0)
+	{
+		return 0;
 	}
-	// 如果删除结点之后还有其他结点, 游标指向其后继结点
-	else if (this->length > 1)
+
+	std::vector<LIST_NODE<T>*> segments;
+	this->GetSegments(segments);
+	int segment_num = (int)segments.size();
+	if (thread_num <= 0)
 	{
-		// 删除结点并移动游标
-		LIST_NODE<T>* slider_prior = this->slider->GetPriorNode();		// 删除之前，游标的前驱结点的地址
-		this->slider = this->slider->GetNextNode();						// 移动游标
-		slider_prior->SetNextNode(this->slider);						// 删除结点
-		this->slider->SetPriorNode(slider_prior);
+		thread_num = (int)std::thread::hardware_concurrency();
+	}
+	thread_num = (thread_num < 1) ? 1 : ((thread_num > segment_num) ? segment_num : thread_num);
 
-		// 如果删除的结点是链表的第一个结点，则将头结点指向删除之前的第二个结点（即删除之后游标指向的结点）
-		if (this->header.GetNextNode() == deleted_node)
+	// 第i个线程负责第[i*segment_num/thread_num, (i+1)*segment_num/thread_num)段，第0组在调用线程中执行
+	std::vector<int> status(thread_num, 0);
+	std::vector<std::thread> workers;
+	int ret = 0;
+	for (int i = 1; i < thread_num; ++i)
+	{
+		LIST_NODE<T>* begin = segments[(long long)i * segment_num / thread_num];
+		LIST_NODE<T>* end = (i + 1 == thread_num) ? segments[0] : segments[(long long)(i + 1) * segment_num / thread_num];
+		try
 		{
-			this->header.SetNextNode(this->slider);
+			workers.push_back(std::thread(TraverseSegment, begin, end, visit, &status[i]));
+		}
+		catch (...)
+		{
+			// 线程创建失败时在调用线程中完成这一组
+			TraverseSegment(begin, end, visit, &status[i]);
+			ret = -1;
 		}
 	}
+	TraverseSegment(segments[0], (thread_num == 1) ? segments[0] : segments[segment_num / thread_num], visit, &status[0]);
+	for (size_t i = 0; i < workers.size(); ++i)
+	{
+		workers[i].join();
+	}
 
-	// 释放删除结点空间
-	delete deleted_node;
-
-	// 链表长度减1
-	this->length --;
-
-	return 0;
+	for (int i = 0; i < thread_num; ++i)
+	{
+		if (status[i] != 0)
+		{
+			cout << "func LINK_LIST<T>::ParallelTraverse() err: func_status != 0" << endl;
+			return -1;
+		}
+	}
+	if (ret != 0)
+	{
+		cout << "func LINK_LIST<T>::ParallelTraverse() err: failed to start worker thread" << endl;
+	}
+	return ret;
 }
 
 
 
 /*
- * Function:		SetSlider()
- * Description:		如果链表中存在某个结点包含数据data，将游标指向第一个包含该数据的结点
- * Time complexity:	假设类T重载的==操作符时间复杂度为O(m)，则该函数时间复杂度为O(n*m)
+ * Function:		ParallelReduce()
+ * Description:		按分区标记把链表分成若干段并交给多个线程，每个线程从init的拷贝开始，对其中每个结点调用accumulate(acc, data)累积部分结果，
+ *					最后在调用线程中按链表顺序用combine(result, part)合并各部分结果，combine只需满足结合律。遍历期间不能修改链表，不改变游标
+ * Time complexity:	假设accumulate()的时间复杂度为O(t)，线程数为c，则本函数时间复杂度为O(n*t/c + c)，重建标记时另加O(n)
  * Input:
- *		data:		const T&类型，在链表中匹配该数据
+ *		init:		const R&类型，每个线程部分结果的初值，空表时即为结果
+ *		accumulate:	void (*)(R& acc, T& data)类型，把一个结点的数据累积到部分结果中
+ *		combine:	void (*)(R& result, const R& part)类型，把后一段的部分结果合并到前面的结果中
+ *		thread_num:	int类型，线程数（包括调用线程），不大于0时取std::thread::hardware_concurrency()
  * Output:
+ *		out_result:	R&类型，合并后的结果
  * Return:			int类型，操作成功返回0，操作失败返回负数
  */
 template <typename T>
-int LINK_LIST<T>::SetSlider(const T& data)
+template <typename R>
+int LINK_LIST<T>::ParallelReduce(const R& init, void (*accumulate)(R& acc, T& data), void (*combine)(R& result, const R& part), R& out_result, int thread_num)
 {
-	// 如果链表为空表，报错
-	if (this->length == 0)
+	if (accumulate == NULL || combine == NULL)
 	{
-		cout << "func LINK_LIST<T>::SetSlider() err: this->length == 0" << endl;
+		cout << "func LINK_LIST<T>::ParallelReduce() err: accumulate == NULL || combine == NULL" << endl;
 		return -1;
 	}
+	if (this->length == 0)
+	{
+		out_result = init;
+		return 0;
+	}
 
-	// 重置游标
-	this->ResetSlider();
+	std::vector<LIST_NODE<T>*> segments;
+	this->GetSegments(segments);
+	int segment_num = (int)segments.size();
+	if (thread_num <= 0)
+	{
+		thread_num = (int)std::thread::hardware_concurrency();
+	}
+	thread_num = (thread_num < 1) ? 1 : ((thread_num > segment_num) ? segment_num : thread_num);
 
-	// 遍历链表，查找第一个包含data的结点
-	int i = 0;
-	for (i = 0; i < this->length; ++i)
+	// 每组一个部分结果，分组方式与ParallelTraverse()相同
+	std::vector<R> parts(thread_num, init);
+	std::vector<std::thread> workers;
+	for (int i = 1; i < thread_num; ++i)
 	{
-		T current_node_data;								// 定义一个临时变量暂存游标指向结点的数据。调用类型T的构造函数。
-		this->slider->GetNodeData(current_node_data);		// 获取当前结点的数据
+		LIST_NODE<T>* begin = segments[(long long)i * segment_num / thread_num];
+		LIST_NODE<T>* end = (i + 1 == thread_num) ? segments[0] : segments[(long long)(i + 1) * segment_num / thread_num];
+		try
+		{
+			workers.push_back(std::thread(ReduceSegment<R>, begin, end, accumulate, &parts[i]));
+		}
+		catch (...)
+		{
+			ReduceSegment<R>(begin, end, accumulate, &parts[i]);
+		}
+	}
+	ReduceSegment<R>(segments[0], (thread_num == 1) ? segments[0] : segments[segment_num / thread_num], accumulate, &parts[0]);
+	for (size_t i = 0; i < workers.size(); ++i)
+	{
+		workers[i].join();
+	}
 
-		// 判断当前结点的数据是否等于data，如果是，跳出循环，游标指向第一个包含数据data的结点。调用类型T的重载==操作
-		if (data == current_node_data)						// 类T重载的==操作符
+	out_result = parts[0];
+	for (int i = 1; i < thread_num; ++i)
+	{
+		combine(out_result, parts[i]);
+	}
+	return 0;
+}
+
+
+
+/*
+ * Function:		DetachChain()
+ * Description:		把所有结点从头结点上摘下，断开首尾相连，得到以NULL结尾的结点链，连续结点块也一并交出，链表置为空表
+ * Time complexity:	O(1)，不复制连续结点块的记录
+ * Input:
+ * Output:
+ * Return:			LIST_CHAIN<T>类型，摘下的结点链和连续结点块
+ */
+template <typename T>
+LIST_CHAIN<T> LINK_LIST<T>::DetachChain()
+{
+	LIST_CHAIN<T> chain;
+	chain.first = this->header.GetNextNode();
+	chain.blocks.swap(this->blocks);
+	if (chain.first != NULL)
+	{
+		chain.first->GetPriorNode()->SetNextNode(NULL);		// 最后一个结点的后继置NULL
+	}
+
+	this->header.SetNextNode(NULL);
+	this->length = 0;
+	this->slider = NULL;
+
+	// 空表没有分区标记，间隔保持不变
+	this->partition_length = 0;
+	this->partition_deleted = 0;
+	this->partitions.clear();
+	this->partition_index.clear();
+	return chain;
+}
+
+
+
+/*
+ * Function:		DestroyChain()
+ * Description:		沿后继指针释放以NULL结尾的结点链，连续结点块中的结点只析构，最后释放各块
+ * Time complexity:	假设类T的析构函数时间复杂度是O(m)，连续结点块有b块，则该函数的时间复杂的为O(n*(m + log b))
+ * Input:
+ *		chain:		LIST_CHAIN<T>&类型，结点链和连续结点块
+ * Output:
+ * Return:
+ */
+template <typename T>
+void LINK_LIST<T>::DestroyChain(LIST_CHAIN<T>& chain)
+{
+	// 相邻结点通常在同一块中，先与上一次找到的块比较，不在其中再查找
+	typename std::map<LIST_NODE<T>*, LIST_BLOCK>::iterator last_block = chain.blocks.end();
+	LIST_NODE<T>* current_node = chain.first;
+	while (current_node != NULL)
+	{
+		LIST_NODE<T>* next_node = current_node->GetNextNode();
+		bool in_block = false;
+		if (!chain.blocks.empty())
 		{
-			break;
+			if (last_block == chain.blocks.end() || std::less<LIST_NODE<T>*>()(current_node, last_block->first)
+				|| !std::less<LIST_NODE<T>*>()(current_node, last_block->first + last_block->second.size))
+			{
+				typename std::map<LIST_NODE<T>*, LIST_BLOCK>::iterator it = FindBlock(chain.blocks, current_node);
+				if (it != chain.blocks.end())
+				{
+					last_block = it;
+				}
+				in_block = (it != chain.blocks.end());
+			}
+			else
+			{
+				in_block = true;
+			}
 		}
-		
-		// 游标指向其后继结点
-		this->slider = this->slider->GetNextNode();
+		if (in_block)
+		{
+			current_node->~LIST_NODE<T>();
+		}
+		else
+		{
+			delete current_node;
+		}
+		current_node = next_node;
 	}
 
-	// 如果没有找到，报错
-	if (i >= this->length)
+	for (typename std::map<LIST_NODE<T>*, LIST_BLOCK>::iterator it = chain.blocks.begin(); it != chain.blocks.end(); ++it)
 	{
-		cout << " func LINK_LIST<T>::SetSlider() err: i >= this->length" << endl;
-		return -2;
+		::operator delete(it->first);
 	}
+	chain.blocks.clear();
+}
 
-	return 0;
+
+
+/*
+ * Function:		DestroyDeferredChain()
+ * Description:		交给LIST_RECLAIMER的释放函数，释放结点链后再释放new出来的LIST_CHAIN<T>
+ * Time complexity:	与DestroyChain()相同
+ * Input:
+ *		chain:		void*类型，new出来的LIST_CHAIN<T>的地址
+ * Output:
+ * Return:
+ */
+template <typename T>
+void LINK_LIST<T>::DestroyDeferredChain(void* chain)
+{
+	LIST_CHAIN<T>* deferred_chain = (LIST_CHAIN<T>*)chain;
+	DestroyChain(*deferred_chain);
+	delete deferred_chain;
 }
 
 
 
 /*
- * Function:		Traverse()
- * Description:		遍历链表，每个结点的数据data作为参数，调用函数visit()
- * Time complexity:	假设类T重载的赋值操作符时间复杂度为O(m)，visit()的时间复杂度为O(t)，则本函数时间复杂度为O(n*m + n*t)
+ * Function:		FreeNode()
+ * Description:		释放一个已经从链表上摘下的结点，连续结点块中的结点只析构，块中结点全部释放后释放整块
+ * Time complexity:	与类T的析构函数时间复杂度相同，另需O(log b)查找结点所在的块，b为连续结点块数
  * Input:
- *		visit:		int (*)(T& data)类型，函数指针，以类T的引用为参数
+ *		node:		LIST_NODE<T>*类型，要释放的结点
  * Output:
- * Return:			int类型，操作成功返回0，操作失败返回负数
+ * Return:
  */
 template <typename T>
-int LINK_LIST<T>::Traverse(int (*visit)(T& data))
+void LINK_LIST<T>::FreeNode(LIST_NODE<T>* node)
 {
-	// 如果链表为空表，直接退出
-	if (this->length == 0)
+	typename std::map<LIST_NODE<T>*, LIST_BLOCK>::iterator it = this->blocks.empty() ? this->blocks.end() : FindBlock(this->blocks, node);
+	if (it == this->blocks.end())
+	{
+		delete node;
+		return;
+	}
+
+	node->~LIST_NODE<T>();
+	it->second.live --;
+	if (it->second.live == 0)
+	{
+		::operator delete(it->first);
+		this->blocks.erase(it);
+	}
+}
+
+
+
+/*
+ * Function:		FindBlock()
+ * Description:		查找结点所在的连续结点块
+ * Time complexity:	O(log b)，b为连续结点块数
+ * Input:
+ *		blocks:		std::map<LIST_NODE<T>*, LIST_BLOCK>&类型，连续结点块
+ *		node:		LIST_NODE<T>*类型，结点
+ * Output:
+ * Return:			迭代器类型，结点在某个块中时指向该块，否则为blocks.end()
+ */
+template <typename T>
+typename std::map<LIST_NODE<T>*, LIST_BLOCK>::iterator LINK_LIST<T>::FindBlock(std::map<LIST_NODE<T>*, LIST_BLOCK>& blocks, LIST_NODE<T>* node)
+{
+	// 起始地址不大于node的最后一块
+	typename std::map<LIST_NODE<T>*, LIST_BLOCK>::iterator it = blocks.upper_bound(node);
+	if (it == blocks.begin())
+	{
+		return blocks.end();
+	}
+	--it;
+	if (std::less<LIST_NODE<T>*>()(node, it->first + it->second.size))
+	{
+		return it;
+	}
+	return blocks.end();
+}
+
+
+
+/*
+ * Function:		BuildRange()
+ * Description:		把[first, last)中的数据拷贝构造到一块新申请的连续内存中，在链表外串成以first_node开始、last_node结束的结点链并记录该块，不修改链表
+ * Time complexity:	假设类T的拷贝构造函数时间复杂度为O(m)，插入k个数据，则本函数时间复杂度为O(k*m)
+ * Input:
+ *		first:		ITER类型，输入迭代器范围的开始
+ *		last:		ITER类型，输入迭代器范围的结束
+ * Output:
+ *		first_node:	LIST_NODE<T>*&类型，结点链的第一个结点
+ *		last_node:	LIST_NODE<T>*&类型，结点链的最后一个结点
+ * Return:			int类型，操作成功返回结点数，范围为空返回0，操作失败返回负数
+ */
+template <typename T>
+template <typename ITER>
+int LINK_LIST<T>::BuildRange(ITER first, ITER last, LIST_NODE<T>*& first_node, LIST_NODE<T>*& last_node)
+{
+	// 先数出结点数，一次申请整块
+	int count = 0;
+	for (ITER it = first; it != last; ++it)
+	{
+		count ++;
+	}
+	if (count == 0)
 	{
 		return 0;
 	}
 
-	// 链表不为空的情况下
-	// 重置游标
-	this->ResetSlider();
+	LIST_NODE<T>* new_block = (LIST_NODE<T>*)::operator new(sizeof(LIST_NODE<T>) * count, std::nothrow);
+	if (new_block == NULL)
+	{
+		cout << "func LINK_LIST<T>::BuildRange() err: new_block == NULL" << endl;
+		return -1;
+	}
 
-	// 遍历链表
-	for (int i = 0; i < this->length; ++i)
+	// 逐个拷贝构造，相邻结点在内存中也相邻
+	int i = 0;
+	for (ITER it = first; it != last; ++it, ++i)
 	{
-		T current_node_data;								// 用来暂存当前结点的数据
-		this->slider->GetNodeData(current_node_data);
+		new (&new_block[i]) LIST_NODE<T>(*it);
+		new_block[i].SetPriorNode((i == 0) ? NULL : &new_block[i - 1]);
+		new_block[i].SetNextNode((i == count - 1) ? NULL : &new_block[i + 1]);
+	}
 
-		// 结点数据作为参数，调用visit()，并用func_status监控visit()运行情况
-		int func_status = visit(current_node_data);
-		if (func_status != 0)
+	LIST_BLOCK& block = this->blocks[new_block];
+	block.size = count;
+	block.live = count;
+	first_node = &new_block[0];
+	last_node = &new_block[count - 1];
+	return count;
+}
+
+
+
+/*
+ * Function:		RebuildPartitions()
+ * Description:		从第一个结点开始每隔partition_step个结点标记一个结点，重新生成分区标记
+ * Time complexity:	O(n)
+ * Input:
+ * Output:
+ * Return:
+ */
+template <typename T>
+void LINK_LIST<T>::RebuildPartitions()
+{
+	this->partitions.clear();
+	this->partition_index.clear();
+	this->partition_length = this->length;
+	this->partition_deleted = 0;
+	if (this->length == 0)
+	{
+		return;
+	}
+
+	// 第一段从第一个结点开始，不需要标记
+	this->partitions.reserve(this->length / this->partition_step);
+	this->partition_index.reserve(this->length / this->partition_step);
+	LIST_NODE<T>* current_node = this->header.GetNextNode();
+	for (int i = 0; i < this->length; ++i)
+	{
+		if (i > 0 && i % this->partition_step == 0)
 		{
-			cout << "func LINK_LIST<T>::Traverse() err: func_status != 0" << endl;
-			return -1;
+			this->partition_index[current_node] = (int)this->partitions.size();
+			this->partitions.push_back(current_node);
 		}
+		current_node = current_node->GetNextNode();
+	}
+}
 
-		// 游标指向其后继结点
-		this->slider = this->slider->GetNextNode();
+
+
+/*
+ * Function:		UnmarkNode()
+ * Description:		在结点从链表上摘下之前调用：记录一次删除，结点是分区标记时把标记移到其后继结点，后继是第一个结点或已经是标记时把该标记置NULL
+ * Time complexity:	O(1)
+ * Input:
+ *		node:		LIST_NODE<T>*类型，将要删除的结点
+ * Output:
+ * Return:
+ */
+template <typename T>
+void LINK_LIST<T>::UnmarkNode(LIST_NODE<T>* node)
+{
+	if (this->partition_step == 0)
+	{
+		return;
 	}
-	return 0;
+
+	this->partition_deleted ++;
+	typename std::unordered_map<LIST_NODE<T>*, int>::iterator it = this->partition_index.find(node);
+	if (it == this->partition_index.end())
+	{
+		return;
+	}
+
+	// 后继结点在本段之内，标记后移一个结点，段的划分仍按链表顺序
+	int index = it->second;
+	LIST_NODE<T>* next_node = node->GetNextNode();
+	this->partition_index.erase(it);
+	if (next_node != this->header.GetNextNode() && this->partition_index.find(next_node) == this->partition_index.end())
+	{
+		this->partitions[index] = next_node;
+		this->partition_index[next_node] = index;
+	}
+	else
+	{
+		this->partitions[index] = NULL;
+	}
+}
+
+
+
+/*
+ * Function:		GetSegments()
+ * Description:		必要时重建分区标记，然后把各段的第一个结点按链表顺序放入segments，第一段从链表的第一个结点开始，最后一段到表尾结束
+ * Time complexity:	O(p)，p为标记数，重建标记时另加O(n)
+ * Input:
+ * Output:
+ *		segments:	std::vector<LIST_NODE<T>*>&类型，各段的第一个结点
+ * Return:
+ */
+template <typename T>
+void LINK_LIST<T>::GetSegments(std::vector<LIST_NODE<T>*>& segments)
+{
+	LIST_NODE<T>* first_node = this->header.GetNextNode();
+	segments.clear();
+	segments.push_back(first_node);
+	if (this->partition_step == 0)
+	{
+		return;
+	}
+
+	// 插入的结点数为length - partition_length + partition_deleted，与删除的结点数之和超过重建时长度的一半就重建，各段长度保持在间隔的常数倍之内
+	long long changed = (long long)this->length - this->partition_length + 2LL * this->partition_deleted;
+	if (changed > this->partition_length / 2 + this->partition_step)
+	{
+		this->RebuildPartitions();
+	}
+
+	segments.reserve(this->partitions.size() + 1);
+	for (size_t i = 0; i < this->partitions.size(); ++i)
+	{
+		// 删除第一个结点之后，原来的第一个标记可能变成第一个结点
+		if (this->partitions[i] != NULL && this->partitions[i] != first_node)
+		{
+			segments.push_back(this->partitions[i]);
+		}
+	}
+}
+
+
+
+/*
+ * Function:		TraverseSegment()
+ * Description:		以[begin, end)中每个结点的数据为参数调用visit()，begin等于end时遍历整个环，线程入口函数
+ * Time complexity:	假设visit()的时间复杂度为O(t)，段长为k，则本函数时间复杂度为O(k*t)
+ * Input:
+ *		begin:		LIST_NODE<T>*类型，段的第一个结点
+ *		end:		LIST_NODE<T>*类型，下一段的第一个结点
+ *		visit:		int (*)(T& data)类型，函数指针
+ * Output:
+ *		status:		int*类型，全部返回0时置0，否则置-1
+ * Return:
+ */
+template <typename T>
+void LINK_LIST<T>::TraverseSegment(LIST_NODE<T>* begin, LIST_NODE<T>* end, int (*visit)(T& data), int* status)
+{
+	*status = 0;
+	LIST_NODE<T>* current_node = begin;
+	do
+	{
+		if (visit(current_node->GetDataRef()) != 0)
+		{
+			*status = -1;
+			return;
+		}
+		current_node = current_node->GetNextNode();
+	} while (current_node != end);
+}
+
+
+
+/*
+ * Function:		ReduceSegment()
+ * Description:		对[begin, end)中每个结点的数据调用accumulate(*acc, data)，begin等于end时遍历整个环，线程入口函数
+ * Time complexity:	假设accumulate()的时间复杂度为O(t)，段长为k，则本函数时间复杂度为O(k*t)
+ * Input:
+ *		begin:		LIST_NODE<T>*类型，段的第一个结点
+ *		end:		LIST_NODE<T>*类型，下一段的第一个结点
+ *		accumulate:	void (*)(R& acc, T& data)类型，函数指针
+ * Output:
+ *		acc:		R*类型，部分结果，调用前已置初值
+ * Return:
+ */
+template <typename T>
+template <typename R>
+void LINK_LIST<T>::ReduceSegment(LIST_NODE<T>* begin, LIST_NODE<T>* end, void (*accumulate)(R& acc, T& data), R* acc)
+{
+	LIST_NODE<T>* current_node = begin;
+	do
+	{
+		accumulate(*acc, current_node->GetDataRef());
+		current_node = current_node->GetNextNode();
+	} while (current_node != end);
 }
@@ -4,11 +4,35 @@
  * Date:	2021.11.13
  * Description:	C++线性表链式存储（双向循环链表）的头文件，该文件包含了模板类LIST_NODE和LINK_LIST的声明，其实现包含在文件link_list.cpp中。
  * History:	1. 2021.11.13 创建并完成初始版本
+ *			2. 2026.10.19 增加与游标相互独立的双向迭代器LIST_ITERATOR，支持范围for循环和<algorithm>
+ *			3. 2026.10.19 Clear()改为一次线性遍历释放所有结点；增加ClearDeferred()，由后台回收线程LIST_RECLAIMER释放结点
+ *			4. 2026.10.19 增加带软件预取的遍历TraversePrefetch()和多链表交错查找SetSliderBatch()
+ *			5. 2026.10.19 增加Compact()，按链表顺序把所有结点重新放入一块连续内存
+ *			6. 2026.10.19 增加InsertRangeBeforeSlider()和InsertRangeAfterSlider()，一批结点放在一块连续内存中一次接入链表；连续结点块改为按地址记录多块
+ *			7. 2026.10.19 增加可选的分区标记，以及按分区多线程遍历的ParallelTraverse()和ParallelReduce()
+ *			8. 2026.10.19 增加从游标出发双向查找插入位置的有序插入InsertSorted()，以及一次扫描合并有序数据的MergeSorted()
+ *			9. 2026.10.19 LIST_ITERATOR显式声明默认的赋值操作符，消除-Wdeprecated-copy警告
  ****************************************************************************************************************************/
 
 #ifndef _LINK_LIST_H_
 #define _LINK_LIST_H_
 
+#include <cstddef>
+#include <iterator>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#define LINK_LIST_PREFETCH_DISTANCE		4			// 带预取的遍历中，预取指针领先当前结点的结点数
+#define LINK_LIST_BATCH_MAX				64			// SetSliderBatch()中同时交错进行的查找数
+
+template <typename T> class LINK_LIST;
+
 /****************************************************************** LIST_NODE类型，双向循环链表中的结点 ****************************************************************/
 template <typename T>
 class LIST_NODE{
@@ -95,6 +119,26 @@ public:
 	 */
 	int GetNodeData(T& out_data) const;
 
+	/*
+	 * Function:		GetDataRef()
+	 * Description:		获取该结点数据域的引用，供迭代器直接访问数据，不拷贝数据
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			T&类型，结点数据域的引用
+	 */
+	T& GetDataRef();
+
+	/*
+	 * Function:		GetDataRef()
+	 * Description:		获取该结点数据域的常引用
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			const T&类型，结点数据域的常引用
+	 */
+	const T& GetDataRef() const;
+
 	/*
 	 * Function:		GetNextNode()
 	 * Description:		获取该结点的后继结点的地址
@@ -118,13 +162,263 @@ public:
 
 
 
+/****************************************************************** LIST_ITERATOR类型，双向循环链表的双向迭代器 ****************************************************************/
+/* REF、PTR为T&、T*时是可修改的迭代器，为const T&、const T*时是只读迭代器。迭代器不使用链表的游标，多个迭代器可以同时存在。
+ * 链表的结点首尾相连，因此用NULL结点表示end()。插入结点不会使迭代器失效，删除结点只会使指向被删除结点的迭代器失效。 */
+template <typename T, typename REF, typename PTR>
+class LIST_ITERATOR{
+public:
+	typedef std::bidirectional_iterator_tag		iterator_category;
+	typedef T									value_type;
+	typedef std::ptrdiff_t						difference_type;
+	typedef PTR									pointer;
+	typedef REF									reference;
+
+private:
+	LIST_NODE<T>*			node;				// 迭代器指向的结点，NULL表示end()
+	const LINK_LIST<T>*		list;				// 迭代器所属的链表，用来判断首尾
+
+public:
+	/*
+	 * Function:		LIST_ITERATOR()
+	 * Description:		LIST_ITERATOR类的无参构造函数，构造一个不属于任何链表的迭代器
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:
+	 */
+	LIST_ITERATOR();
+
+	/*
+	 * Function:		LIST_ITERATOR()
+	 * Description:		LIST_ITERATOR类的有参构造函数
+	 * Time complexity:	O(1)
+	 * Input:
+	 *		my_node:	LIST_NODE<T>*类型，迭代器指向的结点，NULL表示end()
+	 *		my_list:	const LINK_LIST<T>*类型，迭代器所属的链表
+	 * Output:
+	 * Return:
+	 */
+	LIST_ITERATOR(LIST_NODE<T>* my_node, const LINK_LIST<T>* my_list);
+
+	/*
+	 * Function:		LIST_ITERATOR()
+	 * Description:		从可修改的迭代器构造，用于iterator到const_iterator的转换
+	 * Time complexity:	O(1)
+	 * Input:
+	 *		list_iterator:	const LIST_ITERATOR<T, T&, T*>&类型，可修改的迭代器
+	 * Output:
+	 * Return:
+	 */
+	LIST_ITERATOR(const LIST_ITERATOR<T, T&, T*>& list_iterator);
+
+	/*
+	 * Function:		operator=()
+	 * Description:		赋值操作符，逐个成员赋值。可修改的迭代器中上面的构造函数就是拷贝构造函数，需要显式声明赋值操作符
+	 * Time complexity:	O(1)
+	 * Input:
+	 *		list_iterator:	const LIST_ITERATOR&类型，赋值的迭代器
+	 * Output:
+	 * Return:			LIST_ITERATOR&类型，自身的引用
+	 */
+	LIST_ITERATOR& operator=(const LIST_ITERATOR& list_iterator) = default;
+
+public:
+	/*
+	 * Function:		operator*()
+	 * Description:		获取迭代器指向的结点数据的引用
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			REF类型，结点数据的引用
+	 */
+	REF operator*() const;
+
+	/*
+	 * Function:		operator->()
+	 * Description:		获取迭代器指向的结点数据的地址
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			PTR类型，结点数据的地址
+	 */
+	PTR operator->() const;
+
+	/*
+	 * Function:		operator++()
+	 * Description:		迭代器指向其后继结点，最后一个结点的后继为end()
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			LIST_ITERATOR&类型，移动之后的迭代器
+	 */
+	LIST_ITERATOR& operator++();
+
+	/*
+	 * Function:		operator++(int)
+	 * Description:		迭代器指向其后继结点，返回移动之前的迭代器
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			LIST_ITERATOR类型，移动之前的迭代器
+	 */
+	LIST_ITERATOR operator++(int);
+
+	/*
+	 * Function:		operator--()
+	 * Description:		迭代器指向其前驱结点，end()的前驱为最后一个结点
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			LIST_ITERATOR&类型，移动之后的迭代器
+	 */
+	LIST_ITERATOR& operator--();
+
+	/*
+	 * Function:		operator--(int)
+	 * Description:		迭代器指向其前驱结点，返回移动之前的迭代器
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			LIST_ITERATOR类型，移动之前的迭代器
+	 */
+	LIST_ITERATOR operator--(int);
+
+	/*
+	 * Function:		operator==()
+	 * Description:		判断两个迭代器是否指向同一个结点
+	 * Time complexity:	O(1)
+	 * Input:
+	 *		list_iterator:	const LIST_ITERATOR&类型，比较的迭代器
+	 * Output:
+	 * Return:			bool类型，指向同一个结点返回true，否则返回false
+	 */
+	bool operator==(const LIST_ITERATOR& list_iterator) const;
+
+	/*
+	 * Function:		operator!=()
+	 * Description:		判断两个迭代器是否指向不同的结点
+	 * Time complexity:	O(1)
+	 * Input:
+	 *		list_iterator:	const LIST_ITERATOR&类型，比较的迭代器
+	 * Output:
+	 * Return:			bool类型，指向不同的结点返回true，否则返回false
+	 */
+	bool operator!=(const LIST_ITERATOR& list_iterator) const;
+
+	/*
+	 * Function:		GetNode()
+	 * Description:		获取迭代器指向的结点的地址
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			LIST_NODE<T>*类型，迭代器指向的结点的地址，end()返回NULL
+	 */
+	LIST_NODE<T>* GetNode() const;
+
+	/*
+	 * Function:		GetList()
+	 * Description:		获取迭代器所属的链表的地址
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			const LINK_LIST<T>*类型，迭代器所属的链表的地址
+	 */
+	const LINK_LIST<T>* GetList() const;
+};
+
+
+
+/****************************************************************** LIST_RECLAIMER类型，后台回收线程 ****************************************************************/
+/* 所有链表共用一个后台回收线程，第一次提交任务时启动，程序退出时处理完剩余任务后结束。
+ * 任务是一条已经从链表上摘下的结点链和释放它的函数，由回收线程调用，所以类T的析构函数不能依赖调用线程的状态。 */
+class LIST_RECLAIMER{
+private:
+	typedef void (*DESTROY_FUNC)(void* chain);
+
+	std::mutex										task_mutex;		// 保护以下成员
+	std::condition_variable							task_cond;		// 有新任务、任务全部完成或要求退出时通知
+	std::deque<std::pair<void*, DESTROY_FUNC> >		tasks;			// 待释放的结点链及其释放函数
+	int												busy;			// 回收线程正在处理的任务数
+	bool											stopping;		// 是否要求回收线程退出
+	std::thread										worker;			// 回收线程
+
+public:
+	/*
+	 * Function:		Submit()
+	 * Description:		提交一条待释放的结点链，立即返回。回收线程无法启动时在当前线程直接释放
+	 * Time complexity:	O(1)
+	 * Input:
+	 *		chain:		void*类型，结点链的第一个结点
+	 *		destroy:	void (*)(void* chain)类型，释放整条结点链的函数
+	 * Output:
+	 * Return:			int类型，交给回收线程返回0，在当前线程直接释放返回1
+	 */
+	static int Submit(void* chain, void (*destroy)(void* chain));
+
+	/*
+	 * Function:		WaitIdle()
+	 * Description:		等待已提交的任务全部完成
+	 * Time complexity:	与已提交任务的释放时间相同
+	 * Input:
+	 * Output:
+	 * Return:
+	 */
+	static void WaitIdle();
+
+private:
+	LIST_RECLAIMER();
+	~LIST_RECLAIMER();
+	LIST_RECLAIMER(const LIST_RECLAIMER&);				// 禁止拷贝
+	LIST_RECLAIMER& operator=(const LIST_RECLAIMER&);
+
+	/* 获取唯一的回收器对象 */
+	static LIST_RECLAIMER& Instance();
+
+	/* 回收线程的主循环 */
+	void Run();
+};
+
+
+
+/* 连续结点块的使用情况，块的起始地址作为std::map的键，见LINK_LIST::Compact()和InsertRangeAfterSlider() */
+struct LIST_BLOCK{
+	int		size;						// 块中的结点数
+	int		live;						// 块中仍在链表上的结点数，降为0时释放整块
+};
+
+
+
+/* 从链表上摘下的以NULL结尾的结点链，以及链表当前使用的全部连续结点块 */
+template <typename T>
+struct LIST_CHAIN{
+	LIST_NODE<T>*						first;			// 结点链的第一个结点，空链为NULL
+	std::map<LIST_NODE<T>*, LIST_BLOCK>	blocks;			// 连续结点块，键为块的起始地址
+};
+
+
+
 /****************************************************************** LINK_LIST类型，双向循环链表 ****************************************************************/
 template <typename T>
 class LINK_LIST{
+	template <typename, typename, typename> friend class LIST_ITERATOR;
+
+public:
+	typedef LIST_ITERATOR<T, T&, T*>					iterator;
+	typedef LIST_ITERATOR<T, const T&, const T*>		const_iterator;
+	typedef std::reverse_iterator<iterator>				reverse_iterator;
+	typedef std::reverse_iterator<const_iterator>		const_reverse_iterator;
+
 private:
 	LIST_NODE<T>	header;				// 头结点，数据域置0，前驱指针指向自己，后继指针指向链表第一个结点
 	int				length;				// 链表长度
 	LIST_NODE<T>*	slider;				// 游标，用来辅助定位
+	std::map<LIST_NODE<T>*, LIST_BLOCK>	blocks;		// Compact()和InsertRange*Slider()申请的连续结点块，块内结点不能单独delete，键为块的起始地址
+	int									partition_step;		// 分区标记的间隔，0表示不维护分区标记
+	int									partition_length;	// 上次重建分区标记时的链表长度
+	int									partition_deleted;	// 上次重建分区标记之后删除的结点数
+	std::vector<LIST_NODE<T>*>			partitions;			// 分区标记，按链表顺序排列，每个标记是一个分区的第一个结点，被删除且不能后移的标记置NULL
+	std::unordered_map<LIST_NODE<T>*, int>	partition_index;	// 标记结点到其在partitions中下标的映射
 
 public:
 	/*
@@ -140,7 +434,7 @@ public:
 	/*
 	 * Function:		~LINK_LIST()
 	 * Description:		LINK_LIST类的析构函数，调用Clear()清空链表结点
-	 * Time complexity:	
+	 * Time complexity:	与Clear()相同
 	 * Input:
 	 * Output:
 	 * Return:
@@ -150,14 +444,25 @@ public:
 public:
 	/*
 	 * Function:		Clear()
-	 * Description:		调用DeleteSlider()逐个删除结点，将链表置为空表
-	 * Time complexity:	假设类T的时间复杂度是O(m)，则该函数的时间复杂的为O(n*m)
+	 * Description:		将链表置为空表，先把所有结点从头结点上摘下，再沿后继指针一次遍历释放，不拷贝数据也不逐个修改前驱后继
+	 * Time complexity:	假设类T的析构函数时间复杂度是O(m)，则该函数的时间复杂的为O(n*m)
 	 * Input:
 	 * Output:
 	 * Return:			int类型，操作成功返回0，操作失败返回负数
 	 */
 	int Clear();
 
+	/*
+	 * Function:		ClearDeferred()
+	 * Description:		将链表置为空表，摘下的结点链交给后台回收线程LIST_RECLAIMER释放，本函数立即返回。
+	 *					结点中的数据在回收线程中析构，调用者不能再持有指向这些数据的引用或迭代器
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int ClearDeferred();
+
 	/*
 	 * Function:		GetLength()
 	 * Description:		获取链表长度
@@ -243,6 +548,67 @@ public:
 	 */
 	int InsertAfterSlider(const T& data);
 
+	/*
+	 * Function:		InsertRangeBeforeSlider()
+	 * Description:		在游标指向的结点前面按顺序插入[first, last)中的数据，游标指向插入的第一个结点，结果与按逆序逐个调用InsertBeforeSlider()相同。
+	 *					所有结点一次申请在一块连续内存中，先在链表外串好，再一次接入链表，length和游标只更新一次
+	 * Time complexity:	假设类T的拷贝构造函数时间复杂度为O(m)，插入k个数据，则本函数时间复杂度为O(k*m)
+	 * Input:
+	 *		first:		ITER类型，输入迭代器范围的开始，至少是前向迭代器，范围要遍历两次
+	 *		last:		ITER类型，输入迭代器范围的结束
+	 * Output:
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	template <typename ITER>
+	int InsertRangeBeforeSlider(ITER first, ITER last);
+
+	/*
+	 * Function:		InsertRangeAfterSlider()
+	 * Description:		在游标指向的结点后面按顺序插入[first, last)中的数据，游标指向插入的最后一个结点，结果与按顺序逐个调用InsertAfterSlider()相同。
+	 *					所有结点一次申请在一块连续内存中，先在链表外串好，再一次接入链表，length和游标只更新一次
+	 * Time complexity:	假设类T的拷贝构造函数时间复杂度为O(m)，插入k个数据，则本函数时间复杂度为O(k*m)
+	 * Input:
+	 *		first:		ITER类型，输入迭代器范围的开始，至少是前向迭代器，范围要遍历两次
+	 *		last:		ITER类型，输入迭代器范围的结束
+	 * Output:
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	template <typename ITER>
+	int InsertRangeAfterSlider(ITER first, ITER last);
+
+	/*
+	 * Function:		InsertSorted()
+	 * Description:		链表按less升序排列时，插入data并保持有序，相等的数据插入到已有数据之后，游标指向插入的结点。
+	 *					插入位置从游标出发向前或向后查找（指针查找，finger search），比表头和表尾更远时直接插入到两端，
+	 *					连续插入的数据相近时每次只需走过两次插入位置之间的结点
+	 * Time complexity:	O(d)，d为游标与插入位置之间的结点数，与类T的拷贝构造函数时间复杂度相同
+	 * Input:
+	 *		data:		const T&类型，插入的数据
+	 *		less:		COMPARE类型，比较函数或函数对象，less(a, b)为true表示a排在b前面，默认为std::less<T>
+	 * Output:
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	template <typename COMPARE>
+	int InsertSorted(const T& data, COMPARE less);
+	int InsertSorted(const T& data);
+
+	/*
+	 * Function:		MergeSorted()
+	 * Description:		链表按less升序排列时，把按less升序排列的[first, last)合并到链表中。第一个数据用InsertSorted()从游标出发定位，
+	 *					之后的数据只从上一个插入的结点向后查找，整批数据一次扫描完成，游标指向最后插入的结点。[first, last)不是升序时不插入任何数据
+	 * Time complexity:	O(d + k)，k为插入的数据个数，d为第一个插入位置与游标的距离加上插入位置之间跨过的结点数
+	 * Input:
+	 *		first:		ITER类型，输入迭代器范围的开始，至少是前向迭代器，范围要遍历两次
+	 *		last:		ITER类型，输入迭代器范围的结束
+	 *		less:		COMPARE类型，比较函数或函数对象，默认为std::less<T>
+	 * Output:
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	template <typename ITER, typename COMPARE>
+	int MergeSorted(ITER first, ITER last, COMPARE less);
+	template <typename ITER>
+	int MergeSorted(ITER first, ITER last);
+
 	/*
 	 * Function:			DeleteSlider()
 	 * Description:			删除游标指向的结点，获取删除结点的数据，游标指向删除结点的后继结点。如果删除的是第一个结点，被删除结点的后继结点将会变成第一个结点。如果删除之后链表变为空表，游标置NULL
@@ -267,7 +633,7 @@ public:
 
 	/*
 	 * Function:		Traverse()
-	 * Description:		遍历链表，每个结点的数据data作为参数，调用函数visit()
+	 * Description:		遍历链表，每个结点的数据data作为参数，调用函数visit()，不改变游标
 	 * Time complexity:	假设类T重载的赋值操作符时间复杂度为O(m)，visit()的时间复杂度为O(t)，则本函数时间复杂度为O(n*m + n*t)
 	 * Input:
 	 *		visit:		int (*)(T& data)类型，函数指针，以类T的引用为参数
@@ -275,5 +641,353 @@ public:
 	 * Return:			int类型，操作成功返回0，操作失败返回负数
 	 */
 	int Traverse(int (*visit)(T& data));
+
+	/*
+	 * Function:		TraversePrefetch()
+	 * Description:		与Traverse()相同，但另有一个预取指针领先当前结点LINK_LIST_PREFETCH_DISTANCE个结点并预取其后继结点，
+	 *					使访存延迟与visit()的执行重叠。结点在内存中分散、visit()耗时与一次缓存缺失相当时效果明显
+	 * Time complexity:	与Traverse()相同
+	 * Input:
+	 *		visit:		int (*)(T& data)类型，函数指针，以类T的引用为参数
+	 * Output:
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int TraversePrefetch(int (*visit)(T& data));
+
+	/*
+	 * Function:		SetSliderBatch()
+	 * Description:		对count个链表分别执行SetSlider()，在lists[i]中查找datas[i]。各链表的查找交错进行，
+	 *					每轮每个链表前进一个结点并预取下一个结点，多个链表的访存延迟相互重叠。找不到时不输出错误信息
+	 * Time complexity:	假设类T重载的==操作符时间复杂度为O(m)，则本函数时间复杂度为O((n1 + n2 + ... + ncount)*m)
+	 * Input:
+	 *		lists:		LINK_LIST<T>*[]类型，count个链表的地址，可以重复
+	 *		datas:		const T[]类型，在每个链表中查找的数据
+	 *		count:		int类型，链表个数
+	 * Output:
+	 *		results:	int[]类型，results[i]为第i个查找的结果：找到并移动了游标为0，没有找到为-2，参数错误为-1
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	static int SetSliderBatch(LINK_LIST<T>* lists[], const T datas[], int count, int results[]);
+
+	/*
+	 * Function:		Compact()
+	 * Description:		按链表顺序把所有结点的数据移动到一块新申请的连续内存中，并释放原来的结点，头结点和游标随之更新，游标仍指向原来的数据。
+	 *					之后顺序遍历依次访问相邻的内存。之后插入的结点仍单独申请；块内的结点被删除时只析构，整块在其中的结点全部删除后释放。
+	 *					所有迭代器失效。类T需要有无参构造函数和赋值操作符，C++11之后优先使用移动赋值
+	 * Time complexity:	假设类T的赋值操作符时间复杂度为O(m)，则本函数时间复杂度为O(n*m)
+	 * Input:
+	 * Output:
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int Compact();
+
+	/*
+	 * Function:		EnablePartitions()
+	 * Description:		开始维护分区标记：每隔step个结点标记一个结点，把链表分成若干段供ParallelTraverse()和ParallelReduce()分给多个线程。
+	 *					插入结点不影响已有的标记；删除标记结点时标记移到其后继结点；插入删除的结点数超过重建时长度的一半后，下一次并行遍历前重建标记
+	 * Time complexity:	O(n)
+	 * Input:
+	 *		step:		int类型，标记间隔，大于0
+	 * Output:
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int EnablePartitions(int step);
+
+	/*
+	 * Function:		DisablePartitions()
+	 * Description:		停止维护分区标记并释放标记占用的内存，之后ParallelTraverse()和ParallelReduce()在调用线程中顺序执行
+	 * Time complexity:	O(p)，p为标记数
+	 * Input:
+	 * Output:
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int DisablePartitions();
+
+	/*
+	 * Function:		ParallelTraverse()
+	 * Description:		按分区标记把链表分成若干段，连续的几段交给同一个线程，各线程同时以每个结点的数据为参数调用visit()，不改变游标。
+	 *					visit()会被多个线程同时调用，对共享数据的访问需要调用者自己同步；遍历期间不能修改链表。没有分区标记时在调用线程中顺序遍历
+	 * Time complexity:	假设visit()的时间复杂度为O(t)，线程数为c，则本函数时间复杂度为O(n*t/c + c)，重建标记时另加O(n)
+	 * Input:
+	 *		visit:		int (*)(T& data)类型，函数指针，以类T的引用为参数
+	 *		thread_num:	int类型，线程数（包括调用线程），不大于0时取std::thread::hardware_concurrency()
+	 * Output:
+	 * Return:			int类型，操作成功返回0，某次visit()返回非0或线程创建失败返回负数
+	 */
+	int ParallelTraverse(int (*visit)(T& data), int thread_num);
+
+	/*
+	 * Function:		ParallelReduce()
+	 * Description:		按分区标记把链表分成若干段并交给多个线程，每个线程从init的拷贝开始，对其中每个结点调用accumulate(acc, data)累积部分结果，
+	 *					最后在调用线程中按链表顺序用combine(result, part)合并各部分结果，combine只需满足结合律。遍历期间不能修改链表，不改变游标
+	 * Time complexity:	假设accumulate()的时间复杂度为O(t)，线程数为c，则本函数时间复杂度为O(n*t/c + c)，重建标记时另加O(n)
+	 * Input:
+	 *		init:		const R&类型，每个线程部分结果的初值，空表时即为结果
+	 *		accumulate:	void (*)(R& acc, T& data)类型，把一个结点的数据累积到部分结果中
+	 *		combine:	void (*)(R& result, const R& part)类型，把后一段的部分结果合并到前面的结果中
+	 *		thread_num:	int类型，线程数（包括调用线程），不大于0时取std::thread::hardware_concurrency()
+	 * Output:
+	 *		out_result:	R&类型，合并后的结果
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	template <typename R>
+	int ParallelReduce(const R& init, void (*accumulate)(R& acc, T& data), void (*combine)(R& result, const R& part), R& out_result, int thread_num);
+
+public:
+	/*
+	 * Function:		begin()
+	 * Description:		获取指向第一个结点的迭代器，空表时等于end()，不改变游标
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			iterator类型，指向第一个结点的迭代器
+	 */
+	iterator begin();
+
+	/*
+	 * Function:		end()
+	 * Description:		获取指向最后一个结点之后位置的迭代器
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			iterator类型，尾后迭代器
+	 */
+	iterator end();
+
+	/*
+	 * Function:		begin()
+	 * Description:		获取指向第一个结点的只读迭代器，空表时等于end()
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			const_iterator类型，指向第一个结点的只读迭代器
+	 */
+	const_iterator begin() const;
+
+	/*
+	 * Function:		end()
+	 * Description:		获取指向最后一个结点之后位置的只读迭代器
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			const_iterator类型，尾后只读迭代器
+	 */
+	const_iterator end() const;
+
+	/*
+	 * Function:		cbegin()
+	 * Description:		获取指向第一个结点的只读迭代器，空表时等于cend()
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			const_iterator类型，指向第一个结点的只读迭代器
+	 */
+	const_iterator cbegin() const;
+
+	/*
+	 * Function:		cend()
+	 * Description:		获取指向最后一个结点之后位置的只读迭代器
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			const_iterator类型，尾后只读迭代器
+	 */
+	const_iterator cend() const;
+
+	/*
+	 * Function:		rbegin()
+	 * Description:		获取指向最后一个结点的反向迭代器
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			reverse_iterator类型，指向最后一个结点的反向迭代器
+	 */
+	reverse_iterator rbegin();
+
+	/*
+	 * Function:		rend()
+	 * Description:		获取指向第一个结点之前位置的反向迭代器
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			reverse_iterator类型，反向尾后迭代器
+	 */
+	reverse_iterator rend();
+
+	/*
+	 * Function:		rbegin()
+	 * Description:		获取指向最后一个结点的只读反向迭代器
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			const_reverse_iterator类型，指向最后一个结点的只读反向迭代器
+	 */
+	const_reverse_iterator rbegin() const;
+
+	/*
+	 * Function:		rend()
+	 * Description:		获取指向第一个结点之前位置的只读反向迭代器
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			const_reverse_iterator类型，只读反向尾后迭代器
+	 */
+	const_reverse_iterator rend() const;
+
+	/*
+	 * Function:		Insert()
+	 * Description:		在迭代器pos指向的结点之前插入一个结点，pos为end()时插入到链表末尾，在第一个结点之前插入的话，头结点会指向插入的结点。
+	 *					游标不变，空表插入之后游标指向插入的结点
+	 * Time complexity:	与类T的拷贝构造函数时间复杂度相同
+	 * Input:
+	 *		pos:		iterator类型，插入位置
+	 *		data:		const T&类型，插入的数据
+	 * Output:
+	 * Return:			iterator类型，指向插入的结点的迭代器，操作失败返回end()
+	 */
+	iterator Insert(iterator pos, const T& data);
+
+	/*
+	 * Function:		Erase()
+	 * Description:		删除迭代器pos指向的结点。如果游标指向被删除的结点，游标指向其后继结点；如果删除之后链表变为空表，游标置NULL
+	 * Time complexity:	O(1)
+	 * Input:
+	 *		pos:		iterator类型，删除的位置，不能是end()
+	 * Output:
+	 * Return:			iterator类型，指向被删除结点的后继结点的迭代器，删除的是最后一个结点时返回end()
+	 */
+	iterator Erase(iterator pos);
+
+private:
+	/*
+	 * Function:		DetachChain()
+	 * Description:		把所有结点从头结点上摘下，断开首尾相连，得到以NULL结尾的结点链，连续结点块也一并交出，链表置为空表
+	 * Time complexity:	O(1)，不复制连续结点块的记录
+	 * Input:
+	 * Output:
+	 * Return:			LIST_CHAIN<T>类型，摘下的结点链和连续结点块
+	 */
+	LIST_CHAIN<T> DetachChain();
+
+	/*
+	 * Function:		DestroyChain()
+	 * Description:		沿后继指针释放以NULL结尾的结点链，连续结点块中的结点只析构，最后释放各块
+	 * Time complexity:	假设类T的析构函数时间复杂度是O(m)，连续结点块有b块，则该函数的时间复杂的为O(n*(m + log b))
+	 * Input:
+	 *		chain:		LIST_CHAIN<T>&类型，结点链和连续结点块
+	 * Output:
+	 * Return:
+	 */
+	static void DestroyChain(LIST_CHAIN<T>& chain);
+
+	/*
+	 * Function:		DestroyDeferredChain()
+	 * Description:		交给LIST_RECLAIMER的释放函数，释放结点链后再释放new出来的LIST_CHAIN<T>
+	 * Time complexity:	与DestroyChain()相同
+	 * Input:
+	 *		chain:		void*类型，new出来的LIST_CHAIN<T>的地址
+	 * Output:
+	 * Return:
+	 */
+	static void DestroyDeferredChain(void* chain);
+
+	/*
+	 * Function:		FreeNode()
+	 * Description:		释放一个已经从链表上摘下的结点，连续结点块中的结点只析构，块中结点全部释放后释放整块
+	 * Time complexity:	与类T的析构函数时间复杂度相同，另需O(log b)查找结点所在的块，b为连续结点块数
+	 * Input:
+	 *		node:		LIST_NODE<T>*类型，要释放的结点
+	 * Output:
+	 * Return:
+	 */
+	void FreeNode(LIST_NODE<T>* node);
+
+	/*
+	 * Function:		FindBlock()
+	 * Description:		查找结点所在的连续结点块
+	 * Time complexity:	O(log b)，b为连续结点块数
+	 * Input:
+	 *		blocks:		std::map<LIST_NODE<T>*, LIST_BLOCK>&类型，连续结点块
+	 *		node:		LIST_NODE<T>*类型，结点
+	 * Output:
+	 * Return:			迭代器类型，结点在某个块中时指向该块，否则为blocks.end()
+	 */
+	static typename std::map<LIST_NODE<T>*, LIST_BLOCK>::iterator FindBlock(std::map<LIST_NODE<T>*, LIST_BLOCK>& blocks, LIST_NODE<T>* node);
+
+	/*
+	 * Function:		BuildRange()
+	 * Description:		把[first, last)中的数据拷贝构造到一块新申请的连续内存中，在链表外串成以first_node开始、last_node结束的结点链并记录该块，不修改链表
+	 * Time complexity:	假设类T的拷贝构造函数时间复杂度为O(m)，插入k个数据，则本函数时间复杂度为O(k*m)
+	 * Input:
+	 *		first:		ITER类型，输入迭代器范围的开始
+	 *		last:		ITER类型，输入迭代器范围的结束
+	 * Output:
+	 *		first_node:	LIST_NODE<T>*&类型，结点链的第一个结点
+	 *		last_node:	LIST_NODE<T>*&类型，结点链的最后一个结点
+	 * Return:			int类型，操作成功返回结点数，范围为空返回0，操作失败返回负数
+	 */
+	template <typename ITER>
+	int BuildRange(ITER first, ITER last, LIST_NODE<T>*& first_node, LIST_NODE<T>*& last_node);
+
+	/*
+	 * Function:		RebuildPartitions()
+	 * Description:		从第一个结点开始每隔partition_step个结点标记一个结点，重新生成分区标记
+	 * Time complexity:	O(n)
+	 * Input:
+	 * Output:
+	 * Return:
+	 */
+	void RebuildPartitions();
+
+	/*
+	 * Function:		UnmarkNode()
+	 * Description:		在结点从链表上摘下之前调用：记录一次删除，结点是分区标记时把标记移到其后继结点，后继是第一个结点或已经是标记时把该标记置NULL
+	 * Time complexity:	O(1)
+	 * Input:
+	 *		node:		LIST_NODE<T>*类型，将要删除的结点
+	 * Output:
+	 * Return:
+	 */
+	void UnmarkNode(LIST_NODE<T>* node);
+
+	/*
+	 * Function:		GetSegments()
+	 * Description:		必要时重建分区标记，然后把各段的第一个结点按链表顺序放入segments，第一段从链表的第一个结点开始，最后一段到表尾结束
+	 * Time complexity:	O(p)，p为标记数，重建标记时另加O(n)
+	 * Input:
+	 * Output:
+	 *		segments:	std::vector<LIST_NODE<T>*>&类型，各段的第一个结点
+	 * Return:
+	 */
+	void GetSegments(std::vector<LIST_NODE<T>*>& segments);
+
+	/*
+	 * Function:		TraverseSegment()
+	 * Description:		以[begin, end)中每个结点的数据为参数调用visit()，begin等于end时遍历整个环，线程入口函数
+	 * Time complexity:	假设visit()的时间复杂度为O(t)，段长为k，则本函数时间复杂度为O(k*t)
+	 * Input:
+	 *		begin:		LIST_NODE<T>*类型，段的第一个结点
+	 *		end:		LIST_NODE<T>*类型，下一段的第一个结点
+	 *		visit:		int (*)(T& data)类型，函数指针
+	 * Output:
+	 *		status:		int*类型，全部返回0时置0，否则置-1
+	 * Return:
+	 */
+	static void TraverseSegment(LIST_NODE<T>* begin, LIST_NODE<T>* end, int (*visit)(T& data), int* status);
+
+	/*
+	 * Function:		ReduceSegment()
+	 * Description:		对[begin, end)中每个结点的数据调用accumulate(*acc, data)，begin等于end时遍历整个环，线程入口函数
+	 * Time complexity:	假设accumulate()的时间复杂度为O(t)，段长为k，则本函数时间复杂度为O(k*t)
+	 * Input:
+	 *		begin:		LIST_NODE<T>*类型，段的第一个结点
+	 *		end:		LIST_NODE<T>*类型，下一段的第一个结点
+	 *		accumulate:	void (*)(R& acc, T& data)类型，函数指针
+	 * Output:
+	 *		acc:		R*类型，部分结果，调用前已置初值
+	 * Return:
+	 */
+	template <typename R>
+	static void ReduceSegment(LIST_NODE<T>* begin, LIST_NODE<T>* end, void (*accumulate)(R& acc, T& data), R* acc);
 };
 #endif
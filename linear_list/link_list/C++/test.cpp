@@ -4,15 +4,27 @@
  * Date:	2021.11.13
  * Description:	C++线性表链式存储库link_list.cpp、link_list.h的API测试程序
  * History:	1. 2021.11.13 创建并完成初始版本
+ *			2. 2026.10.19 增加迭代器的测试
+ *			3. 2026.10.19 增加批量清空和延迟清空的测试
+ *			4. 2026.10.19 增加带预取的遍历和多链表交错查找的测试
+ *			5. 2026.10.19 增加Compact()的测试
+ *			6. 2026.10.19 增加批量插入InsertRangeBeforeSlider()和InsertRangeAfterSlider()的测试
+ *			7. 2026.10.19 增加分区标记和并行遍历的测试
+ *			8. 2026.10.19 增加有序插入InsertSorted()和有序合并MergeSorted()的测试
  *****************************************************************************************************************************************/
 
 #include <iostream>
 #include <cstring>
 #include <string>
+#include <algorithm>
+#include <vector>
+#include <atomic>
 #include "link_list.cpp"
 
 using namespace std;
 
+static atomic<long long> parallel_sum(0);
+
 
 // TEACHER类型
 class TEACHER{
@@ -28,6 +40,9 @@ public:
 	/* 输出类信息 */
 	int PrintInfo(){cout << "age = " << age << "\tname = " << name << endl; return 0;}
 
+	/* 获取年龄 */
+	int GetAge() const{return age;}
+
 public:
 	/* 重载赋值操作符 */
 	TEACHER& operator=(const TEACHER& t);
@@ -42,6 +57,19 @@ public:
 // 打印TEACHER类信息
 int PrintTeacher(TEACHER& t);
 
+// 通过只读迭代器打印链表
+void PrintList(const LINK_LIST<int>& int_list);
+
+// 并行遍历时累加结点数据
+int AtomicSumVisit(int& data);
+
+// 按年龄比较TEACHER，用于有序插入
+bool TeacherAgeLess(const TEACHER& a, const TEACHER& b);
+
+// 并行归约：按顺序收集结点数据，合并时拼接，用来检查各段的顺序
+void CollectData(vector<int>& acc, int& data);
+void AppendPart(vector<int>& result, const vector<int>& part);
+
 int main(void)
 {
 	// 创建几个TEACHER对象以备测试
@@ -205,6 +233,271 @@ int main(void)
 		cout << "length = " << teacher_list.GetLength() << endl;
 	}
 
+	// 迭代器
+	cout << "\n***************************************** 迭代器 **********************************" << endl;
+	LINK_LIST<int> int_list;
+	for (int i = 1; i <= 5; ++i)
+	{
+		int_list.Insert(int_list.end(), i);					// 尾部插入
+	}
+	int_list.Insert(int_list.begin(), 0);					// 头部插入
+	cout << "insert 1..5 at end, 0 at begin: ";
+	PrintList(int_list);
+
+	// 两个迭代器同时存在，且不影响游标
+	int_list.ResetSlider();
+	LINK_LIST<int>::iterator it_three = std::find(int_list.begin(), int_list.end(), 3);
+	LINK_LIST<int>::iterator it_five = std::find(int_list.begin(), int_list.end(), 5);
+	int_list.Insert(it_five, 4);
+	*it_three = 30;
+	int slider_data = -1;
+	int_list.GetSlider(slider_data);
+	cout << "insert 4 before 5, set 3 to 30: ";
+	PrintList(int_list);
+	cout << "slider = " << slider_data << endl;
+
+	// 删除所有偶数
+	for (LINK_LIST<int>::iterator it = int_list.begin(); it != int_list.end();)
+	{
+		it = (*it % 2 == 0) ? int_list.Erase(it) : ++it;
+	}
+	cout << "erase even numbers: ";
+	PrintList(int_list);
+
+	// 反向遍历
+	cout << "reverse: ";
+	for (LINK_LIST<int>::reverse_iterator rit = int_list.rbegin(); rit != int_list.rend(); ++rit)
+	{
+		cout << *rit << " ";
+	}
+	cout << endl;
+
+	// 范围for循环修改数据
+	for (int& data : int_list)
+	{
+		data *= 10;
+	}
+	cout << "multiply by 10: ";
+	PrintList(int_list);
+	cout << "length = " << int_list.GetLength() << endl;
+
+	// 批量清空与延迟清空
+	cout << "\n***************************************** 批量清空与延迟清空 **********************************" << endl;
+	int_list.Clear();
+	cout << "Clear(): length = " << int_list.GetLength() << ", empty = " << int_list.IsEmpty() << endl;
+	for (int i = 0; i < 100000; ++i)
+	{
+		int_list.Insert(int_list.end(), i);
+	}
+	cout << "before ClearDeferred(): length = " << int_list.GetLength() << endl;
+	int_list.ClearDeferred();
+	cout << "after ClearDeferred(): length = " << int_list.GetLength() << ", empty = " << int_list.IsEmpty() << endl;
+	int_list.Insert(int_list.end(), 1);
+	int_list.Insert(int_list.end(), 2);
+	cout << "reuse after ClearDeferred(): ";
+	PrintList(int_list);
+	LIST_RECLAIMER::WaitIdle();
+	cout << "reclaimer idle" << endl;
+
+	// 带预取的遍历与多链表交错查找
+	cout << "\n***************************************** 带预取的遍历与多链表交错查找 **********************************" << endl;
+	TEACHER all_teachers[5] = {t1, t2, t3, t4, t5};
+	for (int i = 0; i < 5; ++i)
+	{
+		teacher_list.Insert(teacher_list.end(), all_teachers[i]);
+	}
+	LINK_LIST<TEACHER> other_list;
+	other_list.Insert(other_list.end(), t5);
+	other_list.Insert(other_list.end(), t3);
+	teacher_list.TraversePrefetch(PrintTeacher);
+
+	LINK_LIST<TEACHER>* batch_lists[4] = {&teacher_list, &other_list, &other_list, NULL};
+	TEACHER batch_datas[4] = {t4, t3, t1, t1};
+	int batch_results[4] = {0};
+	LINK_LIST<TEACHER>::SetSliderBatch(batch_lists, batch_datas, 4, batch_results);
+	cout << "results = " << batch_results[0] << " " << batch_results[1] << " " << batch_results[2] << " " << batch_results[3] << endl;
+	teacher_list.GetSlider(tmp);
+	cout << "slider of teacher_list is ";
+	tmp.PrintInfo();
+	other_list.GetSlider(tmp);
+	cout << "slider of other_list is ";
+	tmp.PrintInfo();
+
+	// 结点重排到连续内存
+	cout << "\n***************************************** 结点重排到连续内存 **********************************" << endl;
+	teacher_list.SetSlider(t3);
+	teacher_list.Compact();
+	teacher_list.Traverse(PrintTeacher);
+	teacher_list.GetSlider(tmp);
+	cout << "after Compact(): length = " << teacher_list.GetLength() << ", slider is ";
+	tmp.PrintInfo();
+
+	// 删除块内的结点、插入新结点之后再次重排
+	teacher_list.DeleteSlider(tmp);
+	teacher_list.Erase(teacher_list.begin());
+	teacher_list.Insert(teacher_list.begin(), t1);
+	teacher_list.Insert(teacher_list.end(), t3);
+	teacher_list.Compact();
+	teacher_list.Traverse(PrintTeacher);
+	teacher_list.GetSlider(tmp);
+	cout << "after second Compact(): length = " << teacher_list.GetLength() << ", slider is ";
+	tmp.PrintInfo();
+
+	// 删除全部块内结点、清空和延迟清空重排过的链表
+	while (teacher_list.GetLength() > 1)
+	{
+		teacher_list.Erase(teacher_list.begin());
+	}
+	teacher_list.Compact();
+	teacher_list.Clear();
+	other_list.Compact();
+	other_list.ClearDeferred();
+	LIST_RECLAIMER::WaitIdle();
+	cout << "after Clear() and ClearDeferred(): " << teacher_list.GetLength() << " " << other_list.GetLength() << endl;
+
+	// 批量插入
+	cout << "\n***************************************** 批量插入 **********************************" << endl;
+	int range_datas[6] = {1, 2, 3, 4, 5, 6};
+	LINK_LIST<int> range_list;
+	range_list.InsertRangeAfterSlider(range_datas, range_datas + 3);				// 空表中插入1 2 3，游标指向3
+	range_list.InsertRangeAfterSlider(range_datas + 3, range_datas + 6);			// 3后面插入4 5 6，游标指向6
+	range_list.ResetSlider();
+	range_list.InsertRangeBeforeSlider(range_datas + 4, range_datas + 6);			// 第一个结点前面插入5 6，游标指向5
+	range_list.InsertRangeAfterSlider(range_datas, range_datas);					// 空范围，不改变链表
+	int range_slider = 0;
+	range_list.GetSlider(range_slider);
+	cout << "length = " << range_list.GetLength() << ", slider = " << range_slider << ": ";
+	PrintList(range_list);
+
+	// 链表中间插入、与逐个插入的结果比较
+	range_list.SetSlider(3);
+	range_list.InsertRangeBeforeSlider(range_datas, range_datas + 2);
+	range_list.GetSlider(range_slider);
+	cout << "InsertRangeBeforeSlider() at 3: slider = " << range_slider << ": ";
+	PrintList(range_list);
+	LINK_LIST<int> single_list;
+	for (int i = 0; i < 6; ++i)
+	{
+		single_list.InsertAfterSlider(range_datas[i]);
+	}
+	single_list.ResetSlider();
+	for (int i = 5; i >= 4; --i)
+	{
+		single_list.InsertBeforeSlider(range_datas[i]);
+	}
+	single_list.SetSlider(3);
+	for (int i = 1; i >= 0; --i)
+	{
+		single_list.InsertBeforeSlider(range_datas[i]);
+	}
+	cout << "same as single inserts: " << (equal(range_list.begin(), range_list.end(), single_list.begin()) ? "true" : "false") << endl;
+
+	// 删除批量插入的结点、与Compact()的块混用，最后清空
+	range_list.Erase(range_list.begin());
+	range_list.SetSlider(4);
+	range_list.DeleteSlider(range_slider);
+	range_list.Compact();
+	range_list.ResetSlider();
+	range_list.InsertRangeAfterSlider(range_datas, range_datas + 2);
+	PrintList(range_list);
+	while (range_list.GetLength() > 2)
+	{
+		range_list.Erase(range_list.begin());
+	}
+	PrintList(range_list);
+	range_list.ClearDeferred();
+	LIST_RECLAIMER::WaitIdle();
+	vector<TEACHER> teachers(3, t2);
+	teacher_list.InsertRangeAfterSlider(teachers.begin(), teachers.end());
+	teacher_list.Traverse(PrintTeacher);
+
+	// 分区标记与并行遍历
+	cout << "\n***************************************** 分区标记与并行遍历 **********************************" << endl;
+	LINK_LIST<int> parallel_list;
+	for (int i = 0; i < 1000; ++i)
+	{
+		parallel_list.Insert(parallel_list.end(), i);
+	}
+	parallel_list.EnablePartitions(64);
+
+	// 删除标记结点、第一个结点和最后一个结点，并在各处插入，标记随之维护
+	parallel_list.SetSlider(64);
+	parallel_list.DeleteSlider(range_slider);
+	parallel_list.SetSlider(65);
+	parallel_list.DeleteSlider(range_slider);
+	parallel_list.Erase(parallel_list.begin());
+	parallel_list.Erase(--parallel_list.end());
+	parallel_list.Insert(parallel_list.begin(), -1);
+	parallel_list.SetSlider(128);
+	parallel_list.InsertRangeBeforeSlider(range_datas, range_datas + 6);
+	vector<int> expected(parallel_list.begin(), parallel_list.end());
+	long long expected_sum = 0;
+	for (size_t i = 0; i < expected.size(); ++i)
+	{
+		expected_sum += expected[i];
+	}
+
+	parallel_sum = 0;
+	int parallel_ret = parallel_list.ParallelTraverse(AtomicSumVisit, 4);
+	vector<int> collected;
+	parallel_list.ParallelReduce(vector<int>(), CollectData, AppendPart, collected, 4);
+	cout << "ParallelTraverse() = " << parallel_ret << ", sum " << ((parallel_sum == expected_sum) ? "equal" : "DIFFERENT")
+		 << ", ParallelReduce() order " << ((collected == expected) ? "equal" : "DIFFERENT") << endl;
+
+	// 大量删除后重建标记，再关闭标记顺序执行
+	for (int i = 0; i < 700; ++i)
+	{
+		parallel_list.Erase(parallel_list.begin());
+	}
+	expected.assign(parallel_list.begin(), parallel_list.end());
+	parallel_list.ParallelReduce(vector<int>(), CollectData, AppendPart, collected, 3);
+	cout << "after deleting 700 nodes: order " << ((collected == expected) ? "equal" : "DIFFERENT") << endl;
+	parallel_list.Compact();
+	parallel_list.ParallelReduce(vector<int>(), CollectData, AppendPart, collected, 0);
+	cout << "after Compact(): order " << ((collected == expected) ? "equal" : "DIFFERENT") << endl;
+	parallel_list.DisablePartitions();
+	parallel_list.ParallelReduce(vector<int>(), CollectData, AppendPart, collected, 4);
+	cout << "after DisablePartitions(): order " << ((collected == expected) ? "equal" : "DIFFERENT") << endl;
+
+	// 有序插入与有序合并
+	cout << "\n***************************************** 有序插入与有序合并 **********************************" << endl;
+	LINK_LIST<int> sorted_list;
+	int sorted_datas[10] = {50, 10, 90, 50, 51, 49, 5, 95, 50, 30};
+	vector<int> sorted_expected;
+	for (int i = 0; i < 10; ++i)
+	{
+		sorted_list.InsertSorted(sorted_datas[i]);
+		sorted_expected.push_back(sorted_datas[i]);
+	}
+	PrintList(sorted_list);
+	sorted_list.GetSlider(range_slider);
+	cout << "slider = " << range_slider << endl;
+
+	// 降序链表用std::greater
+	LINK_LIST<int> desc_list;
+	for (int i = 0; i < 10; ++i)
+	{
+		desc_list.InsertSorted(sorted_datas[i], greater<int>());
+	}
+	PrintList(desc_list);
+
+	// 合并一批有序数据，以及不是升序的一批数据
+	int merge_datas[7] = {0, 20, 50, 50, 60, 96, 100};
+	sorted_list.MergeSorted(merge_datas, merge_datas + 7);
+	sorted_expected.insert(sorted_expected.end(), merge_datas, merge_datas + 7);
+	sort(sorted_expected.begin(), sorted_expected.end());
+	PrintList(sorted_list);
+	cout << "merge unsorted: " << sorted_list.MergeSorted(sorted_datas, sorted_datas + 3) << ", length = " << sorted_list.GetLength()
+		 << ", sorted " << ((vector<int>(sorted_list.begin(), sorted_list.end()) == sorted_expected) ? "equal" : "DIFFERENT") << endl;
+
+	// 自定义比较函数，年龄相同的插入到已有结点之后
+	LINK_LIST<TEACHER> age_list;
+	age_list.InsertSorted(t3, TeacherAgeLess);
+	age_list.InsertSorted(t1, TeacherAgeLess);
+	age_list.InsertSorted(TEACHER(23, "teacher_03b"), TeacherAgeLess);
+	age_list.InsertSorted(t2, TeacherAgeLess);
+	age_list.Traverse(PrintTeacher);
+
 	cout << "Hello world!" << endl;
 	return 0;
 }
@@ -237,3 +530,48 @@ int PrintTeacher(TEACHER& t)
 	t.PrintInfo();
 	return 0;
 }
+
+
+
+// 通过只读迭代器打印链表
+void PrintList(const LINK_LIST<int>& int_list)
+{
+	for (LINK_LIST<int>::const_iterator it = int_list.begin(); it != int_list.end(); ++it)
+	{
+		cout << *it << " ";
+	}
+	cout << endl;
+}
+
+
+
+// 并行遍历时累加结点数据
+int AtomicSumVisit(int& data)
+{
+	parallel_sum += data;
+	return 0;
+}
+
+
+
+// 并行归约：按顺序收集结点数据
+void CollectData(vector<int>& acc, int& data)
+{
+	acc.push_back(data);
+}
+
+
+
+// 并行归约：拼接后一段的结果
+void AppendPart(vector<int>& result, const vector<int>& part)
+{
+	result.insert(result.end(), part.begin(), part.end());
+}
+
+
+
+// 按年龄比较TEACHER，用于有序插入
+bool TeacherAgeLess(const TEACHER& a, const TEACHER& b)
+{
+	return a.GetAge() < b.GetAge();
+}
@@ -0,0 +1,382 @@
+/***********************************************************************************************************************************************
+ * File name:	bench.c
+ * Author:	guoke
+ * Date:	2026.10.19
+ * Description:	C语言双向循环链表遍历与查找的性能对比程序：LinkList_Traverse()与LinkList_TraversePrefetch()，
+ *				逐个调用LinkList_SetSlider()与LinkList_SetSliderBatch()。多个链表交替插入结点、数据放在打乱顺序的数组中，
+ *				使数据在内存中不连续，硬件预取难以生效（结点来自各链表自己的结点池，同一链表的结点是相邻的）。
+ *				另外对比反复插入删除结点时，结点池回收重用与每次malloc()/free()的耗时；
+ *				以及数据嵌入LINK的侵入式链表与通用链表的建表和遍历耗时；
+ *				以及1、2、4、8个生产者线程时，无锁队列LINK_QUEUE与互斥锁保护的链表作为工作队列的耗时。
+ *				用法：./bench [链表个数] [每个链表的结点数] [查找次数]
+ * History:	1. 2026.10.19 创建并完成初始版本
+ *			2. 2026.10.19 增加反复插入删除结点的对比
+ *			3. 2026.10.19 增加侵入式链表的对比
+ *			4. 2026.10.19 增加多生产者单消费者队列的对比
+ **********************************************************************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <pthread.h>
+#include "link_list.h"
+
+static long long sum = 0;
+
+// 侵入式链表的元素，数据和指针域在同一块内存中
+typedef struct BENCH_ITEM{
+	int value;
+	LINK link;
+}BENCH_ITEM;
+
+#define QUEUE_BATCH		64			// 消费者一次最多取走的结点数
+
+// 工作队列对比中共用的状态，lock_free为1时使用LINK_QUEUE，否则使用互斥锁保护的侵入式链表
+typedef struct BENCH_QUEUE{
+	int lock_free;
+	LINK_QUEUE queue;
+	pthread_mutex_t mutex;
+	LINK head;
+}BENCH_QUEUE;
+
+// 生产者线程的参数
+typedef struct BENCH_PRODUCER{
+	BENCH_QUEUE* bench_queue;
+	BENCH_ITEM* items;
+	int item_num;
+}BENCH_PRODUCER;
+
+// 累加结点数据，模拟需要读取数据的visit()
+int SumVisit(LIST_NODE node);
+
+// 生产者线程，依次把items中的结点放入工作队列
+void* QueueProducer(void* arg);
+
+// producer_num个生产者各放入item_num个结点，当前线程作为消费者全部取走，返回耗时
+double QueueRun(int lock_free, int producer_num, int item_num, long long* out_sum);
+
+// 获取当前时间，单位为秒
+double NowSeconds(void);
+
+int main(int argc, char* argv[])
+{
+	int list_num = (argc > 1) ? atoi(argv[1]) : 64;
+	int node_num = (argc > 2) ? atoi(argv[2]) : 16384;
+	int query_num = (argc > 3) ? atoi(argv[3]) : 2048;
+	int total = list_num * node_num;
+	int i = 0;
+	int j = 0;
+	double start = 0.0;
+	double plain_time = 0.0;
+	double prefetch_time = 0.0;
+	long long plain_sum = 0;
+	void** blocks = NULL;
+	BENCH_ITEM* items = NULL;
+	BENCH_ITEM* item = NULL;
+	LINK head;
+
+	LINK_LIST** lists = (LINK_LIST**)malloc(sizeof(LINK_LIST*) * list_num);
+	int* values = (int*)malloc(sizeof(int) * total);
+	int* order = (int*)malloc(sizeof(int) * total);
+	LINK_LIST** query_lists = (LINK_LIST**)malloc(sizeof(LINK_LIST*) * query_num);
+	LIST_NODE* query_nodes = (LIST_NODE*)malloc(sizeof(LIST_NODE) * query_num);
+	int* results = (int*)malloc(sizeof(int) * query_num);
+	int* counts = (int*)calloc(list_num, sizeof(int));
+	LIST_NODE** members = (LIST_NODE**)malloc(sizeof(LIST_NODE*) * list_num);
+	if (lists == NULL || values == NULL || order == NULL || query_lists == NULL || query_nodes == NULL || results == NULL || counts == NULL || members == NULL)
+	{
+		printf("func main() err: malloc failed\n");
+		return -1;
+	}
+
+	// 数据数组按打乱的顺序分配给结点
+	srand(1);
+	for (i = 0; i < total; ++i)
+	{
+		values[i] = i;
+		order[i] = i;
+	}
+	for (i = total - 1; i > 0; --i)
+	{
+		j = rand() % (i + 1);
+		int tmp = order[i];
+		order[i] = order[j];
+		order[j] = tmp;
+	}
+
+	// 随机选择链表插入结点
+	for (i = 0; i < list_num; ++i)
+	{
+		lists[i] = LinkList_Create();
+		members[i] = (LIST_NODE*)malloc(sizeof(LIST_NODE) * node_num);
+	}
+	for (i = 0; i < total; )
+	{
+		j = rand() % list_num;
+		if (counts[j] == node_num)
+		{
+			continue;
+		}
+		LinkList_InsertAfterSlider(lists[j], (LIST_NODE)(&values[order[i]]));
+		members[j][counts[j] ++] = (LIST_NODE)(&values[order[i]]);
+		++i;
+	}
+	printf("lists = %d, nodes per list = %d, queries = %d\n", list_num, node_num, query_num);
+
+	// 遍历
+	sum = 0;
+	start = NowSeconds();
+	for (i = 0; i < list_num; ++i)
+	{
+		LinkList_Traverse(lists[i], SumVisit);
+	}
+	plain_time = NowSeconds() - start;
+	plain_sum = sum;
+
+	sum = 0;
+	start = NowSeconds();
+	for (i = 0; i < list_num; ++i)
+	{
+		LinkList_TraversePrefetch(lists[i], SumVisit);
+	}
+	prefetch_time = NowSeconds() - start;
+	printf("traverse:\tplain %.4f s\tprefetch %.4f s\tspeedup %.2f\tsum %s\n", plain_time, prefetch_time, plain_time / prefetch_time, (plain_sum == sum) ? "equal" : "DIFFERENT");
+
+	// 查找：每次在随机的链表中查找一个随机的已有数据
+	for (i = 0; i < query_num; ++i)
+	{
+		j = rand() % list_num;
+		query_lists[i] = lists[j];
+		query_nodes[i] = members[j][rand() % node_num];
+	}
+
+	start = NowSeconds();
+	for (i = 0; i < query_num; ++i)
+	{
+		LinkList_SetSlider(query_lists[i], query_nodes[i]);
+	}
+	plain_time = NowSeconds() - start;
+
+	start = NowSeconds();
+	LinkList_SetSliderBatch(query_lists, query_nodes, query_num, results);
+	prefetch_time = NowSeconds() - start;
+	for (i = 0, j = 0; i < query_num; ++i)
+	{
+		j += (results[i] == 0 && LinkList_GetSlider(query_lists[i]) != NULL) ? 1 : 0;
+	}
+	printf("set slider:\tplain %.4f s\tbatch %.4f s\tspeedup %.2f\tfound %d/%d\n", plain_time, prefetch_time, plain_time / prefetch_time, j, query_num);
+
+	// 反复插入删除：链表保持node_num个结点，每轮在游标之后插入一个结点再删除游标所指结点
+	LinkList_Clear(lists[0]);
+	for (i = 0; i < node_num; ++i)
+	{
+		LinkList_InsertAfterSlider(lists[0], (LIST_NODE)(&values[i]));
+	}
+	LinkList_ResetSlider(lists[0]);
+	start = NowSeconds();
+	for (i = 0; i < total; ++i)
+	{
+		LinkList_InsertAfterSlider(lists[0], (LIST_NODE)(&values[i]));
+		LinkList_DeleteSlider(lists[0]);
+	}
+	prefetch_time = NowSeconds() - start;
+
+	// 同样次数的malloc()/free()，每次申请与结点同样大小的内存，相当于不使用结点池时的开销
+	blocks = (void**)malloc(sizeof(void*) * node_num);
+	if (blocks == NULL)
+	{
+		printf("func main() err: blocks == NULL\n");
+		return -1;
+	}
+	for (i = 0; i < node_num; ++i)
+	{
+		blocks[i] = malloc(sizeof(void*) * 3);
+	}
+	start = NowSeconds();
+	for (i = 0; i < total; ++i)
+	{
+		j = i % node_num;
+		free(blocks[j]);
+		blocks[j] = malloc(sizeof(void*) * 3);
+	}
+	plain_time = NowSeconds() - start;
+	for (i = 0; i < node_num; ++i)
+	{
+		free(blocks[i]);
+	}
+	free(blocks);
+	printf("churn:\tmalloc %.4f s\tpool %.4f s\tspeedup %.2f\tlength %d\n", plain_time, prefetch_time, plain_time / prefetch_time, LinkList_GetLength(lists[0]));
+
+	// 侵入式链表：total个元素按数组顺序相连，与数据同样按顺序存放的通用链表比较建表和遍历
+	items = (BENCH_ITEM*)malloc(sizeof(BENCH_ITEM) * total);
+	if (items == NULL)
+	{
+		printf("func main() err: items == NULL\n");
+		return -1;
+	}
+	LinkList_Destroy(lists[0]);
+	lists[0] = LinkList_Create();
+	start = NowSeconds();
+	for (i = 0; i < total; ++i)
+	{
+		LinkList_InsertAfterSlider(lists[0], (LIST_NODE)(&values[i]));
+	}
+	plain_time = NowSeconds() - start;
+	start = NowSeconds();
+	LinkList_LinkInit(&head);
+	for (i = 0; i < total; ++i)
+	{
+		items[i].value = values[i];
+		LinkList_LinkInsertBefore(&head, &items[i].link);
+	}
+	prefetch_time = NowSeconds() - start;
+	printf("build:\tgeneric %.4f s\tintrusive %.4f s\tspeedup %.2f\n", plain_time, prefetch_time, plain_time / prefetch_time);
+
+	sum = 0;
+	start = NowSeconds();
+	LinkList_Traverse(lists[0], SumVisit);
+	plain_time = NowSeconds() - start;
+	plain_sum = sum;
+	sum = 0;
+	start = NowSeconds();
+	LinkList_ForEachEntry(item, &head, BENCH_ITEM, link)
+	{
+		sum += item->value;
+	}
+	prefetch_time = NowSeconds() - start;
+	printf("iterate:\tgeneric %.4f s\tintrusive %.4f s\tspeedup %.2f\tsum %s\n", plain_time, prefetch_time, plain_time / prefetch_time, (plain_sum == sum) ? "equal" : "DIFFERENT");
+	free(items);
+
+	// 多生产者单消费者工作队列，结点总数固定，生产者越多竞争越激烈
+	for (i = 1; i <= 8; i *= 2)
+	{
+		long long lock_sum = 0;
+		long long lock_free_sum = 0;
+		plain_time = QueueRun(0, i, total / i, &lock_sum);
+		prefetch_time = QueueRun(1, i, total / i, &lock_free_sum);
+		printf("queue %d producers:\tmutex %.4f s\tlock-free %.4f s\tspeedup %.2f\tsum %s\n", i, plain_time, prefetch_time, plain_time / prefetch_time, (lock_sum == lock_free_sum) ? "equal" : "DIFFERENT");
+	}
+
+	for (i = 0; i < list_num; ++i)
+	{
+		LinkList_Destroy(lists[i]);
+		free(members[i]);
+	}
+	free(lists);
+	free(values);
+	free(order);
+	free(query_lists);
+	free(query_nodes);
+	free(results);
+	free(counts);
+	free(members);
+	return 0;
+}
+
+// 累加结点数据，模拟需要读取数据的visit()
+int SumVisit(LIST_NODE node)
+{
+	sum += *(int*)node;
+	return 0;
+}
+
+// 获取当前时间，单位为秒
+double NowSeconds(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// 生产者线程，依次把items中的结点放入工作队列
+void* QueueProducer(void* arg)
+{
+	BENCH_PRODUCER* producer = (BENCH_PRODUCER*)arg;
+	BENCH_QUEUE* bench_queue = producer->bench_queue;
+	int i = 0;
+	for (i = 0; i < producer->item_num; ++i)
+	{
+		if (bench_queue->lock_free)
+		{
+			LinkList_QueuePush(&bench_queue->queue, &producer->items[i].link);
+		}
+		else
+		{
+			pthread_mutex_lock(&bench_queue->mutex);
+			LinkList_LinkInsertBefore(&bench_queue->head, &producer->items[i].link);
+			pthread_mutex_unlock(&bench_queue->mutex);
+		}
+	}
+	return NULL;
+}
+
+// producer_num个生产者各放入item_num个结点，当前线程作为消费者全部取走，返回耗时
+double QueueRun(int lock_free, int producer_num, int item_num, long long* out_sum)
+{
+	BENCH_QUEUE bench_queue;
+	BENCH_PRODUCER producers[8];
+	pthread_t threads[8];
+	LINK* batch[QUEUE_BATCH];
+	BENCH_ITEM* items = (BENCH_ITEM*)malloc(sizeof(BENCH_ITEM) * producer_num * item_num);
+	int total = producer_num * item_num;
+	int popped = 0;
+	int count = 0;
+	int i = 0;
+	double start = 0.0;
+
+	if (items == NULL || producer_num > 8)
+	{
+		printf("func QueueRun() err: items == NULL || producer_num > 8\n");
+		free(items);
+		return 0.0;
+	}
+	for (i = 0; i < total; ++i)
+	{
+		items[i].value = i;
+	}
+	bench_queue.lock_free = lock_free;
+	LinkList_QueueInit(&bench_queue.queue);
+	pthread_mutex_init(&bench_queue.mutex, NULL);
+	LinkList_LinkInit(&bench_queue.head);
+	*out_sum = 0;
+
+	start = NowSeconds();
+	for (i = 0; i < producer_num; ++i)
+	{
+		producers[i].bench_queue = &bench_queue;
+		producers[i].items = items + (size_t)i * item_num;
+		producers[i].item_num = item_num;
+		pthread_create(&threads[i], NULL, QueueProducer, &producers[i]);
+	}
+	while (popped < total)
+	{
+		if (lock_free)
+		{
+			count = LinkList_QueuePopBatch(&bench_queue.queue, batch, QUEUE_BATCH);
+		}
+		else
+		{
+			// 互斥锁版本同样一次加锁取走一批
+			pthread_mutex_lock(&bench_queue.mutex);
+			for (count = 0; count < QUEUE_BATCH && !LinkList_LinkIsEmpty(&bench_queue.head); ++count)
+			{
+				batch[count] = bench_queue.head.next;
+				LinkList_LinkRemove(batch[count]);
+			}
+			pthread_mutex_unlock(&bench_queue.mutex);
+		}
+		for (i = 0; i < count; ++i)
+		{
+			*out_sum += LINK_CONTAINER_OF(batch[i], BENCH_ITEM, link)->value;
+		}
+		popped += count;
+	}
+	for (i = 0; i < producer_num; ++i)
+	{
+		pthread_join(threads[i], NULL);
+	}
+	start = NowSeconds() - start;
+
+	pthread_mutex_destroy(&bench_queue.mutex);
+	free(items);
+	return start;
+}
@@ -5,21 +5,21 @@
  * Description:	C语言双向循环链表API的实现，声明在文件link_list.h中
  * History:	1. 2021.10.30 创建并完成初始版本
  *			2. 2021.11.07 对用户隐藏链表指针域，用户的业务数据中不在需要包含指针域
+ *			3. 2026.10.19 增加LinkList_TraversePrefetch()和LinkList_SetSliderBatch()
+ *			4. 2026.10.19 增加带调用者数据、可提前结束的遍历LinkList_TraverseEx()
+ *			5. 2026.10.19 结点从按块申请的结点池中分配，删除的结点回收到空闲链表中重复使用，增加LinkList_Reserve()
+ *			6. 2026.10.19 指针域LINK移到头文件中，增加侵入式链表API
+ *			7. 2026.10.19 增加无锁多生产者单消费者队列LINK_QUEUE
+ *			8. 2026.10.19 增加用读写锁保护的线程安全句柄LINK_LIST_SHARED及其批量API
  **********************************************************************************************************************************************/
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <pthread.h>
 #include "link_list.h"
 
 
-/* 链表的指针域 */
-typedef struct LINK{
-	struct LINK* next;				// 指向下一结点
-	struct LINK* prior;				// 指向前一结点
-}LINK;
-
-
 /* 链表内部实现的结点类型 */
 typedef struct NODE{
 	LINK link;						// 指针域
@@ -27,14 +27,132 @@ typedef struct NODE{
 }NODE;
 
 
+/* 一次申请的一块结点 */
+typedef struct NODE_SLAB{
+	struct NODE_SLAB*	next;		// 下一块，链表销毁时依次释放
+	int					count;		// 本块的结点数
+	NODE				nodes[];	// 连续存放的结点
+}NODE_SLAB;
+
+
 /* 链表头结点 */
 typedef struct LINK_LIST_METADATA{
-	LINK	link;					// 指针域
-	int		length;					// 记录链表长度
-	LINK*	slider;					// 游标，指向链表中的结点，用来辅助定位
+	LINK		link;				// 指针域
+	int			length;				// 记录链表长度
+	LINK*		slider;				// 游标，指向链表中的结点，用来辅助定位
+	LINK*		free_nodes;			// 空闲结点组成的单链表，用link.next相连，删除的结点回收到这里
+	int			free_count;			// 空闲结点数
+	NODE_SLAB*	slabs;				// 已申请的所有结点块
 }LINK_LIST_METADATA;
 
 
+/* 线程安全的句柄 */
+typedef struct LINK_LIST_SHARED_METADATA{
+	pthread_rwlock_t	lock;		// 读写锁，查找遍历加读锁，插入删除加写锁
+	LINK_LIST*			link_list;	// 接管的链表
+}LINK_LIST_SHARED_METADATA;
+
+
+/* 无锁队列使用的原子操作，GCC和Clang的内置函数 */
+#define LINK_ATOMIC_LOAD(ptr)				__atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#define LINK_ATOMIC_STORE(ptr, value)		__atomic_store_n((ptr), (value), __ATOMIC_RELEASE)
+#define LINK_ATOMIC_EXCHANGE(ptr, value)	__atomic_exchange_n((ptr), (value), __ATOMIC_ACQ_REL)
+
+/* 软件预取，只是提示，不支持的编译器上什么也不做 */
+#if defined(__GNUC__)
+#define LINK_LIST_PREFETCH(addr)	__builtin_prefetch((addr))
+#else
+#define LINK_LIST_PREFETCH(addr)	((void)0)
+#endif
+
+#define LINK_LIST_BATCH_MAX			64			// LinkList_SetSliderBatch()中同时交错进行的查找数
+#define LINK_LIST_SLAB_NODES		64			// 空闲链表为空时一次申请的结点数
+
+
+
+/*
+ * Function:		LinkList_AddSlab()
+ * Description:		申请一块count个结点的空间，全部放入空闲链表
+ * Time complexity:	O(count)
+ * Input:	
+ *		header:		LINK_LIST_METADATA*类型，链表头结点
+ *		count:		int类型，结点数
+ * Output:	
+ * Return:			int类型，操作成功返回0，空间申请失败返回负数
+ */
+static int LinkList_AddSlab(LINK_LIST_METADATA* header, int count)
+{
+	NODE_SLAB* slab = NULL;
+	int i = 0;
+
+	slab = (NODE_SLAB*)malloc(sizeof(NODE_SLAB) + sizeof(NODE) * (size_t)count);
+	if (slab == NULL)
+	{
+		printf("func LinkList_AddSlab() err: slab == NULL\n");
+		return -1;
+	}
+	slab->count = count;
+	slab->next = header->slabs;
+	header->slabs = slab;
+
+	// 按地址从小到大的顺序放入空闲链表，依次插入的结点在内存中也是相邻的
+	for (i = count - 1; i >= 0; --i)
+	{
+		slab->nodes[i].link.next = header->free_nodes;
+		header->free_nodes = (LINK*)&slab->nodes[i];
+	}
+	header->free_count += count;
+
+	return 0;
+}
+
+
+
+/*
+ * Function:		LinkList_AllocNode()
+ * Description:		从空闲链表中取一个结点，空闲链表为空时先申请一块LINK_LIST_SLAB_NODES个结点
+ * Time complexity:	O(1)，申请新块时均摊为O(1)
+ * Input:	
+ *		header:		LINK_LIST_METADATA*类型，链表头结点
+ * Output:	
+ * Return:			NODE*类型，结点，空间申请失败返回NULL
+ */
+static NODE* LinkList_AllocNode(LINK_LIST_METADATA* header)
+{
+	NODE* node = NULL;
+
+	if (header->free_nodes == NULL && LinkList_AddSlab(header, LINK_LIST_SLAB_NODES) != 0)
+	{
+		return NULL;
+	}
+
+	node = (NODE*)header->free_nodes;
+	header->free_nodes = node->link.next;
+	header->free_count--;
+
+	return node;
+}
+
+
+
+/*
+ * Function:		LinkList_FreeNode()
+ * Description:		把删除的结点放回空闲链表，结点空间在链表销毁时随结点块一起释放
+ * Time complexity:	O(1)
+ * Input:	
+ *		header:		LINK_LIST_METADATA*类型，链表头结点
+ *		node:		NODE*类型，已从链表中删除的结点
+ * Output:	
+ * Return:			
+ */
+static void LinkList_FreeNode(LINK_LIST_METADATA* header, NODE* node)
+{
+	node->link.next = header->free_nodes;
+	header->free_nodes = (LINK*)node;
+	header->free_count++;
+}
+
+
 
 /*
  * Function:		LinkList_Create()
@@ -93,6 +211,14 @@ int LinkList_Destroy(LINK_LIST* link_list)
 		return -2;
 	}
 
+	// 释放所有结点块
+	while (header->slabs != NULL)
+	{
+		NODE_SLAB* slab = header->slabs;
+		header->slabs = slab->next;
+		free(slab);
+	}
+
 	// 释放头结点空间
 	free(header);
 	header = NULL;
@@ -104,7 +230,7 @@ int LinkList_Destroy(LINK_LIST* link_list)
 
 /*
  * Function:		LinkList_Clear()
- * Description:		将链表置为空表
+ * Description:		将链表置为空表，结点回收到链表的结点池中，销毁链表时才释放
  * Time complexity:	O(n)
  * Input:	
  *		link_list:	LINK_LIST*类型，链表的地址	
@@ -362,8 +488,8 @@ int LinkList_InsertBeforeSlider(LINK_LIST* link_list, LIST_NODE list_node)
 		return -1;
 	}
 
-	// 申请一个内部结点的空间，并将数据域置为list_node
-	node = (NODE*)malloc(sizeof(NODE));
+	// 从结点池中取一个内部结点，并将数据域置为list_node
+	node = LinkList_AllocNode(header);
 	if (node == NULL)
 	{
 		printf("func LinkList_InsertBeforeSlider() err: node == NULL\n");
@@ -433,11 +559,11 @@ int LinkList_InsertAfterSlider(LINK_LIST* link_list, LIST_NODE list_node)
 		return -1;
 	}
 
-	// 申请一个内部结点的空间，并将数据域置为list_node
-	node = (NODE*)malloc(sizeof(NODE));
+	// 从结点池中取一个内部结点，并将数据域置为list_node
+	node = LinkList_AllocNode(header);
 	if (node == NULL)
 	{
-		printf("func LinkList_InsertBeforeSlider() err: node == NULL\n");
+		printf("func LinkList_InsertAfterSlider() err: node == NULL\n");
 		return -2;
 	}
 	node->data = list_node;
@@ -534,11 +660,11 @@ LIST_NODE LinkList_DeleteSlider(LINK_LIST* link_list)
 	// 链表长度减1
 	header->length--;
 
-	// 释放删除结点的空间
+	// 把删除的结点放回结点池
 	if (deleted_node != NULL)
 	{
 		deleted_node_data = deleted_node->data;
-		free(deleted_node);
+		LinkList_FreeNode(header, deleted_node);
 		deleted_node = NULL;
 
 		return deleted_node_data;
@@ -644,3 +770,1046 @@ int LinkList_Traverse(LINK_LIST* link_list,	int (*visit)(LIST_NODE node))
 
 	return 0;
 }
+
+
+
+/*
+ * Function:		LinkList_TraverseEx()
+ * Description:		从第一个结点开始遍历链表，以每个结点的数据和ctx为参数调用visit()，visit()返回非0时停止遍历。
+ *					ctx原样传给visit()，调用者的状态不必放在全局变量中，同时进行的多个遍历互不影响；提前停止可以用来查找
+ * Time complexity:	O(n)
+ * Input:	
+ *		link_list:	LINK_LIST*类型。链表的地址。	
+ *		visit:		int (*)(LIST_NODE, void*)类型，函数指针，第一个参数为结点数据，第二个参数为ctx，返回0继续，返回非0停止
+ *		ctx:		void*类型，原样传给visit()的调用者数据，可以为NULL
+ * Output:	
+ * Return:			int类型，visit()返回非0的结点序号（从0开始），全部访问完则返回链表长度，操作失败返回负数
+ */
+int LinkList_TraverseEx(LINK_LIST* link_list, int (*visit)(LIST_NODE node, void* ctx), void* ctx)
+{
+	LINK* current_ptr = NULL;
+	int i = 0;
+
+	// 将LINK_LIST类型的地址转换为LINK_LIST_METADATA类型的地址
+	LINK_LIST_METADATA* header = (LINK_LIST_METADATA*)link_list;
+
+	// 参数检查
+	if (link_list == NULL || visit == NULL)
+	{
+		printf("func LinkList_TraverseEx() err: link_list == NULL || visit == NULL\n");
+		return -1;
+	}
+
+	// 遍历链表，visit()返回非0时停在该结点
+	current_ptr = (LINK*)header;
+	for (i = 0; i < header->length; ++i)
+	{
+		current_ptr = current_ptr->next;
+		if (visit(((NODE*)current_ptr)->data, ctx) != 0)
+		{
+			break;
+		}
+	}
+
+	return i;
+}
+
+
+
+/*
+ * Function:		LinkList_TraversePrefetch()
+ * Description:		与LinkList_Traverse()相同，但另有一个预取指针领先当前结点LINK_LIST_PREFETCH_DISTANCE个结点，
+ *					提前预取它后继结点的指针域和它的数据，使访存延迟与visit()的执行重叠。结点在内存中分散、visit()需要读取数据时效果明显
+ * Time complexity:	O(n)
+ * Input:	
+ *		link_list:	LINK_LIST*类型。链表的地址。	
+ *		visit:		int (*)(LIST_NODE)类型，函数指针，每个结点的数据执行的操作
+ * Output:	
+ * Return:			int类型，操作成功返回0，否则返回其他值
+ */
+int LinkList_TraversePrefetch(LINK_LIST* link_list, int (*visit)(LIST_NODE node))
+{
+	LINK* current_ptr = NULL;
+	LINK* prefetch_ptr = NULL;
+	int i = 0;
+	int func_status = 0;
+
+	// 将LINK_LIST类型的地址转换为LINK_LIST_METADATA类型的地址
+	LINK_LIST_METADATA* header = (LINK_LIST_METADATA*)link_list;
+
+	// 参数检查
+	if (link_list == NULL || visit == NULL)
+	{
+		printf("func LinkList_TraversePrefetch() err: link_list == NULL || visit == NULL\n");
+		return -1;
+	}
+
+	// 预取指针先走到领先的位置，沿途预取；链表是循环的，预取指针越过表尾也不会访问无效地址
+	current_ptr = (LINK*)header;
+	prefetch_ptr = header->link.next;
+	for (i = 0; i < LINK_LIST_PREFETCH_DISTANCE && i < header->length; ++i)
+	{
+		LINK_LIST_PREFETCH(((NODE*)prefetch_ptr)->data);
+		prefetch_ptr = prefetch_ptr->next;
+		LINK_LIST_PREFETCH(prefetch_ptr);
+	}
+
+	// 遍历链表，预取指针与当前结点同步前进
+	for (i = 0; i < header->length; ++i)
+	{
+		current_ptr = current_ptr->next;
+		if (i + LINK_LIST_PREFETCH_DISTANCE < header->length)
+		{
+			LINK_LIST_PREFETCH(((NODE*)prefetch_ptr)->data);
+			prefetch_ptr = prefetch_ptr->next;
+			LINK_LIST_PREFETCH(prefetch_ptr);
+		}
+
+		func_status = visit(((NODE*)current_ptr)->data);
+		if (func_status != 0)
+		{
+			printf("func LinkList_TraversePrefetch() err: func_status != 0\n");
+			return -2;
+		}
+	}
+
+	return 0;
+}
+
+
+
+/*
+ * Function:		LinkList_SetSliderBatch()
+ * Description:		对count个链表分别执行LinkList_SetSlider()，list_nodes[i]在link_lists[i]中查找。
+ *					各链表的查找交错进行，每轮每个链表前进一个结点并预取下一个结点，多个链表的访存延迟相互重叠。找不到时不输出错误信息
+ * Time complexity:	O(n1 + n2 + ... + ncount)
+ * Input:	
+ *		link_lists:	LINK_LIST*[]类型，count个链表的地址，可以重复
+ *		list_nodes:	LIST_NODE[]类型，在每个链表中查找的数据
+ *		count:		int类型，链表个数
+ * Output:	
+ *		results:	int[]类型，results[i]为第i个查找的结果：找到并移动了游标为0，没有找到为-2，参数错误为-1
+ * Return:			int类型，操作成功返回0，否则返回其他值
+ */
+int LinkList_SetSliderBatch(LINK_LIST* link_lists[], LIST_NODE list_nodes[], int count, int results[])
+{
+	LINK* cursors[LINK_LIST_BATCH_MAX];			// 每个查找当前所在的结点
+	int remains[LINK_LIST_BATCH_MAX];			// 每个查找还没有比较的结点数
+	int indexes[LINK_LIST_BATCH_MAX];			// 仍在进行的查找在参数数组中的下标
+	int base = 0;
+	int active = 0;
+	int i = 0;
+
+	// 参数检查
+	if (link_lists == NULL || list_nodes == NULL || results == NULL || count < 0)
+	{
+		printf("func LinkList_SetSliderBatch() err: link_lists == NULL || list_nodes == NULL || results == NULL || count < 0\n");
+		return -1;
+	}
+
+	// 每次最多交错进行LINK_LIST_BATCH_MAX个查找
+	for (base = 0; base < count; base += LINK_LIST_BATCH_MAX)
+	{
+		// 初始化本组查找，预取每个链表的第一个结点
+		active = 0;
+		for (i = base; i < count && i < base + LINK_LIST_BATCH_MAX; ++i)
+		{
+			LINK_LIST_METADATA* header = (LINK_LIST_METADATA*)link_lists[i];
+			if (header == NULL || list_nodes[i] == NULL)
+			{
+				results[i] = -1;
+				continue;
+			}
+			if (header->length == 0)
+			{
+				results[i] = -2;
+				continue;
+			}
+			cursors[active] = header->link.next;
+			remains[active] = header->length;
+			indexes[active] = i;
+			LINK_LIST_PREFETCH(cursors[active]);
+			active ++;
+		}
+
+		// 轮流推进每个查找，结束的查找用最后一个查找填补位置
+		while (active > 0)
+		{
+			for (i = 0; i < active; )
+			{
+				int index = indexes[i];
+				if (((NODE*)cursors[i])->data == list_nodes[index])
+				{
+					((LINK_LIST_METADATA*)link_lists[index])->slider = cursors[i];
+					results[index] = 0;
+				}
+				else if (-- remains[i] == 0)
+				{
+					results[index] = -2;
+				}
+				else
+				{
+					cursors[i] = cursors[i]->next;
+					LINK_LIST_PREFETCH(cursors[i]);
+					++i;
+					continue;
+				}
+
+				active --;
+				cursors[i] = cursors[active];
+				remains[i] = remains[active];
+				indexes[i] = indexes[active];
+			}
+		}
+	}
+
+	return 0;
+}
+
+
+
+/*
+ * Function:		LinkList_Reserve()
+ * Description:		预先准备结点，使链表中的结点数与空闲结点数之和至少为node_num，之后长度不超过node_num时插入删除都不再申请释放内存。
+ *					删除的结点不归还系统，而是留在链表的空闲链表中，链表销毁时才释放
+ * Time complexity:	O(node_num)
+ * Input:	
+ *		link_list:	LINK_LIST*类型，链表的地址	
+ *		node_num:	int类型，需要的结点数
+ * Output:	
+ * Return:			int类型，操作成功返回0，否则返回负数
+ */
+int LinkList_Reserve(LINK_LIST* link_list, int node_num)
+{
+	// 将LINK_LIST类型的地址转换为LINK_LIST_METADATA类型的地址
+	LINK_LIST_METADATA* header = (LINK_LIST_METADATA*)link_list;
+
+	int missing = 0;
+
+	// 参数检查
+	if (link_list == NULL || node_num < 0)
+	{
+		printf("func LinkList_Reserve() err: link_list == NULL || node_num < 0\n");
+		return -1;
+	}
+
+	// 不足的结点一次申请为一块
+	missing = node_num - header->length - header->free_count;
+	if (missing > 0 && LinkList_AddSlab(header, missing) != 0)
+	{
+		printf("func LinkList_Reserve() err: LinkList_AddSlab() != 0\n");
+		return -2;
+	}
+
+	return 0;
+}
+
+
+
+/*
+ * Function:		LinkList_LinkInit()
+ * Description:		把head初始化为侵入式链表的空表表头，next和prior都指向自己
+ * Time complexity:	O(1)
+ * Input:	
+ *		head:		LINK*类型，表头的地址
+ * Output:	
+ * Return:			int类型，操作成功返回0，否则返回负数
+ */
+int LinkList_LinkInit(LINK* head)
+{
+	// 参数检查
+	if (head == NULL)
+	{
+		printf("func LinkList_LinkInit() err: head == NULL\n");
+		return -1;
+	}
+
+	head->next = head;
+	head->prior = head;
+
+	return 0;
+}
+
+
+
+/*
+ * Function:		LinkList_LinkIsEmpty()
+ * Description:		判断侵入式链表是否为空表
+ * Time complexity:	O(1)
+ * Input:	
+ *		head:		const LINK*类型，表头的地址
+ * Output:	
+ * Return:			int类型，空表返回1，否则返回0，参数错误返回负数
+ */
+int LinkList_LinkIsEmpty(const LINK* head)
+{
+	// 参数检查
+	if (head == NULL)
+	{
+		printf("func LinkList_LinkIsEmpty() err: head == NULL\n");
+		return -1;
+	}
+
+	return (head->next == head) ? 1 : 0;
+}
+
+
+
+/*
+ * Function:		LinkList_LinkInsertAfter()
+ * Description:		把结点link插入到pos之后，pos为表头时插入到表头位置
+ * Time complexity:	O(1)
+ * Input:	
+ *		pos:		LINK*类型，表头或链表中的结点
+ *		link:		LINK*类型，插入的结点，不能已在某个链表中
+ * Output:	
+ * Return:			int类型，操作成功返回0，否则返回负数
+ */
+int LinkList_LinkInsertAfter(LINK* pos, LINK* link)
+{
+	// 参数检查
+	if (pos == NULL || link == NULL)
+	{
+		printf("func LinkList_LinkInsertAfter() err: pos == NULL || link == NULL\n");
+		return -1;
+	}
+
+	// 修改next指针
+	link->next = pos->next;
+	pos->next->prior = link;
+
+	// 修改prior指针
+	link->prior = pos;
+	pos->next = link;
+
+	return 0;
+}
+
+
+
+/*
+ * Function:		LinkList_LinkInsertBefore()
+ * Description:		把结点link插入到pos之前，pos为表头时插入到表尾
+ * Time complexity:	O(1)
+ * Input:	
+ *		pos:		LINK*类型，表头或链表中的结点
+ *		link:		LINK*类型，插入的结点，不能已在某个链表中
+ * Output:	
+ * Return:			int类型，操作成功返回0，否则返回负数
+ */
+int LinkList_LinkInsertBefore(LINK* pos, LINK* link)
+{
+	// 参数检查
+	if (pos == NULL || link == NULL)
+	{
+		printf("func LinkList_LinkInsertBefore() err: pos == NULL || link == NULL\n");
+		return -1;
+	}
+
+	// 插入到pos的前驱之后
+	return LinkList_LinkInsertAfter(pos->prior, link);
+}
+
+
+
+/*
+ * Function:		LinkList_LinkRemove()
+ * Description:		把结点link从所在的链表中摘下，摘下后link的next和prior指向自己
+ * Time complexity:	O(1)
+ * Input:	
+ *		link:		LINK*类型，链表中的结点，不能是表头
+ * Output:	
+ * Return:			int类型，操作成功返回0，否则返回负数
+ */
+int LinkList_LinkRemove(LINK* link)
+{
+	// 参数检查
+	if (link == NULL)
+	{
+		printf("func LinkList_LinkRemove() err: link == NULL\n");
+		return -1;
+	}
+
+	// 前驱和后继直接相连
+	link->prior->next = link->next;
+	link->next->prior = link->prior;
+
+	// 摘下的结点自成一个空环，重复摘下不会破坏链表
+	link->next = link;
+	link->prior = link;
+
+	return 0;
+}
+
+
+
+/*
+ * Function:		LinkList_LinkCount()
+ * Description:		计算侵入式链表的结点数
+ * Time complexity:	O(n)
+ * Input:	
+ *		head:		const LINK*类型，表头的地址
+ * Output:	
+ * Return:			int类型，结点数，参数错误返回负数
+ */
+int LinkList_LinkCount(const LINK* head)
+{
+	const LINK* current_ptr = NULL;
+	int count = 0;
+
+	// 参数检查
+	if (head == NULL)
+	{
+		printf("func LinkList_LinkCount() err: head == NULL\n");
+		return -1;
+	}
+
+	for (current_ptr = head->next; current_ptr != head; current_ptr = current_ptr->next)
+	{
+		count++;
+	}
+
+	return count;
+}
+
+
+
+/*
+ * Function:		LinkList_QueueInit()
+ * Description:		把queue初始化为空的无锁多生产者单消费者队列，head和tail都指向哨兵结点
+ * Time complexity:	O(1)
+ * Input:	
+ *		queue:		LINK_QUEUE*类型，队列的地址
+ * Output:	
+ * Return:			int类型，操作成功返回0，否则返回负数
+ */
+int LinkList_QueueInit(LINK_QUEUE* queue)
+{
+	// 参数检查
+	if (queue == NULL)
+	{
+		printf("func LinkList_QueueInit() err: queue == NULL\n");
+		return -1;
+	}
+
+	queue->stub.next = NULL;
+	queue->stub.prior = NULL;
+	queue->tail = &queue->stub;
+	LINK_ATOMIC_STORE(&queue->head, &queue->stub);
+
+	return 0;
+}
+
+
+
+/*
+ * Function:		LinkList_QueuePush()
+ * Description:		结点link入队：先把自己置为最后入队的结点，再把原来的最后一个结点的next指向自己。
+ *					两步之间消费者看不到link及其后的结点，但不会出错
+ * Time complexity:	O(1)
+ * Input:	
+ *		queue:		LINK_QUEUE*类型，队列的地址
+ *		link:		LINK*类型，入队的结点
+ * Output:	
+ * Return:			int类型，操作成功返回0，否则返回负数
+ */
+int LinkList_QueuePush(LINK_QUEUE* queue, LINK* link)
+{
+	LINK* prior_link = NULL;
+
+	// 参数检查
+	if (queue == NULL || link == NULL)
+	{
+		printf("func LinkList_QueuePush() err: queue == NULL || link == NULL\n");
+		return -1;
+	}
+
+	// 原子交换得到原来的最后一个结点，多个生产者各自得到不同的前驱
+	__atomic_store_n(&link->next, NULL, __ATOMIC_RELAXED);
+	prior_link = LINK_ATOMIC_EXCHANGE(&queue->head, link);
+
+	// 连上前驱，release保证消费者看到link时也能看到调用者写入的数据
+	LINK_ATOMIC_STORE(&prior_link->next, link);
+
+	return 0;
+}
+
+
+
+/*
+ * Function:		LinkList_QueuePop()
+ * Description:		队首结点出队。哨兵结点在队首时跳过它，队中只剩一个结点时把哨兵重新入队，以便取走最后一个结点
+ * Time complexity:	O(1)
+ * Input:	
+ *		queue:		LINK_QUEUE*类型，队列的地址
+ * Output:	
+ * Return:			LINK*类型，出队的结点，队列为空或队首的后继还没有连上时返回NULL
+ */
+LINK* LinkList_QueuePop(LINK_QUEUE* queue)
+{
+	LINK* tail = NULL;
+	LINK* next = NULL;
+
+	// 参数检查
+	if (queue == NULL)
+	{
+		printf("func LinkList_QueuePop() err: queue == NULL\n");
+		return NULL;
+	}
+
+	// 跳过哨兵结点
+	tail = queue->tail;
+	next = LINK_ATOMIC_LOAD(&tail->next);
+	if (tail == &queue->stub)
+	{
+		if (next == NULL)
+		{
+			return NULL;
+		}
+		queue->tail = next;
+		tail = next;
+		next = LINK_ATOMIC_LOAD(&tail->next);
+	}
+
+	// 队首结点有后继，直接取走队首结点
+	if (next != NULL)
+	{
+		queue->tail = next;
+		return tail;
+	}
+
+	// 队首结点没有后继，但它不是最后入队的结点：有生产者交换了head还没有连上，暂时取不到
+	if (tail != LINK_ATOMIC_LOAD(&queue->head))
+	{
+		return NULL;
+	}
+
+	// 队首结点是最后一个结点，哨兵重新入队作为它的后继，然后取走它
+	LinkList_QueuePush(queue, &queue->stub);
+	next = LINK_ATOMIC_LOAD(&tail->next);
+	if (next != NULL)
+	{
+		queue->tail = next;
+		return tail;
+	}
+
+	// 哨兵入队之前又有生产者入队且还没有连上
+	return NULL;
+}
+
+
+
+/*
+ * Function:		LinkList_QueuePopBatch()
+ * Description:		连续出队至多max_count个结点，遇到空队列或尚未连上的结点时提前结束
+ * Time complexity:	O(max_count)
+ * Input:	
+ *		queue:		LINK_QUEUE*类型，队列的地址
+ *		max_count:	int类型，最多出队的结点数
+ * Output:	
+ *		out_links:	LINK*[]类型，按出队顺序存放出队的结点
+ * Return:			int类型，出队的结点数，操作失败返回负数
+ */
+int LinkList_QueuePopBatch(LINK_QUEUE* queue, LINK* out_links[], int max_count)
+{
+	LINK* tail = NULL;
+	LINK* next = NULL;
+	int count = 0;
+
+	// 参数检查
+	if (queue == NULL || out_links == NULL || max_count < 0)
+	{
+		printf("func LinkList_QueuePopBatch() err: queue == NULL || out_links == NULL || max_count < 0\n");
+		return -1;
+	}
+
+	// 有后继的结点直接沿next取走，只在tail中记录位置，最后写回一次
+	tail = queue->tail;
+	while (count < max_count)
+	{
+		next = LINK_ATOMIC_LOAD(&tail->next);
+		if (tail == &queue->stub)
+		{
+			if (next == NULL)
+			{
+				break;
+			}
+			tail = next;
+			continue;
+		}
+		if (next == NULL)
+		{
+			break;
+		}
+		out_links[count++] = tail;
+		tail = next;
+	}
+	queue->tail = tail;
+
+	// 剩下最后一个结点时交给LinkList_QueuePop()处理哨兵
+	while (count < max_count)
+	{
+		tail = LinkList_QueuePop(queue);
+		if (tail == NULL)
+		{
+			break;
+		}
+		out_links[count++] = tail;
+	}
+
+	return count;
+}
+
+
+
+/*
+ * Function:		LinkList_FindNode()
+ * Description:		查找第一个包含数据list_node的结点，不移动游标，找不到时不输出错误信息，供句柄的API在持有锁时调用
+ * Time complexity:	O(n)
+ * Input:	
+ *		header:		LINK_LIST_METADATA*类型，链表头结点
+ *		list_node:	LIST_NODE类型，查找的数据
+ * Output:	
+ * Return:			LINK*类型，找到的结点，没有找到返回NULL
+ */
+static LINK* LinkList_FindNode(LINK_LIST_METADATA* header, LIST_NODE list_node)
+{
+	LINK* current_ptr = (LINK*)header;
+	int i = 0;
+
+	for (i = 0; i < header->length; ++i)
+	{
+		current_ptr = current_ptr->next;
+		if (((NODE*)current_ptr)->data == list_node)
+		{
+			return current_ptr;
+		}
+	}
+
+	return NULL;
+}
+
+
+
+/*
+ * Function:		LinkList_PushBack()
+ * Description:		游标移到最后一个结点，在其后插入数据list_node，供句柄的API在持有写锁时调用
+ * Time complexity:	O(1)
+ * Input:	
+ *		header:		LINK_LIST_METADATA*类型，链表头结点
+ *		list_node:	LIST_NODE类型，插入的数据
+ * Output:	
+ * Return:			int类型，操作成功返回0，否则返回负数
+ */
+static int LinkList_PushBack(LINK_LIST_METADATA* header, LIST_NODE list_node)
+{
+	if (header->length > 0)
+	{
+		header->slider = header->link.next->prior;
+	}
+
+	return LinkList_InsertAfterSlider((LINK_LIST*)header, list_node);
+}
+
+
+
+/*
+ * Function:		LinkList_CreateShared()
+ * Description:		构造一个线程安全的句柄，初始化读写锁并接管link_list
+ * Time complexity:	O(1)
+ * Input:	
+ *		link_list:	LINK_LIST*类型，接管的链表
+ * Output:	
+ * Return:			LINK_LIST_SHARED*类型，创建成功则返回句柄地址，否则返回NULL
+ */
+LINK_LIST_SHARED* LinkList_CreateShared(LINK_LIST* link_list)
+{
+	LINK_LIST_SHARED_METADATA* internal_shared = NULL;
+
+	// 参数检查
+	if (link_list == NULL)
+	{
+		printf("func LinkList_CreateShared() err: link_list == NULL\n");
+		return NULL;
+	}
+
+	// 申请句柄空间并初始化读写锁
+	internal_shared = (LINK_LIST_SHARED_METADATA*)malloc(sizeof(LINK_LIST_SHARED_METADATA));
+	if (internal_shared == NULL)
+	{
+		printf("func LinkList_CreateShared() err: internal_shared == NULL\n");
+		return NULL;
+	}
+	if (pthread_rwlock_init(&internal_shared->lock, NULL) != 0)
+	{
+		printf("func LinkList_CreateShared() err: pthread_rwlock_init() != 0\n");
+		free(internal_shared);
+		return NULL;
+	}
+	internal_shared->link_list = link_list;
+
+	return (LINK_LIST_SHARED*)internal_shared;
+}
+
+
+
+/*
+ * Function:		LinkList_DestroyShared()
+ * Description:		销毁读写锁、句柄和它接管的链表
+ * Time complexity:	O(n)
+ * Input:	
+ *		shared:		LINK_LIST_SHARED*类型，句柄地址
+ * Output:	
+ * Return:			int类型，操作成功返回0，否则返回负数
+ */
+int LinkList_DestroyShared(LINK_LIST_SHARED* shared)
+{
+	// 将LINK_LIST_SHARED类型的地址转换为LINK_LIST_SHARED_METADATA类型的地址
+	LINK_LIST_SHARED_METADATA* internal_shared = (LINK_LIST_SHARED_METADATA*)shared;
+
+	// 参数检查
+	if (shared == NULL)
+	{
+		printf("func LinkList_DestroyShared() err: shared == NULL\n");
+		return -1;
+	}
+
+	LinkList_Destroy(internal_shared->link_list);
+	pthread_rwlock_destroy(&internal_shared->lock);
+	free(internal_shared);
+
+	return 0;
+}
+
+
+
+/*
+ * Function:		LinkList_SharedGetLength()
+ * Description:		加读锁获取链表长度
+ * Time complexity:	O(1)
+ * Input:	
+ *		shared:		LINK_LIST_SHARED*类型，句柄地址
+ * Output:	
+ * Return:			int类型，链表长度，操作失败返回负数
+ */
+int LinkList_SharedGetLength(LINK_LIST_SHARED* shared)
+{
+	// 将LINK_LIST_SHARED类型的地址转换为LINK_LIST_SHARED_METADATA类型的地址
+	LINK_LIST_SHARED_METADATA* internal_shared = (LINK_LIST_SHARED_METADATA*)shared;
+
+	int result = 0;
+
+	// 参数检查
+	if (shared == NULL)
+	{
+		printf("func LinkList_SharedGetLength() err: shared == NULL\n");
+		return -1;
+	}
+
+	// 加读锁，其他读者可以同时进入
+	if (pthread_rwlock_rdlock(&internal_shared->lock) != 0)
+	{
+		printf("func LinkList_SharedGetLength() err: pthread_rwlock_rdlock() != 0\n");
+		return -1;
+	}
+	result = LinkList_GetLength(internal_shared->link_list);
+	pthread_rwlock_unlock(&internal_shared->lock);
+
+	return result;
+}
+
+
+
+/*
+ * Function:		LinkList_SharedContains()
+ * Description:		加读锁判断链表中是否有结点包含数据list_node
+ * Time complexity:	O(n)
+ * Input:	
+ *		shared:		LINK_LIST_SHARED*类型，句柄地址
+ *		list_node:	LIST_NODE类型，查找的数据
+ * Output:	
+ * Return:			int类型，找到返回1，没有找到返回0，操作失败返回负数
+ */
+int LinkList_SharedContains(LINK_LIST_SHARED* shared, LIST_NODE list_node)
+{
+	// 将LINK_LIST_SHARED类型的地址转换为LINK_LIST_SHARED_METADATA类型的地址
+	LINK_LIST_SHARED_METADATA* internal_shared = (LINK_LIST_SHARED_METADATA*)shared;
+
+	int result = 0;
+
+	// 参数检查
+	if (shared == NULL)
+	{
+		printf("func LinkList_SharedContains() err: shared == NULL\n");
+		return -1;
+	}
+
+	// 加读锁，其他读者可以同时进入
+	if (pthread_rwlock_rdlock(&internal_shared->lock) != 0)
+	{
+		printf("func LinkList_SharedContains() err: pthread_rwlock_rdlock() != 0\n");
+		return -1;
+	}
+	result = (LinkList_FindNode((LINK_LIST_METADATA*)internal_shared->link_list, list_node) != NULL) ? 1 : 0;
+	pthread_rwlock_unlock(&internal_shared->lock);
+
+	return result;
+}
+
+
+
+/*
+ * Function:		LinkList_SharedContainsBatch()
+ * Description:		只加一次读锁，依次查找list_nodes中的count个数据
+ * Time complexity:	O(count*n)
+ * Input:	
+ *		shared:		LINK_LIST_SHARED*类型，句柄地址
+ *		list_nodes:	LIST_NODE[]类型，查找的count个数据
+ *		count:		int类型，查找的个数
+ * Output:	
+ *		results:	int[]类型，results[i]为list_nodes[i]的查找结果
+ * Return:			int类型，操作成功返回0，否则返回负数
+ */
+int LinkList_SharedContainsBatch(LINK_LIST_SHARED* shared, LIST_NODE list_nodes[], int count, int results[])
+{
+	// 将LINK_LIST_SHARED类型的地址转换为LINK_LIST_SHARED_METADATA类型的地址
+	LINK_LIST_SHARED_METADATA* internal_shared = (LINK_LIST_SHARED_METADATA*)shared;
+
+	int result = 0;
+	int i = 0;
+
+	// 参数检查
+	if (shared == NULL || list_nodes == NULL || results == NULL || count < 0)
+	{
+		printf("func LinkList_SharedContainsBatch() err: shared == NULL || list_nodes == NULL || results == NULL || count < 0\n");
+		return -1;
+	}
+
+	// 加读锁，其他读者可以同时进入
+	if (pthread_rwlock_rdlock(&internal_shared->lock) != 0)
+	{
+		printf("func LinkList_SharedContainsBatch() err: pthread_rwlock_rdlock() != 0\n");
+		return -1;
+	}
+	for (i = 0; i < count; ++i)
+	{
+		results[i] = (LinkList_FindNode((LINK_LIST_METADATA*)internal_shared->link_list, list_nodes[i]) != NULL) ? 1 : 0;
+	}
+	pthread_rwlock_unlock(&internal_shared->lock);
+
+	return result;
+}
+
+
+
+/*
+ * Function:		LinkList_SharedPushBack()
+ * Description:		加写锁在表尾插入数据list_node
+ * Time complexity:	O(1)
+ * Input:	
+ *		shared:		LINK_LIST_SHARED*类型，句柄地址
+ *		list_node:	LIST_NODE类型，插入的数据
+ * Output:	
+ * Return:			int类型，操作成功返回0，否则返回负数
+ */
+int LinkList_SharedPushBack(LINK_LIST_SHARED* shared, LIST_NODE list_node)
+{
+	// 将LINK_LIST_SHARED类型的地址转换为LINK_LIST_SHARED_METADATA类型的地址
+	LINK_LIST_SHARED_METADATA* internal_shared = (LINK_LIST_SHARED_METADATA*)shared;
+
+	int result = 0;
+
+	// 参数检查
+	if (shared == NULL)
+	{
+		printf("func LinkList_SharedPushBack() err: shared == NULL\n");
+		return -1;
+	}
+
+	// 加写锁，独占链表
+	if (pthread_rwlock_wrlock(&internal_shared->lock) != 0)
+	{
+		printf("func LinkList_SharedPushBack() err: pthread_rwlock_wrlock() != 0\n");
+		return -1;
+	}
+	result = LinkList_PushBack((LINK_LIST_METADATA*)internal_shared->link_list, list_node);
+	pthread_rwlock_unlock(&internal_shared->lock);
+
+	return result;
+}
+
+
+
+/*
+ * Function:		LinkList_SharedPushBackBatch()
+ * Description:		只加一次写锁，依次在表尾插入list_nodes中的count个数据，结点池中的空闲结点不够时先一次准备好
+ * Time complexity:	O(count)
+ * Input:	
+ *		shared:		LINK_LIST_SHARED*类型，句柄地址
+ *		list_nodes:	LIST_NODE[]类型，插入的count个数据
+ *		count:		int类型，插入的个数
+ * Output:	
+ * Return:			int类型，操作成功返回0，否则返回负数
+ */
+int LinkList_SharedPushBackBatch(LINK_LIST_SHARED* shared, LIST_NODE list_nodes[], int count)
+{
+	// 将LINK_LIST_SHARED类型的地址转换为LINK_LIST_SHARED_METADATA类型的地址
+	LINK_LIST_SHARED_METADATA* internal_shared = (LINK_LIST_SHARED_METADATA*)shared;
+
+	LINK_LIST_METADATA* header = NULL;
+	int result = 0;
+	int i = 0;
+
+	// 参数检查
+	if (shared == NULL || list_nodes == NULL || count < 0)
+	{
+		printf("func LinkList_SharedPushBackBatch() err: shared == NULL || list_nodes == NULL || count < 0\n");
+		return -1;
+	}
+
+	// 加写锁，独占链表
+	if (pthread_rwlock_wrlock(&internal_shared->lock) != 0)
+	{
+		printf("func LinkList_SharedPushBackBatch() err: pthread_rwlock_wrlock() != 0\n");
+		return -1;
+	}
+	header = (LINK_LIST_METADATA*)internal_shared->link_list;
+	result = LinkList_Reserve(internal_shared->link_list, header->length + count);
+	for (i = 0; i < count && result == 0; ++i)
+	{
+		result = LinkList_PushBack(header, list_nodes[i]);
+	}
+	pthread_rwlock_unlock(&internal_shared->lock);
+
+	return result;
+}
+
+
+
+/*
+ * Function:		LinkList_SharedPopFront()
+ * Description:		加写锁删除第一个结点，空表时不输出错误信息
+ * Time complexity:	O(1)
+ * Input:	
+ *		shared:		LINK_LIST_SHARED*类型，句柄地址
+ * Output:	
+ * Return:			LIST_NODE类型，被删除的结点的数据，空表或操作失败返回NULL
+ */
+LIST_NODE LinkList_SharedPopFront(LINK_LIST_SHARED* shared)
+{
+	// 将LINK_LIST_SHARED类型的地址转换为LINK_LIST_SHARED_METADATA类型的地址
+	LINK_LIST_SHARED_METADATA* internal_shared = (LINK_LIST_SHARED_METADATA*)shared;
+
+	LIST_NODE result = NULL;
+
+	// 参数检查
+	if (shared == NULL)
+	{
+		printf("func LinkList_SharedPopFront() err: shared == NULL\n");
+		return NULL;
+	}
+
+	// 加写锁，独占链表
+	if (pthread_rwlock_wrlock(&internal_shared->lock) != 0)
+	{
+		printf("func LinkList_SharedPopFront() err: pthread_rwlock_wrlock() != 0\n");
+		return NULL;
+	}
+	if (LinkList_IsEmpty(internal_shared->link_list) == 0)
+	{
+		LinkList_ResetSlider(internal_shared->link_list);
+		result = LinkList_DeleteSlider(internal_shared->link_list);
+	}
+	pthread_rwlock_unlock(&internal_shared->lock);
+
+	return result;
+}
+
+
+
+/*
+ * Function:		LinkList_SharedRemove()
+ * Description:		加写锁删除第一个包含数据list_node的结点
+ * Time complexity:	O(n)
+ * Input:	
+ *		shared:		LINK_LIST_SHARED*类型，句柄地址
+ *		list_node:	LIST_NODE类型，删除的数据
+ * Output:	
+ * Return:			int类型，操作成功返回0，没有找到返回-2，操作失败返回其他负数
+ */
+int LinkList_SharedRemove(LINK_LIST_SHARED* shared, LIST_NODE list_node)
+{
+	// 将LINK_LIST_SHARED类型的地址转换为LINK_LIST_SHARED_METADATA类型的地址
+	LINK_LIST_SHARED_METADATA* internal_shared = (LINK_LIST_SHARED_METADATA*)shared;
+
+	LINK_LIST_METADATA* header = NULL;
+	LINK* node = NULL;
+	int result = 0;
+
+	// 参数检查
+	if (shared == NULL)
+	{
+		printf("func LinkList_SharedRemove() err: shared == NULL\n");
+		return -1;
+	}
+
+	// 加写锁，独占链表
+	if (pthread_rwlock_wrlock(&internal_shared->lock) != 0)
+	{
+		printf("func LinkList_SharedRemove() err: pthread_rwlock_wrlock() != 0\n");
+		return -1;
+	}
+	header = (LINK_LIST_METADATA*)internal_shared->link_list;
+	node = LinkList_FindNode(header, list_node);
+	if (node == NULL)
+	{
+		result = -2;
+	}
+	else
+	{
+		header->slider = node;
+		LinkList_DeleteSlider(internal_shared->link_list);
+	}
+	pthread_rwlock_unlock(&internal_shared->lock);
+
+	return result;
+}
+
+
+
+/*
+ * Function:		LinkList_SharedTraverse()
+ * Description:		加读锁执行LinkList_TraverseEx()
+ * Time complexity:	O(n)
+ * Input:	
+ *		shared:		LINK_LIST_SHARED*类型，句柄地址
+ *		visit:		int (*)(LIST_NODE, void*)类型，函数指针
+ *		ctx:		void*类型，原样传给visit()的调用者数据
+ * Output:	
+ * Return:			int类型，与LinkList_TraverseEx()相同
+ */
+int LinkList_SharedTraverse(LINK_LIST_SHARED* shared, int (*visit)(LIST_NODE node, void* ctx), void* ctx)
+{
+	// 将LINK_LIST_SHARED类型的地址转换为LINK_LIST_SHARED_METADATA类型的地址
+	LINK_LIST_SHARED_METADATA* internal_shared = (LINK_LIST_SHARED_METADATA*)shared;
+
+	int result = 0;
+
+	// 参数检查
+	if (shared == NULL)
+	{
+		printf("func LinkList_SharedTraverse() err: shared == NULL\n");
+		return -1;
+	}
+
+	// 加读锁，其他读者可以同时进入
+	if (pthread_rwlock_rdlock(&internal_shared->lock) != 0)
+	{
+		printf("func LinkList_SharedTraverse() err: pthread_rwlock_rdlock() != 0\n");
+		return -1;
+	}
+	result = LinkList_TraverseEx(internal_shared->link_list, visit, ctx);
+	pthread_rwlock_unlock(&internal_shared->lock);
+
+	return result;
+}
@@ -5,17 +5,59 @@
  * Description:	C语言双向循环链表通用库的实现的头文件，该文件包含了双向循环链表类型的声明、结点结构体的声明和链表API的声明，实现在文件link_list.c中。为了发挥双向循环链表的优势，该实现刻意弱化了下标标识结点位置，而是更多地通过游标来指示结点位置。
  * History:	1. 2021.10.30 创建并完成初始版本
  *			2. 2021.11.07 对用户隐藏链表指针域，用户的业务数据中不在需要包含指针域
+ *			3. 2026.10.19 增加带软件预取的遍历LinkList_TraversePrefetch()和多链表交错查找LinkList_SetSliderBatch()
+ *			4. 2026.10.19 增加带调用者数据、可提前结束的遍历LinkList_TraverseEx()
+ *			5. 2026.10.19 结点改为从链表自己的结点池中分配，增加LinkList_Reserve()
+ *			6. 2026.10.19 公开指针域LINK，增加侵入式链表API：调用者把LINK嵌入自己的结构体，插入删除遍历都不申请内存
+ *			7. 2026.10.19 增加基于LINK的无锁多生产者单消费者队列LINK_QUEUE
+ *			8. 2026.10.19 增加用读写锁保护的线程安全句柄LINK_LIST_SHARED及其批量API
  **********************************************************************************************************************************************/
 
 #ifndef _LINK_LIST_H_
 #define _LINK_LIST_H_
 
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C"{
 #endif
 
 typedef void	LINK_LIST;			// 对外的链式线性表类型
 typedef void*	LIST_NODE;			// 对外展示的结点类型
+typedef void	LINK_LIST_SHARED;	// 对外的线程安全的链表句柄类型
+
+/* 链表的指针域，侵入式链表中由调用者嵌入自己的结构体，另用一个LINK作为表头 */
+typedef struct LINK{
+	struct LINK* next;				// 指向下一结点
+	struct LINK* prior;				// 指向前一结点
+}LINK;
+
+#define LINK_LIST_PREFETCH_DISTANCE		4			// 带预取的遍历中，预取指针领先当前结点的结点数
+
+#define LINK_QUEUE_CACHE_LINE			64			// 缓存行大小，LINK_QUEUE中生产者和消费者使用的成员分开放在不同的缓存行
+
+/* 无锁多生产者单消费者队列（Vyukov算法），结点是调用者结构体中嵌入的LINK，只使用其next。由调用者定义并用LinkList_QueueInit()初始化 */
+typedef struct LINK_QUEUE{
+	LINK*	head;											// 最后入队的结点，生产者用原子交换更新
+	char	pad[LINK_QUEUE_CACHE_LINE - sizeof(LINK*)];		// 使head与消费者使用的成员不在同一缓存行
+	LINK*	tail;											// 下一个出队的结点，只有消费者访问
+	LINK	stub;											// 哨兵结点，队列为空时head和tail都指向它
+}LINK_QUEUE;
+
+/* 由嵌入在type类型结构体中名为member的LINK的地址ptr，得到该结构体的地址 */
+#define LINK_CONTAINER_OF(ptr, type, member)	((type*)((char*)(ptr) - offsetof(type, member)))
+
+/* 依次令pos指向表头head之后的每个LINK，循环中不能删除pos */
+#define LinkList_ForEach(pos, head)	\
+	for ((pos) = (head)->next; (pos) != (head); (pos) = (pos)->next)
+
+/* 与LinkList_ForEach()相同，但事先把后继保存在tmp中，循环中可以删除pos */
+#define LinkList_ForEachSafe(pos, tmp, head)	\
+	for ((pos) = (head)->next, (tmp) = (pos)->next; (pos) != (head); (pos) = (tmp), (tmp) = (pos)->next)
+
+/* 依次令entry指向表头head之后每个LINK所在的type类型结构体，member为LINK在结构体中的成员名，循环中不能删除entry */
+#define LinkList_ForEachEntry(entry, head, type, member)	\
+	for ((entry) = LINK_CONTAINER_OF((head)->next, type, member); &(entry)->member != (head); (entry) = LINK_CONTAINER_OF((entry)->member.next, type, member))
 
 
 /*
@@ -45,7 +87,7 @@ int LinkList_Destroy(LINK_LIST* link_list);
 
 /*
  * Function:		LinkList_Clear()
- * Description:		将链表置为空表
+ * Description:		将链表置为空表，结点回收到链表的结点池中，销毁链表时才释放
  * Time complexity:	O(n)
  * Input:	
  *		link_list:	LINK_LIST*类型，链表的地址	
@@ -200,6 +242,350 @@ int LinkList_SetSlider(LINK_LIST* link_list, LIST_NODE list_node);
  */
 int LinkList_Traverse(LINK_LIST* link_list,	int (*visit)(LIST_NODE node));
 
+
+
+/*
+ * Function:		LinkList_TraverseEx()
+ * Description:		从第一个结点开始遍历链表，以每个结点的数据和ctx为参数调用visit()，visit()返回非0时停止遍历。
+ *					ctx原样传给visit()，调用者的状态不必放在全局变量中，同时进行的多个遍历互不影响；提前停止可以用来查找
+ * Time complexity:	O(n)
+ * Input:	
+ *		link_list:	LINK_LIST*类型。链表的地址。	
+ *		visit:		int (*)(LIST_NODE, void*)类型，函数指针，第一个参数为结点数据，第二个参数为ctx，返回0继续，返回非0停止
+ *		ctx:		void*类型，原样传给visit()的调用者数据，可以为NULL
+ * Output:	
+ * Return:			int类型，visit()返回非0的结点序号（从0开始），全部访问完则返回链表长度，操作失败返回负数
+ */
+int LinkList_TraverseEx(LINK_LIST* link_list, int (*visit)(LIST_NODE node, void* ctx), void* ctx);
+
+
+
+/*
+ * Function:		LinkList_TraversePrefetch()
+ * Description:		与LinkList_Traverse()相同，但另有一个预取指针领先当前结点LINK_LIST_PREFETCH_DISTANCE个结点，
+ *					提前预取它后继结点的指针域和它的数据，使访存延迟与visit()的执行重叠。结点在内存中分散、visit()需要读取数据时效果明显
+ * Time complexity:	O(n)
+ * Input:	
+ *		link_list:	LINK_LIST*类型。链表的地址。	
+ *		visit:		int (*)(LIST_NODE)类型，函数指针，每个结点的数据执行的操作
+ * Output:	
+ * Return:			int类型，操作成功返回0，否则返回其他值
+ */
+int LinkList_TraversePrefetch(LINK_LIST* link_list, int (*visit)(LIST_NODE node));
+
+
+
+/*
+ * Function:		LinkList_SetSliderBatch()
+ * Description:		对count个链表分别执行LinkList_SetSlider()，list_nodes[i]在link_lists[i]中查找。
+ *					各链表的查找交错进行，每轮每个链表前进一个结点并预取下一个结点，多个链表的访存延迟相互重叠。找不到时不输出错误信息
+ * Time complexity:	O(n1 + n2 + ... + ncount)
+ * Input:	
+ *		link_lists:	LINK_LIST*[]类型，count个链表的地址，可以重复
+ *		list_nodes:	LIST_NODE[]类型，在每个链表中查找的数据
+ *		count:		int类型，链表个数
+ * Output:	
+ *		results:	int[]类型，results[i]为第i个查找的结果：找到并移动了游标为0，没有找到为-2，参数错误为-1
+ * Return:			int类型，操作成功返回0，否则返回其他值
+ */
+int LinkList_SetSliderBatch(LINK_LIST* link_lists[], LIST_NODE list_nodes[], int count, int results[]);
+
+
+
+/*
+ * Function:		LinkList_Reserve()
+ * Description:		预先准备结点，使链表中的结点数与空闲结点数之和至少为node_num，之后长度不超过node_num时插入删除都不再申请释放内存。
+ *					删除的结点不归还系统，而是留在链表的空闲链表中，链表销毁时才释放
+ * Time complexity:	O(node_num)
+ * Input:	
+ *		link_list:	LINK_LIST*类型，链表的地址	
+ *		node_num:	int类型，需要的结点数
+ * Output:	
+ * Return:			int类型，操作成功返回0，否则返回负数
+ */
+int LinkList_Reserve(LINK_LIST* link_list, int node_num);
+
+
+
+/*
+ * Function:		LinkList_LinkInit()
+ * Description:		把head初始化为侵入式链表的空表表头，next和prior都指向自己。侵入式链表是带表头的双向循环链表，
+ *					表头只是一个LINK，结点是调用者结构体中嵌入的LINK，结点的空间由调用者管理，链表的操作不申请也不释放内存
+ * Time complexity:	O(1)
+ * Input:	
+ *		head:		LINK*类型，表头的地址
+ * Output:	
+ * Return:			int类型，操作成功返回0，否则返回负数
+ */
+int LinkList_LinkInit(LINK* head);
+
+
+
+/*
+ * Function:		LinkList_LinkIsEmpty()
+ * Description:		判断侵入式链表是否为空表
+ * Time complexity:	O(1)
+ * Input:	
+ *		head:		const LINK*类型，表头的地址
+ * Output:	
+ * Return:			int类型，空表返回1，否则返回0，参数错误返回负数
+ */
+int LinkList_LinkIsEmpty(const LINK* head);
+
+
+
+/*
+ * Function:		LinkList_LinkInsertAfter()
+ * Description:		把结点link插入到pos之后，pos为表头时插入到表头位置
+ * Time complexity:	O(1)
+ * Input:	
+ *		pos:		LINK*类型，表头或链表中的结点
+ *		link:		LINK*类型，插入的结点，不能已在某个链表中
+ * Output:	
+ * Return:			int类型，操作成功返回0，否则返回负数
+ */
+int LinkList_LinkInsertAfter(LINK* pos, LINK* link);
+
+
+
+/*
+ * Function:		LinkList_LinkInsertBefore()
+ * Description:		把结点link插入到pos之前，pos为表头时插入到表尾
+ * Time complexity:	O(1)
+ * Input:	
+ *		pos:		LINK*类型，表头或链表中的结点
+ *		link:		LINK*类型，插入的结点，不能已在某个链表中
+ * Output:	
+ * Return:			int类型，操作成功返回0，否则返回负数
+ */
+int LinkList_LinkInsertBefore(LINK* pos, LINK* link);
+
+
+
+/*
+ * Function:		LinkList_LinkRemove()
+ * Description:		把结点link从所在的链表中摘下，摘下后link的next和prior指向自己，可以直接再次插入，重复摘下也没有影响
+ * Time complexity:	O(1)
+ * Input:	
+ *		link:		LINK*类型，链表中的结点，不能是表头
+ * Output:	
+ * Return:			int类型，操作成功返回0，否则返回负数
+ */
+int LinkList_LinkRemove(LINK* link);
+
+
+
+/*
+ * Function:		LinkList_LinkCount()
+ * Description:		计算侵入式链表的结点数，侵入式链表不记录长度
+ * Time complexity:	O(n)
+ * Input:	
+ *		head:		const LINK*类型，表头的地址
+ * Output:	
+ * Return:			int类型，结点数，参数错误返回负数
+ */
+int LinkList_LinkCount(const LINK* head);
+
+
+
+/*
+ * Function:		LinkList_QueueInit()
+ * Description:		把queue初始化为空的无锁多生产者单消费者队列。不能与Push()、Pop()同时调用，队列本身不申请内存，不需要销毁
+ * Time complexity:	O(1)
+ * Input:	
+ *		queue:		LINK_QUEUE*类型，队列的地址
+ * Output:	
+ * Return:			int类型，操作成功返回0，否则返回负数
+ */
+int LinkList_QueueInit(LINK_QUEUE* queue);
+
+
+
+/*
+ * Function:		LinkList_QueuePush()
+ * Description:		结点link入队，任意多个线程可以同时调用。只有一次原子交换和一次写，没有循环重试，
+ *					生产者之间互不等待（wait-free）；同一生产者入队的结点按入队顺序出队
+ * Time complexity:	O(1)
+ * Input:	
+ *		queue:		LINK_QUEUE*类型，队列的地址
+ *		link:		LINK*类型，入队的结点，出队之前不能再入队或插入其他链表
+ * Output:	
+ * Return:			int类型，操作成功返回0，否则返回负数
+ */
+int LinkList_QueuePush(LINK_QUEUE* queue, LINK* link);
+
+
+
+/*
+ * Function:		LinkList_QueuePop()
+ * Description:		队首结点出队，同一时刻只能有一个线程调用。某个生产者正在入队、还没有连上后继时，其后的结点暂时不可见，此时同样返回NULL，
+ *					稍后再试即可
+ * Time complexity:	O(1)
+ * Input:	
+ *		queue:		LINK_QUEUE*类型，队列的地址
+ * Output:	
+ * Return:			LINK*类型，出队的结点，队列为空时返回NULL
+ */
+LINK* LinkList_QueuePop(LINK_QUEUE* queue);
+
+
+
+/*
+ * Function:		LinkList_QueuePopBatch()
+ * Description:		连续出队至多max_count个结点，同一时刻只能有一个线程调用，与LinkList_QueuePop()的限制相同。
+ *					消费者一次取走一批，取结点的循环中没有函数调用
+ * Time complexity:	O(max_count)
+ * Input:	
+ *		queue:		LINK_QUEUE*类型，队列的地址
+ *		max_count:	int类型，最多出队的结点数
+ * Output:	
+ *		out_links:	LINK*[]类型，按出队顺序存放出队的结点，至少有max_count个元素
+ * Return:			int类型，出队的结点数，队列为空时返回0，操作失败返回负数
+ */
+int LinkList_QueuePopBatch(LINK_QUEUE* queue, LINK* out_links[], int max_count);
+
+
+
+/*
+ * Function:		LinkList_CreateShared()
+ * Description:		构造一个线程安全的句柄，接管已构造好的链表link_list，之后只能通过句柄访问它，LinkList_DestroyShared()时一起销毁。
+ *					句柄内有一把读写锁：查找、遍历加读锁，多个线程可以同时进行；插入、删除加写锁。游标是单线程的概念，句柄的API不使用也不保留游标位置。
+ *					不需要线程安全的链表不受影响，没有加锁的开销。每个Shared函数只加锁一次，批量API一次加锁完成多个结点的操作
+ * Time complexity:	O(1)
+ * Input:	
+ *		link_list:	LINK_LIST*类型，由LinkList_Create()构造的链表
+ * Output:	
+ * Return:			LINK_LIST_SHARED*类型，创建成功则返回句柄地址，否则返回NULL，此时link_list仍归调用者所有
+ */
+LINK_LIST_SHARED* LinkList_CreateShared(LINK_LIST* link_list);
+
+
+
+/*
+ * Function:		LinkList_DestroyShared()
+ * Description:		销毁线程安全的句柄和它接管的链表，调用时不能有其他线程正在使用该句柄
+ * Time complexity:	O(n)
+ * Input:	
+ *		shared:		LINK_LIST_SHARED*类型，句柄地址
+ * Output:	
+ * Return:			int类型，操作成功返回0，否则返回负数
+ */
+int LinkList_DestroyShared(LINK_LIST_SHARED* shared);
+
+
+
+/*
+ * Function:		LinkList_SharedGetLength()
+ * Description:		加读锁获取链表长度
+ * Time complexity:	O(1)
+ * Input:	
+ *		shared:		LINK_LIST_SHARED*类型，句柄地址
+ * Output:	
+ * Return:			int类型，链表长度，操作失败返回负数
+ */
+int LinkList_SharedGetLength(LINK_LIST_SHARED* shared);
+
+
+
+/*
+ * Function:		LinkList_SharedContains()
+ * Description:		加读锁判断链表中是否有结点包含数据list_node，不移动游标
+ * Time complexity:	O(n)
+ * Input:	
+ *		shared:		LINK_LIST_SHARED*类型，句柄地址
+ *		list_node:	LIST_NODE类型，查找的数据
+ * Output:	
+ * Return:			int类型，找到返回1，没有找到返回0，操作失败返回负数
+ */
+int LinkList_SharedContains(LINK_LIST_SHARED* shared, LIST_NODE list_node);
+
+
+
+/*
+ * Function:		LinkList_SharedContainsBatch()
+ * Description:		只加一次读锁，对list_nodes中的count个数据分别执行LinkList_SharedContains()，所有结果来自同一时刻的链表
+ * Time complexity:	O(count*n)
+ * Input:	
+ *		shared:		LINK_LIST_SHARED*类型，句柄地址
+ *		list_nodes:	LIST_NODE[]类型，查找的count个数据
+ *		count:		int类型，查找的个数
+ * Output:	
+ *		results:	int[]类型，results[i]为list_nodes[i]的查找结果，找到为1，没有找到为0
+ * Return:			int类型，操作成功返回0，否则返回负数
+ */
+int LinkList_SharedContainsBatch(LINK_LIST_SHARED* shared, LIST_NODE list_nodes[], int count, int results[]);
+
+
+
+/*
+ * Function:		LinkList_SharedPushBack()
+ * Description:		加写锁在链表的最后一个结点之后插入数据list_node
+ * Time complexity:	O(1)
+ * Input:	
+ *		shared:		LINK_LIST_SHARED*类型，句柄地址
+ *		list_node:	LIST_NODE类型，插入的数据
+ * Output:	
+ * Return:			int类型，操作成功返回0，否则返回负数
+ */
+int LinkList_SharedPushBack(LINK_LIST_SHARED* shared, LIST_NODE list_node);
+
+
+
+/*
+ * Function:		LinkList_SharedPushBackBatch()
+ * Description:		只加一次写锁，依次在表尾插入list_nodes中的count个数据，其他线程看到的是全部插入之前或之后的链表
+ * Time complexity:	O(count)
+ * Input:	
+ *		shared:		LINK_LIST_SHARED*类型，句柄地址
+ *		list_nodes:	LIST_NODE[]类型，插入的count个数据，不能含NULL
+ *		count:		int类型，插入的个数
+ * Output:	
+ * Return:			int类型，操作成功返回0，否则返回负数，此时前面的数据可能已经插入
+ */
+int LinkList_SharedPushBackBatch(LINK_LIST_SHARED* shared, LIST_NODE list_nodes[], int count);
+
+
+
+/*
+ * Function:		LinkList_SharedPopFront()
+ * Description:		加写锁删除第一个结点
+ * Time complexity:	O(1)
+ * Input:	
+ *		shared:		LINK_LIST_SHARED*类型，句柄地址
+ * Output:	
+ * Return:			LIST_NODE类型，被删除的结点的数据，空表或操作失败返回NULL
+ */
+LIST_NODE LinkList_SharedPopFront(LINK_LIST_SHARED* shared);
+
+
+
+/*
+ * Function:		LinkList_SharedRemove()
+ * Description:		加写锁删除第一个包含数据list_node的结点
+ * Time complexity:	O(n)
+ * Input:	
+ *		shared:		LINK_LIST_SHARED*类型，句柄地址
+ *		list_node:	LIST_NODE类型，删除的数据
+ * Output:	
+ * Return:			int类型，操作成功返回0，没有找到返回-2，操作失败返回其他负数
+ */
+int LinkList_SharedRemove(LINK_LIST_SHARED* shared, LIST_NODE list_node);
+
+
+
+/*
+ * Function:		LinkList_SharedTraverse()
+ * Description:		加读锁执行LinkList_TraverseEx()，多个线程可以同时遍历，visit()不能修改链表，也不能调用同一句柄的加写锁的函数
+ * Time complexity:	O(n)
+ * Input:	
+ *		shared:		LINK_LIST_SHARED*类型，句柄地址
+ *		visit:		int (*)(LIST_NODE, void*)类型，函数指针，返回0继续，返回非0停止
+ *		ctx:		void*类型，原样传给visit()的调用者数据，可以为NULL
+ * Output:	
+ * Return:			int类型，与LinkList_TraverseEx()相同
+ */
+int LinkList_SharedTraverse(LINK_LIST_SHARED* shared, int (*visit)(LIST_NODE node, void* ctx), void* ctx);
+
 #ifdef __cplusplus
 }
 #endif
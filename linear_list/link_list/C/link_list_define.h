@@ -0,0 +1,312 @@
+/***********************************************************************************************************************************************
+ * File name:	link_list_define.h
+ * Author:	guoke
+ * Date:	2026.10.19
+ * Description:	C语言类型专用双向循环链表的生成宏，只有头文件。LINK_LIST_DEFINE(name, type, eq)生成元素类型为type的链表类型name、
+ *				结点类型name_NODE和一组static inline函数name_Create()、name_InsertAfterSlider()等，数据按值存放在结点中，
+ *				每个元素只申请一次内存，不再需要调用者另外申请数据。
+ *				link_list.h中的通用链表通过函数指针调用visit()，查找时比较的是指针；这里的比较eq直接写在生成的循环中，
+ *				可以是函数也可以是宏，编译器能够内联，按值查找不需要额外的间接调用。
+ *				例如：
+ *					#define INT_EQ(a, b)	((a) == (b))
+ *					LINK_LIST_DEFINE(IntLinkList, int, INT_EQ)
+ *					IntLinkList* list = IntLinkList_Create();
+ *					IntLinkList_InsertAfterSlider(list, 42);
+ *					IntLinkList_SetSlider(list, 42);
+ *				同一个name在一个翻译单元中只能生成一次，多个源文件各自生成同名的static函数互不影响。
+ * History:	1. 2026.10.19 创建并完成初始版本
+ **********************************************************************************************************************************************/
+
+#ifndef _LINK_LIST_DEFINE_H_
+#define _LINK_LIST_DEFINE_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/*
+ * Macro:			LINK_LIST_DEFINE()
+ * Description:		生成类型专用的双向循环链表，生成的类型和函数如下，游标的语义与link_list.h中同名的API相同：
+ *					name_NODE								结点类型，成员next、prior、data
+ *					name									链表类型，成员first、length、slider
+ *					name* name_Create()						构造一个空链表，失败返回NULL
+ *					int name_Destroy(list)					销毁链表
+ *					int name_Clear(list)					置为空表
+ *					int name_GetLength(list)				返回长度
+ *					int name_IsEmpty(list)					空表返回1，否则返回0
+ *					int name_ResetSlider(list)				游标指向第一个结点，空表置NULL
+ *					type* name_GetSlider(list)				返回游标所指结点数据的地址，空表返回NULL
+ *					type* name_SliderForward(list)			返回游标所指结点数据的地址，游标指向后继结点
+ *					type* name_SliderBackward(list)			返回游标所指结点数据的地址，游标指向前驱结点
+ *					int name_InsertBeforeSlider(list, data)	在游标之前插入data的副本，游标指向新结点
+ *					int name_InsertAfterSlider(list, data)	在游标之后插入data的副本，游标指向新结点
+ *					int name_DeleteSlider(list, out_data)	删除游标所指结点，游标指向其后继，out_data不为NULL时存放被删除的数据
+ *					int name_SetSlider(list, data)			游标指向第一个满足eq(data, 结点数据)的结点，没有则返回-2且游标不变
+ *					int name_Traverse(list, visit)			依次以每个结点数据的地址调用visit()，visit()返回非0时停止并返回负数
+ *					出错时返回负数并打印错误信息，与通用库一致
+ * Input:
+ *		name:		生成的类型名，同时是函数名的前缀
+ *		type:		数据类型，按值拷贝
+ *		eq:			int eq(type a, type b)形式的函数或宏，相等返回非0
+ */
+#define LINK_LIST_DEFINE(name, type, eq)																			\
+																													\
+typedef struct name##_NODE{																							\
+	struct name##_NODE* next;		/* 后继结点 */																	\
+	struct name##_NODE* prior;		/* 前驱结点 */																	\
+	type data;						/* 数据域，按值存放 */															\
+}name##_NODE;																										\
+																													\
+typedef struct name{																								\
+	name##_NODE* first;				/* 第一个结点，空表为NULL */													\
+	int length;						/* 链表长度 */																	\
+	name##_NODE* slider;			/* 游标，空表为NULL */															\
+}name;																												\
+																													\
+static inline name* name##_Create(void)																				\
+{																													\
+	name* list = (name*)malloc(sizeof(name));																		\
+	if (list == NULL)																								\
+	{																												\
+		printf("func " #name "_Create() err: list == NULL\n");														\
+		return NULL;																								\
+	}																												\
+	list->first = NULL;																								\
+	list->length = 0;																								\
+	list->slider = NULL;																							\
+	return list;																									\
+}																													\
+																													\
+static inline int name##_Clear(name* list)																			\
+{																													\
+	name##_NODE* node = NULL;																						\
+	name##_NODE* next = NULL;																						\
+	int i = 0;																										\
+	if (list == NULL)																								\
+	{																												\
+		printf("func " #name "_Clear() err: list == NULL\n");														\
+		return -1;																									\
+	}																												\
+	node = list->first;																								\
+	for (i = 0; i < list->length; ++i)																				\
+	{																												\
+		next = node->next;																							\
+		free(node);																									\
+		node = next;																								\
+	}																												\
+	list->first = NULL;																								\
+	list->length = 0;																								\
+	list->slider = NULL;																							\
+	return 0;																										\
+}																													\
+																													\
+static inline int name##_Destroy(name* list)																		\
+{																													\
+	if (list == NULL)																								\
+	{																												\
+		printf("func " #name "_Destroy() err: list == NULL\n");														\
+		return -1;																									\
+	}																												\
+	name##_Clear(list);																								\
+	free(list);																										\
+	return 0;																										\
+}																													\
+																													\
+static inline int name##_GetLength(name* list)																		\
+{																													\
+	if (list == NULL)																								\
+	{																												\
+		printf("func " #name "_GetLength() err: list == NULL\n");													\
+		return -1;																									\
+	}																												\
+	return list->length;																							\
+}																													\
+																													\
+static inline int name##_IsEmpty(name* list)																		\
+{																													\
+	if (list == NULL)																								\
+	{																												\
+		printf("func " #name "_IsEmpty() err: list == NULL\n");														\
+		return -1;																									\
+	}																												\
+	return (list->length == 0) ? 1 : 0;																				\
+}																													\
+																													\
+static inline int name##_ResetSlider(name* list)																	\
+{																													\
+	if (list == NULL)																								\
+	{																												\
+		printf("func " #name "_ResetSlider() err: list == NULL\n");													\
+		return -1;																									\
+	}																												\
+	list->slider = list->first;																						\
+	return 0;																										\
+}																													\
+																													\
+static inline type* name##_GetSlider(name* list)																	\
+{																													\
+	if (list == NULL || list->length == 0)																			\
+	{																												\
+		printf("func " #name "_GetSlider() err: list == NULL || list->length == 0\n");								\
+		return NULL;																								\
+	}																												\
+	return &list->slider->data;																						\
+}																													\
+																													\
+static inline type* name##_SliderForward(name* list)																\
+{																													\
+	if (list == NULL || list->length == 0)																			\
+	{																												\
+		printf("func " #name "_SliderForward() err: list == NULL || list->length == 0\n");							\
+		return NULL;																								\
+	}																												\
+	list->slider = list->slider->next;																				\
+	return &list->slider->prior->data;																				\
+}																													\
+																													\
+static inline type* name##_SliderBackward(name* list)																\
+{																													\
+	if (list == NULL || list->length == 0)																			\
+	{																												\
+		printf("func " #name "_SliderBackward() err: list == NULL || list->length == 0\n");							\
+		return NULL;																								\
+	}																												\
+	list->slider = list->slider->prior;																				\
+	return &list->slider->next->data;																				\
+}																													\
+																													\
+/* 申请结点并接在空表中或prior_node之后，游标指向新结点 */															\
+static inline name##_NODE* name##_LinkNew(name* list, name##_NODE* prior_node, type data)							\
+{																													\
+	name##_NODE* node = (name##_NODE*)malloc(sizeof(name##_NODE));													\
+	if (node == NULL)																								\
+	{																												\
+		printf("func " #name "_LinkNew() err: node == NULL\n");														\
+		return NULL;																								\
+	}																												\
+	node->data = data;																								\
+	if (list->length == 0)																							\
+	{																												\
+		node->next = node;																							\
+		node->prior = node;																							\
+		list->first = node;																							\
+	}																												\
+	else																											\
+	{																												\
+		node->prior = prior_node;																					\
+		node->next = prior_node->next;																				\
+		prior_node->next->prior = node;																				\
+		prior_node->next = node;																					\
+	}																												\
+	list->slider = node;																							\
+	list->length++;																									\
+	return node;																									\
+}																													\
+																													\
+static inline int name##_InsertBeforeSlider(name* list, type data)													\
+{																													\
+	int was_first = 0;																								\
+	if (list == NULL)																								\
+	{																												\
+		printf("func " #name "_InsertBeforeSlider() err: list == NULL\n");											\
+		return -1;																									\
+	}																												\
+	was_first = (list->length > 0 && list->slider == list->first);													\
+	if (name##_LinkNew(list, (list->length > 0) ? list->slider->prior : NULL, data) == NULL)						\
+	{																												\
+		return -2;																									\
+	}																												\
+	/* 在第一个结点之前插入，新结点成为第一个结点 */																\
+	if (was_first)																									\
+	{																												\
+		list->first = list->slider;																					\
+	}																												\
+	return 0;																										\
+}																													\
+																													\
+static inline int name##_InsertAfterSlider(name* list, type data)													\
+{																													\
+	if (list == NULL)																								\
+	{																												\
+		printf("func " #name "_InsertAfterSlider() err: list == NULL\n");											\
+		return -1;																									\
+	}																												\
+	return (name##_LinkNew(list, list->slider, data) == NULL) ? -2 : 0;											\
+}																													\
+																													\
+static inline int name##_DeleteSlider(name* list, type* out_data)													\
+{																													\
+	name##_NODE* node = NULL;																						\
+	if (list == NULL || list->length == 0)																			\
+	{																												\
+		printf("func " #name "_DeleteSlider() err: list == NULL || list->length == 0\n");							\
+		return -1;																									\
+	}																												\
+	node = list->slider;																							\
+	if (out_data != NULL)																							\
+	{																												\
+		*out_data = node->data;																						\
+	}																												\
+	if (list->length == 1)																							\
+	{																												\
+		list->first = NULL;																							\
+		list->slider = NULL;																						\
+	}																												\
+	else																											\
+	{																												\
+		node->prior->next = node->next;																				\
+		node->next->prior = node->prior;																			\
+		list->slider = node->next;																					\
+		if (node == list->first)																					\
+		{																											\
+			list->first = node->next;																				\
+		}																											\
+	}																												\
+	list->length--;																									\
+	free(node);																										\
+	return 0;																										\
+}																													\
+																													\
+static inline int name##_SetSlider(name* list, type data)															\
+{																													\
+	name##_NODE* node = NULL;																						\
+	int i = 0;																										\
+	if (list == NULL)																								\
+	{																												\
+		printf("func " #name "_SetSlider() err: list == NULL\n");													\
+		return -1;																									\
+	}																												\
+	/* eq()直接展开在循环中，没有间接调用 */																		\
+	node = list->first;																								\
+	for (i = 0; i < list->length; ++i, node = node->next)															\
+	{																												\
+		if (eq(data, node->data))																					\
+		{																											\
+			list->slider = node;																					\
+			return 0;																								\
+		}																											\
+	}																												\
+	return -2;																										\
+}																													\
+																													\
+static inline int name##_Traverse(name* list, int (*visit)(type* data))												\
+{																													\
+	name##_NODE* node = NULL;																						\
+	int i = 0;																										\
+	if (list == NULL || visit == NULL)																				\
+	{																												\
+		printf("func " #name "_Traverse() err: list == NULL || visit == NULL\n");									\
+		return -1;																									\
+	}																												\
+	node = list->first;																								\
+	for (i = 0; i < list->length; ++i, node = node->next)															\
+	{																												\
+		if (visit(&node->data) != 0)																				\
+		{																											\
+			printf("func " #name "_Traverse() err: visit() != 0\n");												\
+			return -2;																								\
+		}																											\
+	}																												\
+	return 0;																										\
+}
+
+#endif
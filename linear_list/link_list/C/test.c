@@ -5,11 +5,20 @@
  * Description:	C语言双向循环链表通用局link_list.h、link_list.cAPI的测试程序
  * History:	1. 2021.10.30 创建并完成初始版本
  *			2. 2021.11.07 增加测试信息提示的细节；链表库更新，测试也进行了更新，业务数据不再包含链表的指针域
+ *			3. 2026.10.19 增加带预取的遍历和多链表交错查找的测试
+ *			4. 2026.10.19 增加LINK_LIST_DEFINE()生成的类型专用链表的测试
+ *			5. 2026.10.19 增加带调用者数据、可提前结束的遍历的测试
+ *			6. 2026.10.19 增加预留结点和结点回收重用的测试
+ *			7. 2026.10.19 增加侵入式链表的测试
+ *			8. 2026.10.19 增加无锁多生产者单消费者队列的测试
+ *			9. 2026.10.19 增加线程安全句柄的测试
  **********************************************************************************************************************************************/
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <pthread.h>
 #include "link_list.h"
+#include "link_list_define.h"
 
 // TEACHER结构体
 typedef struct TEACHER{
@@ -20,6 +29,64 @@ typedef struct TEACHER{
 // TEACHER类型的print函数
 int TeacherPrint(LIST_NODE t);
 
+// 生成元素类型为int的链表IntLinkList
+#define INT_EQ(a, b)	((a) == (b))
+LINK_LIST_DEFINE(IntLinkList, int, INT_EQ)
+
+// IntLinkList的print函数
+int IntPrint(int* value);
+
+// TeacherAgeSumUntil()的调用者数据
+typedef struct AGE_SUM_CTX{
+	int age_sum;			// 年龄之和
+	TEACHER* stop;			// 遇到该TEACHER时停止
+}AGE_SUM_CTX;
+
+// 把TEACHER的年龄累加到ctx中，遇到ctx->stop时停止
+int TeacherAgeSumUntil(LIST_NODE t, void* ctx);
+
+// 嵌入了指针域的STUDENT结构体，用于侵入式链表
+typedef struct STUDENT{
+	int age;
+	char name[32];
+	LINK link;				// 侵入式链表的指针域，不必是第一个成员
+}STUDENT;
+
+#define QUEUE_PRODUCER_NUM	4			// 队列测试的生产者线程数
+#define QUEUE_ITEM_NUM		10000		// 每个生产者入队的结点数
+
+// 队列测试的结点，记录生产者和入队序号
+typedef struct QUEUE_ITEM{
+	int producer;
+	int seq;
+	LINK link;
+}QUEUE_ITEM;
+
+// 生产者线程的参数
+typedef struct QUEUE_PRODUCER{
+	LINK_QUEUE* queue;
+	QUEUE_ITEM* items;			// QUEUE_ITEM_NUM个结点
+}QUEUE_PRODUCER;
+
+// 生产者线程，依次把items中的结点入队
+void* QueueProducer(void* arg);
+
+#define SHARED_WRITER_NUM	2			// 线程安全句柄测试的写线程数
+#define SHARED_VALUE_NUM	1000		// 每个写线程插入的数据个数
+
+// 线程安全句柄测试的线程参数
+typedef struct SHARED_WORKER{
+	LINK_LIST_SHARED* shared;
+	int* values;				// SHARED_VALUE_NUM个数据
+	int found;					// 读线程最后一次批量查找中找到的个数
+}SHARED_WORKER;
+
+// 写线程，每次批量插入100个数据
+void* SharedWriter(void* arg);
+
+// 读线程，反复批量查找写线程的数据
+void* SharedReader(void* arg);
+
 int main(void)
 {
 	// 链表指针
@@ -187,6 +254,69 @@ int main(void)
 	printf("\n遍历结点：\n");
 	LinkList_Traverse(link_list, TeacherPrint);
 
+	// 带预取的遍历
+	printf("\n带预取的遍历：\n");
+	LinkList_TraversePrefetch(link_list, TeacherPrint);
+
+	// 带调用者数据的遍历
+	printf("\n带调用者数据的遍历：\n");
+	{
+		AGE_SUM_CTX sum_ctx = {0, NULL};
+		printf("TraverseEx = %d\t", LinkList_TraverseEx(link_list, TeacherAgeSumUntil, &sum_ctx));
+		printf("age_sum = %d\n", sum_ctx.age_sum);
+		sum_ctx.age_sum = 0;
+		sum_ctx.stop = &t3;
+		printf("TraverseEx(stop at t3) = %d\t", LinkList_TraverseEx(link_list, TeacherAgeSumUntil, &sum_ctx));
+		printf("age_sum = %d\n", sum_ctx.age_sum);
+	}
+
+	// 多链表交错查找
+	printf("\n多链表交错查找：\n");
+	{
+		LINK_LIST* other_list = LinkList_Create();
+		LINK_LIST* batch_lists[4];
+		LIST_NODE batch_nodes[4];
+		int batch_results[4];
+
+		LinkList_InsertAfterSlider(other_list, (LIST_NODE)(&t5));
+		LinkList_InsertAfterSlider(other_list, (LIST_NODE)(&t3));
+		batch_lists[0] = link_list;		batch_nodes[0] = (LIST_NODE)(&t4);
+		batch_lists[1] = other_list;	batch_nodes[1] = (LIST_NODE)(&t3);
+		batch_lists[2] = other_list;	batch_nodes[2] = (LIST_NODE)(&t1);
+		batch_lists[3] = NULL;			batch_nodes[3] = (LIST_NODE)(&t1);
+		LinkList_SetSliderBatch(batch_lists, batch_nodes, 4, batch_results);
+		printf("results = %d %d %d %d\n", batch_results[0], batch_results[1], batch_results[2], batch_results[3]);
+		printf("slider of link_list is ");
+		TeacherPrint(LinkList_GetSlider(link_list));
+		printf("slider of other_list is ");
+		TeacherPrint(LinkList_GetSlider(other_list));
+		LinkList_Destroy(other_list);
+	}
+
+	// 预留结点，删除的结点回收后重复使用
+	printf("\n预留结点：\n");
+	{
+		LINK_LIST* pool_list = LinkList_Create();
+		int round = 0;
+
+		printf("Reserve(8) = %d\t", LinkList_Reserve(pool_list, 8));
+		printf("Reserve(-1) = %d\n", LinkList_Reserve(pool_list, -1));
+		for (round = 0; round < 3; ++round)
+		{
+			LinkList_InsertAfterSlider(pool_list, (LIST_NODE)(&t1));
+			LinkList_InsertAfterSlider(pool_list, (LIST_NODE)(&t2));
+			LinkList_InsertBeforeSlider(pool_list, (LIST_NODE)(&t3));
+			LinkList_ResetSlider(pool_list);
+			LinkList_DeleteSlider(pool_list);
+			printf("round %d: length = %d\n", round, LinkList_GetLength(pool_list));
+		}
+		LinkList_Traverse(pool_list, TeacherPrint);
+		LinkList_Clear(pool_list);
+		printf("after Clear: length = %d\t", LinkList_GetLength(pool_list));
+		printf("Reserve(100) = %d\n", LinkList_Reserve(pool_list, 100));
+		LinkList_Destroy(pool_list);
+	}
+
 	// 删除结点
 	printf("\n删除结点：\n");
 
@@ -204,6 +334,186 @@ int main(void)
 	printf("\n销毁链表：\n");
 	LinkList_Destroy(link_list);
 
+	// 类型专用的链表
+	printf("\n类型专用的链表：\n");
+	{
+		IntLinkList* int_list = IntLinkList_Create();
+		int deleted = 0;
+
+		for (i = 1; i <= 5; ++i)
+		{
+			IntLinkList_InsertAfterSlider(int_list, i * 10);
+		}
+		IntLinkList_ResetSlider(int_list);
+		IntLinkList_InsertBeforeSlider(int_list, 5);
+		printf("length = %d\t", IntLinkList_GetLength(int_list));
+		IntLinkList_Traverse(int_list, IntPrint);
+		printf("\nSetSlider(30) = %d\t", IntLinkList_SetSlider(int_list, 30));
+		printf("slider = %d\t", *IntLinkList_GetSlider(int_list));
+		printf("SetSlider(77) = %d\t", IntLinkList_SetSlider(int_list, 77));
+		printf("slider = %d\n", *IntLinkList_GetSlider(int_list));
+		printf("forward: %d ", *IntLinkList_SliderForward(int_list));
+		printf("%d\t", *IntLinkList_SliderForward(int_list));
+		printf("backward: %d\n", *IntLinkList_SliderBackward(int_list));
+		IntLinkList_ResetSlider(int_list);
+		while (!IntLinkList_IsEmpty(int_list))
+		{
+			IntLinkList_DeleteSlider(int_list, &deleted);
+			printf("删除：%d\tlength = %d\n", deleted, IntLinkList_GetLength(int_list));
+		}
+		IntLinkList_InsertBeforeSlider(int_list, 1);
+		IntLinkList_Destroy(int_list);
+	}
+
+	// 侵入式链表
+	printf("\n侵入式链表：\n");
+	{
+		STUDENT students[4];
+		LINK head;
+		LINK* pos = NULL;
+		LINK* tmp = NULL;
+		STUDENT* student = NULL;
+
+		LinkList_LinkInit(&head);
+		printf("IsEmpty = %d\t", LinkList_LinkIsEmpty(&head));
+		for (i = 0; i < 4; ++i)
+		{
+			students[i].age = 11 + i;
+			sprintf(students[i].name, "student_%02d", i + 1);
+			LinkList_LinkInsertBefore(&head, &students[i].link);		// 依次插入到表尾
+		}
+		printf("count = %d\n", LinkList_LinkCount(&head));
+		LinkList_ForEachEntry(student, &head, STUDENT, link)
+		{
+			printf("age = %d\t name = %s\n", student->age, student->name);
+		}
+
+		// 移到表头，再删除年龄为偶数的结点
+		LinkList_LinkRemove(&students[3].link);
+		LinkList_LinkInsertAfter(&head, &students[3].link);
+		LinkList_ForEachSafe(pos, tmp, &head)
+		{
+			if (LINK_CONTAINER_OF(pos, STUDENT, link)->age % 2 == 0)
+			{
+				LinkList_LinkRemove(pos);
+			}
+		}
+		LinkList_LinkRemove(&students[1].link);			// 已摘下的结点再次摘下
+		printf("count = %d\t", LinkList_LinkCount(&head));
+		LinkList_ForEach(pos, &head)
+		{
+			printf("%s ", LINK_CONTAINER_OF(pos, STUDENT, link)->name);
+		}
+		printf("\n");
+	}
+
+	// 无锁多生产者单消费者队列
+	printf("\n无锁多生产者单消费者队列：\n");
+	{
+		LINK_QUEUE queue;
+		STUDENT students[3];
+		LINK* batch[QUEUE_PRODUCER_NUM * 8];
+		QUEUE_PRODUCER producers[QUEUE_PRODUCER_NUM];
+		pthread_t threads[QUEUE_PRODUCER_NUM];
+		int next_seq[QUEUE_PRODUCER_NUM] = {0};
+		int popped = 0;
+		int in_order = 1;
+		int count = 0;
+		int j = 0;
+
+		// 单线程：先进先出，空队列返回NULL
+		LinkList_QueueInit(&queue);
+		printf("Pop(empty) = %s\t", (LinkList_QueuePop(&queue) == NULL) ? "NULL" : "not NULL");
+		for (i = 0; i < 3; ++i)
+		{
+			students[i].age = 31 + i;
+			sprintf(students[i].name, "student_%02d", i + 1);
+			LinkList_QueuePush(&queue, &students[i].link);
+		}
+		printf("Pop = %s\t", LINK_CONTAINER_OF(LinkList_QueuePop(&queue), STUDENT, link)->name);
+		LinkList_QueuePush(&queue, &students[0].link);
+		count = LinkList_QueuePopBatch(&queue, batch, 8);
+		printf("PopBatch = %d:", count);
+		for (i = 0; i < count; ++i)
+		{
+			printf(" %s", LINK_CONTAINER_OF(batch[i], STUDENT, link)->name);
+		}
+		printf("\tPopBatch(empty) = %d\n", LinkList_QueuePopBatch(&queue, batch, 8));
+
+		// 多个生产者同时入队，消费者成批出队，每个结点恰好出队一次，同一生产者的结点保持顺序
+		for (i = 0; i < QUEUE_PRODUCER_NUM; ++i)
+		{
+			producers[i].queue = &queue;
+			producers[i].items = (QUEUE_ITEM*)malloc(sizeof(QUEUE_ITEM) * QUEUE_ITEM_NUM);
+			for (j = 0; j < QUEUE_ITEM_NUM; ++j)
+			{
+				producers[i].items[j].producer = i;
+				producers[i].items[j].seq = j;
+			}
+			pthread_create(&threads[i], NULL, QueueProducer, &producers[i]);
+		}
+		while (popped < QUEUE_PRODUCER_NUM * QUEUE_ITEM_NUM)
+		{
+			count = LinkList_QueuePopBatch(&queue, batch, QUEUE_PRODUCER_NUM * 8);
+			for (i = 0; i < count; ++i)
+			{
+				QUEUE_ITEM* item = LINK_CONTAINER_OF(batch[i], QUEUE_ITEM, link);
+				in_order = in_order && (item->seq == next_seq[item->producer]);
+				next_seq[item->producer] = item->seq + 1;
+			}
+			popped += count;
+		}
+		for (i = 0; i < QUEUE_PRODUCER_NUM; ++i)
+		{
+			pthread_join(threads[i], NULL);
+			free(producers[i].items);
+		}
+		printf("producers = %d\tpopped = %d\tin order = %d\t", QUEUE_PRODUCER_NUM, popped, in_order);
+		printf("Pop(empty) = %s\n", (LinkList_QueuePop(&queue) == NULL) ? "NULL" : "not NULL");
+	}
+
+	// 线程安全句柄
+	printf("\n线程安全句柄：\n");
+	{
+		LINK_LIST_SHARED* shared = LinkList_CreateShared(LinkList_Create());
+		int values[SHARED_WRITER_NUM][SHARED_VALUE_NUM];
+		SHARED_WORKER writers[SHARED_WRITER_NUM];
+		SHARED_WORKER readers[SHARED_WRITER_NUM];
+		pthread_t writer_threads[SHARED_WRITER_NUM];
+		pthread_t reader_threads[SHARED_WRITER_NUM];
+		int j = 0;
+
+		// 写线程和读线程同时运行
+		for (i = 0; i < SHARED_WRITER_NUM; ++i)
+		{
+			for (j = 0; j < SHARED_VALUE_NUM; ++j)
+			{
+				values[i][j] = i * SHARED_VALUE_NUM + j;
+			}
+			writers[i].shared = shared;
+			writers[i].values = values[i];
+			readers[i].shared = shared;
+			readers[i].values = values[i];
+			pthread_create(&writer_threads[i], NULL, SharedWriter, &writers[i]);
+			pthread_create(&reader_threads[i], NULL, SharedReader, &readers[i]);
+		}
+		for (i = 0; i < SHARED_WRITER_NUM; ++i)
+		{
+			pthread_join(writer_threads[i], NULL);
+			pthread_join(reader_threads[i], NULL);
+		}
+		printf("length = %d\tfound = %d %d\n", LinkList_SharedGetLength(shared), readers[0].found, readers[1].found);
+
+		// 删除和出队
+		printf("Remove(values[1][5]) = %d\t", LinkList_SharedRemove(shared, (LIST_NODE)(&values[1][5])));
+		printf("Remove(values[1][5]) = %d\t", LinkList_SharedRemove(shared, (LIST_NODE)(&values[1][5])));
+		printf("Contains(values[1][5]) = %d\t", LinkList_SharedContains(shared, (LIST_NODE)(&values[1][5])));
+		printf("Contains(values[1][6]) = %d\n", LinkList_SharedContains(shared, (LIST_NODE)(&values[1][6])));
+		for (i = 0; LinkList_SharedPopFront(shared) != NULL; ++i){}
+		printf("PopFront: %d\tlength = %d\n", i, LinkList_SharedGetLength(shared));
+		LinkList_DestroyShared(shared);
+	}
+
 
 	printf("Hello world!\n");
 	return 0;
@@ -226,3 +536,75 @@ int TeacherPrint(LIST_NODE t)
 	printf("age = %d\t name = %s\n", t1->age, t1->name);
 	return 0;
 }
+
+// IntLinkList的print函数
+int IntPrint(int* value)
+{
+	printf("%d ", *value);
+	return 0;
+}
+
+// 把TEACHER的年龄累加到ctx中，遇到ctx->stop时停止
+int TeacherAgeSumUntil(LIST_NODE t, void* ctx)
+{
+	AGE_SUM_CTX* sum_ctx = (AGE_SUM_CTX*)ctx;
+	if ((TEACHER*)t == sum_ctx->stop)
+	{
+		return 1;
+	}
+	sum_ctx->age_sum += ((TEACHER*)t)->age;
+	return 0;
+}
+
+// 生产者线程，依次把items中的结点入队
+void* QueueProducer(void* arg)
+{
+	QUEUE_PRODUCER* producer = (QUEUE_PRODUCER*)arg;
+	int i = 0;
+	for (i = 0; i < QUEUE_ITEM_NUM; ++i)
+	{
+		LinkList_QueuePush(producer->queue, &producer->items[i].link);
+	}
+	return NULL;
+}
+
+// 写线程，每次批量插入100个数据
+void* SharedWriter(void* arg)
+{
+	SHARED_WORKER* worker = (SHARED_WORKER*)arg;
+	LIST_NODE batch[100];
+	int i = 0;
+	int j = 0;
+	for (i = 0; i < SHARED_VALUE_NUM; i += 100)
+	{
+		for (j = 0; j < 100; ++j)
+		{
+			batch[j] = (LIST_NODE)(&worker->values[i + j]);
+		}
+		LinkList_SharedPushBackBatch(worker->shared, batch, 100);
+	}
+	return NULL;
+}
+
+// 读线程，反复批量查找写线程的数据，直到全部找到
+void* SharedReader(void* arg)
+{
+	SHARED_WORKER* worker = (SHARED_WORKER*)arg;
+	LIST_NODE nodes[SHARED_VALUE_NUM];
+	int results[SHARED_VALUE_NUM];
+	int i = 0;
+	for (i = 0; i < SHARED_VALUE_NUM; ++i)
+	{
+		nodes[i] = (LIST_NODE)(&worker->values[i]);
+	}
+	do
+	{
+		LinkList_SharedContainsBatch(worker->shared, nodes, SHARED_VALUE_NUM, results);
+		worker->found = 0;
+		for (i = 0; i < SHARED_VALUE_NUM; ++i)
+		{
+			worker->found += results[i];
+		}
+	} while (worker->found < SHARED_VALUE_NUM);
+	return NULL;
+}
@@ -0,0 +1,607 @@
+/*****************************************************************************************************************************
+ * File name:	lock_free_list.cpp
+ * Author:	guoke
+ * Date:	2026.10.19
+ * Description:	C++无锁有序链表的源文件，该文件包含了lock_free_list.h中模板类LOCK_FREE_LIST_NODE和LOCK_FREE_LIST的实现。
+ * History:	1. 2026.10.19 创建并完成初始版本
+ ****************************************************************************************************************************/
+
+#include <iostream>
+#include <cstring>
+#include "lock_free_list.h"
+
+using namespace std;
+
+#define LOCK_FREE_LIST_MARK		((uintptr_t)1)										// 后继指针中的删除标记
+#define LOCK_FREE_LIST_PTR(raw)	((LOCK_FREE_LIST_NODE<T>*)((raw) & ~LOCK_FREE_LIST_MARK))	// 去掉删除标记之后的结点地址
+
+
+/****************************************************************** 线程槽位 ****************************************************************/
+/* 每个线程第一次访问任意LOCK_FREE_LIST时占用一个全局槽位，线程退出时归还，槽位号用作各链表中纪元记录的下标 */
+class LOCK_FREE_THREAD_SLOT{
+private:
+	int slot;			// 槽位号，没有空闲槽位时为-1
+
+public:
+	/*
+	 * Function:		LOCK_FREE_THREAD_SLOT()
+	 * Description:		占用第一个空闲的全局槽位
+	 * Time complexity:	O(LOCK_FREE_LIST_MAX_THREADS)
+	 * Input:
+	 * Output:
+	 * Return:
+	 */
+	LOCK_FREE_THREAD_SLOT():slot(-1)
+	{
+		std::atomic<bool>* slot_table = SlotTable();
+		for (int i = 0; i < LOCK_FREE_LIST_MAX_THREADS; ++i)
+		{
+			bool expected = false;
+			if (slot_table[i].compare_exchange_strong(expected, true))
+			{
+				this->slot = i;
+				break;
+			}
+		}
+	}
+
+	/*
+	 * Function:		~LOCK_FREE_THREAD_SLOT()
+	 * Description:		线程退出时归还槽位
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:
+	 */
+	~LOCK_FREE_THREAD_SLOT()
+	{
+		if (this->slot >= 0)
+		{
+			SlotTable()[this->slot].store(false);
+		}
+	}
+
+	/*
+	 * Function:		Current()
+	 * Description:		获取当前线程的槽位号
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			int类型，槽位号，没有空闲槽位时返回-1
+	 */
+	static int Current()
+	{
+		static thread_local LOCK_FREE_THREAD_SLOT thread_slot;
+		return thread_slot.slot;
+	}
+
+private:
+	/* 全局槽位表，true表示已被占用 */
+	static std::atomic<bool>* SlotTable()
+	{
+		static std::atomic<bool> slot_table[LOCK_FREE_LIST_MAX_THREADS];
+		return slot_table;
+	}
+};
+
+
+/****************************************************************** LOCK_FREE_LIST_NODE类型API ****************************************************************/
+
+/*
+ * Function:		LOCK_FREE_LIST_NODE()
+ * Description:		LOCK_FREE_LIST_NODE类的无参构造函数，用于构造头结点，后继置NULL
+ * Time complexity:	与类T的无参构造函数时间复杂度相同
+ * Input:
+ * Output:
+ * Return:
+ */
+template <typename T>
+LOCK_FREE_LIST_NODE<T>::LOCK_FREE_LIST_NODE():next(0), data()
+{
+}
+
+
+
+/*
+ * Function:		LOCK_FREE_LIST_NODE()
+ * Description:		LOCK_FREE_LIST_NODE类的有参构造函数，数据域由调用者指定，后继置NULL
+ * Time complexity:	与类T的拷贝构造函数时间复杂度相同
+ * Input:
+ *		my_data:	const T&类型，初始化结点的数据域的数据
+ * Output:
+ * Return:
+ */
+template <typename T>
+LOCK_FREE_LIST_NODE<T>::LOCK_FREE_LIST_NODE(const T& my_data):next(0), data(my_data)
+{
+}
+
+
+
+/*
+ * Function:		GetNextRef()
+ * Description:		获取后继指针的引用，用于原子读取和CAS
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			std::atomic<uintptr_t>&类型，带删除标记的后继指针
+ */
+template <typename T>
+std::atomic<uintptr_t>& LOCK_FREE_LIST_NODE<T>::GetNextRef()
+{
+	return this->next;
+}
+
+
+
+/*
+ * Function:		GetDataRef()
+ * Description:		获取该结点数据域的常引用。结点插入链表之后数据不再改变，所以可以不加锁读取
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			const T&类型，结点数据域的常引用
+ */
+template <typename T>
+const T& LOCK_FREE_LIST_NODE<T>::GetDataRef() const
+{
+	return this->data;
+}
+
+
+/****************************************************************** LOCK_FREE_LIST类型API ****************************************************************/
+
+/*
+ * Function:		LOCK_FREE_LIST()
+ * Description:		LOCK_FREE_LIST类的无参构造函数，构造一个空链表
+ * Time complexity:	O(LOCK_FREE_LIST_MAX_THREADS)
+ * Input:
+ * Output:
+ * Return:
+ */
+template <typename T>
+LOCK_FREE_LIST<T>::LOCK_FREE_LIST():header(), length(0), global_epoch(0)
+{
+	for (int i = 0; i < LOCK_FREE_LIST_MAX_THREADS; ++i)
+	{
+		this->records[i].active.store(false);
+		this->records[i].local_epoch.store(0);
+	}
+}
+
+
+
+/*
+ * Function:		~LOCK_FREE_LIST()
+ * Description:		LOCK_FREE_LIST类的析构函数，释放链表中的结点和所有尚未回收的结点，调用时不能有其他线程访问链表
+ * Time complexity:	O(n)
+ * Input:
+ * Output:
+ * Return:
+ */
+template <typename T>
+LOCK_FREE_LIST<T>::~LOCK_FREE_LIST()
+{
+	// 释放仍在链表中的结点，包括已被逻辑删除但还没有摘除的结点
+	LOCK_FREE_LIST_NODE<T>* current_node = LOCK_FREE_LIST_PTR(this->header.GetNextRef().load());
+	while (current_node != NULL)
+	{
+		LOCK_FREE_LIST_NODE<T>* next_node = LOCK_FREE_LIST_PTR(current_node->GetNextRef().load());
+		delete current_node;
+		current_node = next_node;
+	}
+
+	// 释放已摘除但尚未回收的结点
+	for (int i = 0; i < LOCK_FREE_LIST_MAX_THREADS; ++i)
+	{
+		for (size_t j = 0; j < this->records[i].retired_nodes.size(); ++j)
+		{
+			delete this->records[i].retired_nodes[j];
+		}
+		this->records[i].retired_nodes.clear();
+		this->records[i].retired_epochs.clear();
+	}
+}
+
+
+
+/*
+ * Function:		GetLength()
+ * Description:		获取链表长度，有其他线程并发修改时只是近似值
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			int类型，链表长度
+ */
+template <typename T>
+int LOCK_FREE_LIST<T>::GetLength() const
+{
+	return this->length.load();
+}
+
+
+
+/*
+ * Function:		IsEmpty()
+ * Description:		判断链表是否为空表
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			bool类型，如果链表为空表返回true，否则返回false
+ */
+template <typename T>
+bool LOCK_FREE_LIST<T>::IsEmpty() const
+{
+	return (this->length.load() == 0) ? true : false;
+}
+
+
+
+/*
+ * Function:		Insert()
+ * Description:		按序插入数据，链表中已存在相等的数据时不插入。可以被多个线程同时调用
+ * Time complexity:	O(n)，无锁
+ * Input:
+ *		data:		const T&类型，插入的数据
+ * Output:
+ * Return:			int类型，插入成功返回0，数据已存在返回-2，其他错误返回负数
+ */
+template <typename T>
+int LOCK_FREE_LIST<T>::Insert(const T& data)
+{
+	int slot = this->EnterCritical();
+	if (slot < 0)
+	{
+		cout << "func LOCK_FREE_LIST<T>::Insert() err: slot < 0" << endl;
+		return -1;
+	}
+
+	// 申请结点空间
+	LOCK_FREE_LIST_NODE<T>* list_node = new LOCK_FREE_LIST_NODE<T>(data);
+	if (list_node == NULL)
+	{
+		cout << "func LOCK_FREE_LIST<T>::Insert() err: list_node == NULL" << endl;
+		this->ExitCritical(slot);
+		return -3;
+	}
+
+	while (true)
+	{
+		std::atomic<uintptr_t>* prev = NULL;
+		LOCK_FREE_LIST_NODE<T>* curr = NULL;
+
+		// 数据已存在，新结点从未发布给其他线程，可以直接释放
+		if (this->Search(slot, data, prev, curr))
+		{
+			delete list_node;
+			this->ExitCritical(slot);
+			return -2;
+		}
+
+		// 新结点指向curr，再用CAS把前驱的后继从curr改为新结点；失败说明前驱被修改或被删除，重新查找
+		list_node->GetNextRef().store((uintptr_t)curr);
+		uintptr_t expected = (uintptr_t)curr;
+		if (prev->compare_exchange_strong(expected, (uintptr_t)list_node))
+		{
+			break;
+		}
+	}
+
+	this->length ++;
+	this->ExitCritical(slot);
+	return 0;
+}
+
+
+
+/*
+ * Function:		Erase()
+ * Description:		删除与data相等的结点。可以被多个线程同时调用
+ * Time complexity:	O(n)，无锁
+ * Input:
+ *		data:		const T&类型，删除的数据
+ * Output:
+ * Return:			int类型，删除成功返回0，数据不存在返回-2，其他错误返回负数
+ */
+template <typename T>
+int LOCK_FREE_LIST<T>::Erase(const T& data)
+{
+	int slot = this->EnterCritical();
+	if (slot < 0)
+	{
+		cout << "func LOCK_FREE_LIST<T>::Erase() err: slot < 0" << endl;
+		return -1;
+	}
+
+	while (true)
+	{
+		std::atomic<uintptr_t>* prev = NULL;
+		LOCK_FREE_LIST_NODE<T>* curr = NULL;
+
+		if (!this->Search(slot, data, prev, curr))
+		{
+			this->ExitCritical(slot);
+			return -2;
+		}
+
+		// 逻辑删除：在curr的后继指针上打删除标记，标记成功的线程才算删除了该结点
+		uintptr_t next_raw = curr->GetNextRef().load();
+		if (next_raw & LOCK_FREE_LIST_MARK)
+		{
+			continue;
+		}
+		if (!curr->GetNextRef().compare_exchange_strong(next_raw, next_raw | LOCK_FREE_LIST_MARK))
+		{
+			continue;
+		}
+
+		// 物理删除：把前驱的后继从curr改为curr的后继，失败时由Search()负责摘除
+		uintptr_t expected = (uintptr_t)curr;
+		if (prev->compare_exchange_strong(expected, next_raw))
+		{
+			this->Retire(slot, curr);
+		}
+		else
+		{
+			this->Search(slot, data, prev, curr);
+		}
+		break;
+	}
+
+	this->length --;
+	this->ExitCritical(slot);
+	return 0;
+}
+
+
+
+/*
+ * Function:		Find()
+ * Description:		查找链表中是否存在与data相等的结点，查找过程不修改链表。可以被多个线程同时调用
+ * Time complexity:	O(n)，无等待
+ * Input:
+ *		data:		const T&类型，查找的数据
+ * Output:
+ * Return:			int类型，找到返回0，不存在返回-2，其他错误返回负数
+ */
+template <typename T>
+int LOCK_FREE_LIST<T>::Find(const T& data)
+{
+	int slot = this->EnterCritical();
+	if (slot < 0)
+	{
+		cout << "func LOCK_FREE_LIST<T>::Find() err: slot < 0" << endl;
+		return -1;
+	}
+
+	// 不摘除结点，直接越过被标记的结点
+	LOCK_FREE_LIST_NODE<T>* curr = LOCK_FREE_LIST_PTR(this->header.GetNextRef().load());
+	while (curr != NULL && curr->GetDataRef() < data)
+	{
+		curr = LOCK_FREE_LIST_PTR(curr->GetNextRef().load());
+	}
+	bool found = (curr != NULL && curr->GetDataRef() == data && !(curr->GetNextRef().load() & LOCK_FREE_LIST_MARK));
+
+	this->ExitCritical(slot);
+	return found ? 0 : -2;
+}
+
+
+
+/*
+ * Function:		Traverse()
+ * Description:		按从小到大的顺序遍历链表，跳过已被逻辑删除的结点，每个结点的数据data作为参数调用visit()。
+ *					遍历期间其他线程插入或删除的结点可能被访问也可能不被访问
+ * Time complexity:	假设类T重载的赋值操作符时间复杂度为O(m)，visit()的时间复杂度为O(t)，则本函数时间复杂度为O(n*m + n*t)
+ * Input:
+ *		visit:		int (*)(T& data)类型，函数指针，以类T的引用为参数
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int LOCK_FREE_LIST<T>::Traverse(int (*visit)(T& data))
+{
+	int slot = this->EnterCritical();
+	if (slot < 0)
+	{
+		cout << "func LOCK_FREE_LIST<T>::Traverse() err: slot < 0" << endl;
+		return -1;
+	}
+
+	LOCK_FREE_LIST_NODE<T>* curr = LOCK_FREE_LIST_PTR(this->header.GetNextRef().load());
+	while (curr != NULL)
+	{
+		uintptr_t next_raw = curr->GetNextRef().load();
+		if (!(next_raw & LOCK_FREE_LIST_MARK))
+		{
+			T current_node_data = curr->GetDataRef();			// visit()拿到的是拷贝，不能修改链表中的数据
+			if (visit(current_node_data) != 0)
+			{
+				cout << "func LOCK_FREE_LIST<T>::Traverse() err: func_status != 0" << endl;
+				this->ExitCritical(slot);
+				return -2;
+			}
+		}
+		curr = LOCK_FREE_LIST_PTR(next_raw);
+	}
+
+	this->ExitCritical(slot);
+	return 0;
+}
+
+
+
+/*
+ * Function:		EnterCritical()
+ * Description:		当前线程进入临界区，记录观察到的全局纪元，之后访问的结点在离开临界区之前不会被释放
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			int类型，当前线程的槽位号，线程数超过LOCK_FREE_LIST_MAX_THREADS时返回负数
+ */
+template <typename T>
+int LOCK_FREE_LIST<T>::EnterCritical()
+{
+	int slot = LOCK_FREE_THREAD_SLOT::Current();
+	if (slot < 0)
+	{
+		return -1;
+	}
+
+	// 先声明活跃再发布观察到的纪元，两次写入都是顺序一致的，推进纪元的线程不会漏看本线程
+	this->records[slot].active.store(true);
+	this->records[slot].local_epoch.store(this->global_epoch.load());
+	return slot;
+}
+
+
+
+/*
+ * Function:		ExitCritical()
+ * Description:		当前线程离开临界区
+ * Time complexity:	O(1)
+ * Input:
+ *		slot:		int类型，EnterCritical()返回的槽位号
+ * Output:
+ * Return:
+ */
+template <typename T>
+void LOCK_FREE_LIST<T>::ExitCritical(int slot)
+{
+	this->records[slot].active.store(false);
+}
+
+
+
+/*
+ * Function:		Retire()
+ * Description:		记录一个已被物理删除的结点，积累到LOCK_FREE_LIST_RETIRE_BATCH个之后尝试推进纪元并回收
+ * Time complexity:	均摊O(LOCK_FREE_LIST_MAX_THREADS / LOCK_FREE_LIST_RETIRE_BATCH)
+ * Input:
+ *		slot:		int类型，当前线程的槽位号
+ *		node:		LOCK_FREE_LIST_NODE<T>*类型，被摘除的结点
+ * Output:
+ * Return:
+ */
+template <typename T>
+void LOCK_FREE_LIST<T>::Retire(int slot, LOCK_FREE_LIST_NODE<T>* node)
+{
+	LOCK_FREE_EPOCH_RECORD<T>& record = this->records[slot];
+	record.retired_nodes.push_back(node);
+	record.retired_epochs.push_back(this->global_epoch.load());
+
+	if (record.retired_nodes.size() < LOCK_FREE_LIST_RETIRE_BATCH)
+	{
+		return;
+	}
+
+	// 在纪元e摘除的结点，全局纪元到达e+2时已没有线程可能持有它
+	uint64_t current_epoch = this->TryAdvanceEpoch();
+	size_t kept = 0;
+	for (size_t i = 0; i < record.retired_nodes.size(); ++i)
+	{
+		if (record.retired_epochs[i] + 2 <= current_epoch)
+		{
+			delete record.retired_nodes[i];
+		}
+		else
+		{
+			record.retired_nodes[kept] = record.retired_nodes[i];
+			record.retired_epochs[kept] = record.retired_epochs[i];
+			kept ++;
+		}
+	}
+	record.retired_nodes.resize(kept);
+	record.retired_epochs.resize(kept);
+}
+
+
+
+/*
+ * Function:		TryAdvanceEpoch()
+ * Description:		如果所有处于临界区的线程都已观察到当前全局纪元，则将全局纪元加1
+ * Time complexity:	O(LOCK_FREE_LIST_MAX_THREADS)
+ * Input:
+ * Output:
+ * Return:			uint64_t类型，推进之后的全局纪元
+ */
+template <typename T>
+uint64_t LOCK_FREE_LIST<T>::TryAdvanceEpoch()
+{
+	uint64_t current_epoch = this->global_epoch.load();
+	for (int i = 0; i < LOCK_FREE_LIST_MAX_THREADS; ++i)
+	{
+		if (this->records[i].active.load() && this->records[i].local_epoch.load() != current_epoch)
+		{
+			return current_epoch;
+		}
+	}
+
+	// 其他线程可能已经推进了纪元，CAS失败时expected会被更新为最新值
+	if (this->global_epoch.compare_exchange_strong(current_epoch, current_epoch + 1))
+	{
+		return current_epoch + 1;
+	}
+	return current_epoch;
+}
+
+
+
+/*
+ * Function:		Search()
+ * Description:		查找第一个不小于data的结点，沿途摘除已被逻辑删除的结点。必须在临界区内调用
+ * Time complexity:	O(n)
+ * Input:
+ *		slot:		int类型，当前线程的槽位号
+ *		data:		const T&类型，查找的数据
+ * Output:
+ *		out_prev:	std::atomic<uintptr_t>*&类型，指向找到的结点的后继指针（头结点或前驱结点的next）
+ *		out_curr:	LOCK_FREE_LIST_NODE<T>*&类型，第一个不小于data的结点，不存在时为NULL
+ * Return:			bool类型，out_curr中的数据与data相等时返回true
+ */
+template <typename T>
+bool LOCK_FREE_LIST<T>::Search(int slot, const T& data, std::atomic<uintptr_t>*& out_prev, LOCK_FREE_LIST_NODE<T>*& out_curr)
+{
+retry:
+	std::atomic<uintptr_t>* prev = &this->header.GetNextRef();
+	LOCK_FREE_LIST_NODE<T>* curr = LOCK_FREE_LIST_PTR(prev->load());
+
+	while (curr != NULL)
+	{
+		uintptr_t next_raw = curr->GetNextRef().load();
+
+		// 前驱已被修改（前驱被删除或有新结点插入），从头重新查找
+		if (prev->load() != (uintptr_t)curr)
+		{
+			goto retry;
+		}
+
+		// curr已被逻辑删除，帮助将其摘除，摘除成功的线程负责回收
+		if (next_raw & LOCK_FREE_LIST_MARK)
+		{
+			uintptr_t expected = (uintptr_t)curr;
+			if (!prev->compare_exchange_strong(expected, next_raw & ~LOCK_FREE_LIST_MARK))
+			{
+				goto retry;
+			}
+			this->Retire(slot, curr);
+			curr = LOCK_FREE_LIST_PTR(next_raw);
+			continue;
+		}
+
+		// 找到第一个不小于data的结点
+		if (!(curr->GetDataRef() < data))
+		{
+			out_prev = prev;
+			out_curr = curr;
+			return (curr->GetDataRef() == data) ? true : false;
+		}
+
+		prev = &curr->GetNextRef();
+		curr = LOCK_FREE_LIST_PTR(next_raw);
+	}
+
+	out_prev = prev;
+	out_curr = NULL;
+	return false;
+}
@@ -0,0 +1,245 @@
+/*****************************************************************************************************************************
+ * File name:	lock_free_list.h
+ * Author:	guoke
+ * Date:	2026.10.19
+ * Description:	C++无锁有序链表的头文件，该文件包含了模板类LOCK_FREE_LIST_NODE和LOCK_FREE_LIST的声明，其实现包含在文件lock_free_list.cpp中。
+ *				链表按Harris/Michael算法实现：删除时先在结点的后继指针最低位打上删除标记（逻辑删除），再用CAS将其摘除（物理删除）。
+ *				摘除的结点不能立即释放，因为其他线程可能仍在访问它，所以使用基于纪元（epoch）的内存回收：
+ *				结点在纪元e被摘除后，等到全局纪元推进到e+2，即所有在纪元e时活跃的线程都已离开临界区时才真正释放。
+ *				链表中的数据互不相同，类T需要重载<操作符和==操作符。
+ * History:	1. 2026.10.19 创建并完成初始版本
+ ****************************************************************************************************************************/
+
+#ifndef _LOCK_FREE_LIST_H_
+#define _LOCK_FREE_LIST_H_
+
+#include <stdint.h>
+#include <atomic>
+#include <vector>
+
+#define LOCK_FREE_LIST_MAX_THREADS		128			// 同时访问链表的最大线程数
+#define LOCK_FREE_LIST_RETIRE_BATCH		64			// 每个线程积累多少个被摘除的结点之后尝试回收一次
+
+/****************************************************************** LOCK_FREE_LIST_NODE类型，无锁链表中的结点 ****************************************************************/
+template <typename T>
+class LOCK_FREE_LIST_NODE{
+private:
+	std::atomic<uintptr_t>	next;						// 后继结点的地址，最低位为1表示本结点已被逻辑删除
+	T						data;						// 数据域
+
+public:
+	/*
+	 * Function:		LOCK_FREE_LIST_NODE()
+	 * Description:		LOCK_FREE_LIST_NODE类的无参构造函数，用于构造头结点，后继置NULL
+	 * Time complexity:	与类T的无参构造函数时间复杂度相同
+	 * Input:
+	 * Output:
+	 * Return:
+	 */
+	LOCK_FREE_LIST_NODE();
+
+	/*
+	 * Function:		LOCK_FREE_LIST_NODE()
+	 * Description:		LOCK_FREE_LIST_NODE类的有参构造函数，数据域由调用者指定，后继置NULL
+	 * Time complexity:	与类T的拷贝构造函数时间复杂度相同
+	 * Input:
+	 *		my_data:	const T&类型，初始化结点的数据域的数据
+	 * Output:
+	 * Return:
+	 */
+	LOCK_FREE_LIST_NODE(const T& my_data);
+
+public:
+	/*
+	 * Function:		GetNextRef()
+	 * Description:		获取后继指针的引用，用于原子读取和CAS
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			std::atomic<uintptr_t>&类型，带删除标记的后继指针
+	 */
+	std::atomic<uintptr_t>& GetNextRef();
+
+	/*
+	 * Function:		GetDataRef()
+	 * Description:		获取该结点数据域的常引用。结点插入链表之后数据不再改变，所以可以不加锁读取
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			const T&类型，结点数据域的常引用
+	 */
+	const T& GetDataRef() const;
+};
+
+
+
+/* 每个线程在一个链表中的纪元记录，按缓存行对齐以避免不同线程之间的伪共享 */
+template <typename T>
+struct alignas(64) LOCK_FREE_EPOCH_RECORD{
+	std::atomic<bool>						active;				// 线程是否处于临界区中
+	std::atomic<uint64_t>					local_epoch;		// 线程进入临界区时观察到的全局纪元
+	std::vector<LOCK_FREE_LIST_NODE<T>*>	retired_nodes;		// 线程摘除但尚未释放的结点，只有拥有该记录的线程访问
+	std::vector<uint64_t>					retired_epochs;		// 与retired_nodes一一对应，结点被摘除时的纪元
+};
+
+
+
+/****************************************************************** LOCK_FREE_LIST类型，无锁有序链表 ****************************************************************/
+template <typename T>
+class LOCK_FREE_LIST{
+private:
+	LOCK_FREE_LIST_NODE<T>				header;									// 头结点，后继指向链表第一个结点
+	std::atomic<int>					length;									// 链表长度，并发修改时只是近似值
+	std::atomic<uint64_t>				global_epoch;							// 全局纪元
+	LOCK_FREE_EPOCH_RECORD<T>			records[LOCK_FREE_LIST_MAX_THREADS];	// 每个线程的纪元记录，下标为线程槽位号
+
+public:
+	/*
+	 * Function:		LOCK_FREE_LIST()
+	 * Description:		LOCK_FREE_LIST类的无参构造函数，构造一个空链表
+	 * Time complexity:	O(LOCK_FREE_LIST_MAX_THREADS)
+	 * Input:
+	 * Output:
+	 * Return:
+	 */
+	LOCK_FREE_LIST();
+
+	/*
+	 * Function:		~LOCK_FREE_LIST()
+	 * Description:		LOCK_FREE_LIST类的析构函数，释放链表中的结点和所有尚未回收的结点，调用时不能有其他线程访问链表
+	 * Time complexity:	O(n)
+	 * Input:
+	 * Output:
+	 * Return:
+	 */
+	~LOCK_FREE_LIST();
+
+private:
+	LOCK_FREE_LIST(const LOCK_FREE_LIST&);				// 禁止拷贝
+	LOCK_FREE_LIST& operator=(const LOCK_FREE_LIST&);
+
+public:
+	/*
+	 * Function:		GetLength()
+	 * Description:		获取链表长度，有其他线程并发修改时只是近似值
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			int类型，链表长度
+	 */
+	int GetLength() const;
+
+	/*
+	 * Function:		IsEmpty()
+	 * Description:		判断链表是否为空表
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			bool类型，如果链表为空表返回true，否则返回false
+	 */
+	bool IsEmpty() const;
+
+	/*
+	 * Function:		Insert()
+	 * Description:		按序插入数据，链表中已存在相等的数据时不插入。可以被多个线程同时调用
+	 * Time complexity:	O(n)，无锁
+	 * Input:
+	 *		data:		const T&类型，插入的数据
+	 * Output:
+	 * Return:			int类型，插入成功返回0，数据已存在返回-2，其他错误返回负数
+	 */
+	int Insert(const T& data);
+
+	/*
+	 * Function:		Erase()
+	 * Description:		删除与data相等的结点。可以被多个线程同时调用
+	 * Time complexity:	O(n)，无锁
+	 * Input:
+	 *		data:		const T&类型，删除的数据
+	 * Output:
+	 * Return:			int类型，删除成功返回0，数据不存在返回-2，其他错误返回负数
+	 */
+	int Erase(const T& data);
+
+	/*
+	 * Function:		Find()
+	 * Description:		查找链表中是否存在与data相等的结点，查找过程不修改链表。可以被多个线程同时调用
+	 * Time complexity:	O(n)，无等待
+	 * Input:
+	 *		data:		const T&类型，查找的数据
+	 * Output:
+	 * Return:			int类型，找到返回0，不存在返回-2，其他错误返回负数
+	 */
+	int Find(const T& data);
+
+	/*
+	 * Function:		Traverse()
+	 * Description:		按从小到大的顺序遍历链表，跳过已被逻辑删除的结点，每个结点的数据data作为参数调用visit()。
+	 *					遍历期间其他线程插入或删除的结点可能被访问也可能不被访问
+	 * Time complexity:	假设类T重载的赋值操作符时间复杂度为O(m)，visit()的时间复杂度为O(t)，则本函数时间复杂度为O(n*m + n*t)
+	 * Input:
+	 *		visit:		int (*)(T& data)类型，函数指针，以类T的引用为参数
+	 * Output:
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int Traverse(int (*visit)(T& data));
+
+private:
+	/*
+	 * Function:		EnterCritical()
+	 * Description:		当前线程进入临界区，记录观察到的全局纪元，之后访问的结点在离开临界区之前不会被释放
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			int类型，当前线程的槽位号，线程数超过LOCK_FREE_LIST_MAX_THREADS时返回负数
+	 */
+	int EnterCritical();
+
+	/*
+	 * Function:		ExitCritical()
+	 * Description:		当前线程离开临界区
+	 * Time complexity:	O(1)
+	 * Input:
+	 *		slot:		int类型，EnterCritical()返回的槽位号
+	 * Output:
+	 * Return:
+	 */
+	void ExitCritical(int slot);
+
+	/*
+	 * Function:		Retire()
+	 * Description:		记录一个已被物理删除的结点，积累到LOCK_FREE_LIST_RETIRE_BATCH个之后尝试推进纪元并回收
+	 * Time complexity:	均摊O(LOCK_FREE_LIST_MAX_THREADS / LOCK_FREE_LIST_RETIRE_BATCH)
+	 * Input:
+	 *		slot:		int类型，当前线程的槽位号
+	 *		node:		LOCK_FREE_LIST_NODE<T>*类型，被摘除的结点
+	 * Output:
+	 * Return:
+	 */
+	void Retire(int slot, LOCK_FREE_LIST_NODE<T>* node);
+
+	/*
+	 * Function:		TryAdvanceEpoch()
+	 * Description:		如果所有处于临界区的线程都已观察到当前全局纪元，则将全局纪元加1
+	 * Time complexity:	O(LOCK_FREE_LIST_MAX_THREADS)
+	 * Input:
+	 * Output:
+	 * Return:			uint64_t类型，推进之后的全局纪元
+	 */
+	uint64_t TryAdvanceEpoch();
+
+	/*
+	 * Function:		Search()
+	 * Description:		查找第一个不小于data的结点，沿途摘除已被逻辑删除的结点。必须在临界区内调用
+	 * Time complexity:	O(n)
+	 * Input:
+	 *		slot:		int类型，当前线程的槽位号
+	 *		data:		const T&类型，查找的数据
+	 * Output:
+	 *		out_prev:	std::atomic<uintptr_t>*&类型，指向找到的结点的后继指针（头结点或前驱结点的next）
+	 *		out_curr:	LOCK_FREE_LIST_NODE<T>*&类型，第一个不小于data的结点，不存在时为NULL
+	 * Return:			bool类型，out_curr中的数据与data相等时返回true
+	 */
+	bool Search(int slot, const T& data, std::atomic<uintptr_t>*& out_prev, LOCK_FREE_LIST_NODE<T>*& out_curr);
+};
+#endif
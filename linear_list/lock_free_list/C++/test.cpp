@@ -0,0 +1,133 @@
+/******************************************************************************************************************************************
+ * File name:	test.cpp
+ * Author:	guoke
+ * Date:	2026.10.19
+ * Description:	C++无锁有序链表库lock_free_list.cpp、lock_free_list.h的API测试程序
+ * History:	1. 2026.10.19 创建并完成初始版本
+ *****************************************************************************************************************************************/
+
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "lock_free_list.cpp"
+
+using namespace std;
+
+#define THREAD_NUM		4
+#define KEY_RANGE		2048
+#define OP_NUM			200000
+
+// 打印int类型数据
+int PrintInt(int& data);
+
+// 检查int类型数据是否严格有序，并统计访问的结点数
+int CheckOrder(int& data);
+static int last_data = 0;
+static int visit_count = 0;
+
+// 并发测试的工作线程，每个线程只操作 key % THREAD_NUM == id 的数据，最后统计自己的数据应有的状态
+void Worker(LOCK_FREE_LIST<int>* list, int id, vector<char>* expected);
+
+int main(void)
+{
+	// 创建链表
+	cout << "\n***************************************** 创建链表 **********************************" << endl;
+	LOCK_FREE_LIST<int> int_list;
+	cout << "length = " << int_list.GetLength() << ", empty = " << int_list.IsEmpty() << endl;
+
+	// 乱序插入数据
+	cout << "\n***************************************** 乱序插入数据 **********************************" << endl;
+	int data[] = {5, 3, 9, 1, 7, 3};
+	for (int i = 0; i < (int)(sizeof(data) / sizeof(data[0])); ++i)
+	{
+		cout << "insert " << data[i] << ": " << int_list.Insert(data[i]) << endl;
+	}
+	cout << "length = " << int_list.GetLength() << endl;
+	int_list.Traverse(PrintInt);
+
+	// 查找与删除数据
+	cout << "\n***************************************** 查找与删除数据 **********************************" << endl;
+	cout << "find 7: " << int_list.Find(7) << ", find 8: " << int_list.Find(8) << endl;
+	cout << "erase 7: " << int_list.Erase(7) << ", erase 7 again: " << int_list.Erase(7) << endl;
+	cout << "find 7: " << int_list.Find(7) << ", length = " << int_list.GetLength() << endl;
+	int_list.Traverse(PrintInt);
+
+	// 多线程并发插入和删除
+	cout << "\n***************************************** 多线程并发插入和删除 **********************************" << endl;
+	LOCK_FREE_LIST<int> shared_list;
+	vector<char> expected(KEY_RANGE, 0);
+	vector<thread> threads;
+	for (int i = 0; i < THREAD_NUM; ++i)
+	{
+		threads.push_back(thread(Worker, &shared_list, i, &expected));
+	}
+	for (int i = 0; i < THREAD_NUM; ++i)
+	{
+		threads[i].join();
+	}
+
+	int expected_length = 0;
+	int mismatch = 0;
+	for (int key = 0; key < KEY_RANGE; ++key)
+	{
+		expected_length += expected[key];
+		if ((shared_list.Find(key) == 0) != (expected[key] != 0))
+		{
+			mismatch ++;
+		}
+	}
+	last_data = -1;
+	visit_count = 0;
+	int ordered = (shared_list.Traverse(CheckOrder) == 0);
+	cout << "length = " << shared_list.GetLength() << ", expected = " << expected_length << ", visited = " << visit_count
+		 << ", ordered = " << ordered << ", mismatch = " << mismatch << endl;
+
+	cout << "Hello world!" << endl;
+	return 0;
+}
+
+
+
+// 打印int类型数据
+int PrintInt(int& data)
+{
+	cout << data << endl;
+	return 0;
+}
+
+// 检查int类型数据是否严格有序，并统计访问的结点数
+int CheckOrder(int& data)
+{
+	if (data <= last_data)
+	{
+		return -1;
+	}
+	last_data = data;
+	visit_count ++;
+	return 0;
+}
+
+// 并发测试的工作线程，每个线程只操作 key % THREAD_NUM == id 的数据，最后统计自己的数据应有的状态
+void Worker(LOCK_FREE_LIST<int>* list, int id, vector<char>* expected)
+{
+	unsigned int seed = id + 1;
+	for (int i = 0; i < OP_NUM / THREAD_NUM; ++i)
+	{
+		seed = seed * 1103515245 + 12345;
+		int key = (int)((seed >> 8) % (KEY_RANGE / THREAD_NUM)) * THREAD_NUM + id;
+		if ((seed >> 4) & 1)
+		{
+			if (list->Insert(key) == 0)
+			{
+				(*expected)[key] = 1;
+			}
+		}
+		else
+		{
+			if (list->Erase(key) == 0)
+			{
+				(*expected)[key] = 0;
+			}
+		}
+	}
+}
@@ -0,0 +1,134 @@
+/******************************************************************************************************************************************
+ * File name:	bench.cpp
+ * Author:	guoke
+ * Date:	2026.10.19
+ * Description:	LRU_CACHE与直接用LINK_LIST实现的LRU（线性查找后删除并重新插入表头）在Zipf分布访问序列下的性能对比程序。
+ *				每次访问先Get，未命中时Put，统计命中率和每秒访问次数。
+ *				用法：./bench [键个数] [缓存容量] [访问次数] [Zipf参数s]
+ * History:	1. 2026.10.19 创建并完成初始版本
+ *****************************************************************************************************************************************/
+
+#include <iostream>
+#include <cstdlib>
+#include <cmath>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <algorithm>
+#include "lru_cache.cpp"
+
+using namespace std;
+
+/* 键值对，直接用LINK_LIST实现LRU时的结点数据 */
+struct PAIR{
+	int key;
+	int value;
+};
+
+/* 直接用LINK_LIST实现的LRU，作为对照组：表头为最近使用的项，查找需要从表头线性扫描 */
+class NAIVE_LRU{
+private:
+	LINK_LIST<PAIR>	list;
+	int				capacity;
+
+public:
+	NAIVE_LRU(int my_capacity):capacity(my_capacity){}
+
+	/* 查找键，找到时删除并重新插入表头 */
+	int Get(int key, int& out_value)
+	{
+		for (LINK_LIST<PAIR>::iterator it = list.begin(); it != list.end(); ++it)
+		{
+			if (it->key == key)
+			{
+				PAIR pair = *it;
+				list.Erase(it);
+				list.Insert(list.begin(), pair);
+				out_value = pair.value;
+				return 0;
+			}
+		}
+		return -2;
+	}
+
+	/* 插入到表头，缓存已满时删除表尾 */
+	int Put(int key, int value)
+	{
+		if (list.GetLength() >= capacity)
+		{
+			list.Erase(--list.end());
+		}
+		PAIR pair = {key, value};
+		list.Insert(list.begin(), pair);
+		return 0;
+	}
+};
+
+// 生成Zipf分布的访问序列，第i个键被访问的概率与1/(i+1)^s成正比，键的编号打乱以免与插入顺序相关
+vector<int> ZipfTrace(int key_num, int access_num, double s)
+{
+	vector<double> cdf(key_num);
+	double sum = 0.0;
+	for (int i = 0; i < key_num; ++i)
+	{
+		sum += 1.0 / pow(i + 1, s);
+		cdf[i] = sum;
+	}
+
+	mt19937 rng(12345);
+	vector<int> permutation(key_num);
+	for (int i = 0; i < key_num; ++i)
+	{
+		permutation[i] = i;
+	}
+	shuffle(permutation.begin(), permutation.end(), rng);
+
+	uniform_real_distribution<double> uniform(0.0, sum);
+	vector<int> trace(access_num);
+	for (int i = 0; i < access_num; ++i)
+	{
+		int rank = (int)(lower_bound(cdf.begin(), cdf.end(), uniform(rng)) - cdf.begin());
+		trace[i] = permutation[min(rank, key_num - 1)];
+	}
+	return trace;
+}
+
+// 按访问序列运行缓存，输出命中率和每秒访问次数
+template <typename CACHE>
+void Run(const char* name, CACHE& cache, const vector<int>& trace)
+{
+	int hits = 0;
+	int value = 0;
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	for (size_t i = 0; i < trace.size(); ++i)
+	{
+		if (cache.Get(trace[i], value) == 0)
+		{
+			hits ++;
+		}
+		else
+		{
+			cache.Put(trace[i], trace[i]);
+		}
+	}
+	double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+	cout << name << "\thit ratio = " << (double)hits / trace.size() << "\taccesses/s = " << (long long)(trace.size() / seconds) << endl;
+}
+
+int main(int argc, char* argv[])
+{
+	int key_num = (argc > 1) ? atoi(argv[1]) : 100000;
+	int capacity = (argc > 2) ? atoi(argv[2]) : 2000;
+	int access_num = (argc > 3) ? atoi(argv[3]) : 200000;
+	double s = (argc > 4) ? atof(argv[4]) : 0.99;
+
+	cout << "keys = " << key_num << ", capacity = " << capacity << ", accesses = " << access_num << ", zipf s = " << s << endl;
+	vector<int> trace = ZipfTrace(key_num, access_num, s);
+
+	LRU_CACHE<int, int> lru_cache(capacity);
+	Run("LRU_CACHE", lru_cache, trace);
+
+	NAIVE_LRU naive_lru(capacity);
+	Run("LINK_LIST", naive_lru, trace);
+	return 0;
+}
@@ -0,0 +1,432 @@
+/*****************************************************************************************************************************
+ * File name:	lru_cache.cpp
+ * Author:	guoke
+ * Date:	2026.10.19
+ * Description:	C++ LRU缓存的源文件，该文件包含了lru_cache.h中模板类LRU_CACHE的实现。
+ * History:	1. 2026.10.19 创建并完成初始版本
+ *			2. 2026.10.19 结点放入空闲链表时重置键和值，释放被淘汰的值持有的资源
+ ****************************************************************************************************************************/
+
+#include <iostream>
+#include <utility>
+#include "lru_cache.h"
+#include "../../link_list/C++/link_list.cpp"
+
+using namespace std;
+
+/****************************************************************** LRU_CACHE类型API ****************************************************************/
+
+/*
+ * Function:		LRU_CACHE()
+ * Description:		LRU_CACHE类的有参构造函数，构造一个空缓存并为哈希表预留capacity个位置
+ * Time complexity:	O(capacity)
+ * Input:
+ *		my_capacity:	int类型，缓存容量，小于1时按1处理
+ * Output:
+ * Return:
+ */
+template <typename K, typename V>
+LRU_CACHE<K, V>::LRU_CACHE(int my_capacity):sentinel(), free_nodes(NULL), index(), capacity(my_capacity), size(0)
+{
+	if (this->capacity < 1)
+	{
+		this->capacity = 1;
+	}
+	this->index.reserve(this->capacity);		// 预留位置，缓存装满之前哈希表不会重新散列
+}
+
+
+
+/*
+ * Function:		~LRU_CACHE()
+ * Description:		LRU_CACHE类的析构函数，释放所有缓存项和空闲结点
+ * Time complexity:	O(n)
+ * Input:
+ * Output:
+ * Return:
+ */
+template <typename K, typename V>
+LRU_CACHE<K, V>::~LRU_CACHE()
+{
+	this->Clear();
+	while (this->free_nodes != NULL)
+	{
+		NODE* next_node = this->free_nodes->GetNextNode();
+		delete this->free_nodes;
+		this->free_nodes = next_node;
+	}
+}
+
+
+
+/*
+ * Function:		Clear()
+ * Description:		清空缓存，所有结点放入空闲链表
+ * Time complexity:	O(n)
+ * Input:
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename K, typename V>
+int LRU_CACHE<K, V>::Clear()
+{
+	NODE* current_node = this->sentinel.GetNextNode();
+	while (current_node != &this->sentinel)
+	{
+		NODE* next_node = current_node->GetNextNode();
+		this->FreeNode(current_node);
+		current_node = next_node;
+	}
+	this->sentinel.SetNextNode(&this->sentinel);
+	this->sentinel.SetPriorNode(&this->sentinel);
+	this->index.clear();
+	this->size = 0;
+	return 0;
+}
+
+
+
+/*
+ * Function:		GetSize()
+ * Description:		获取缓存项个数
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			int类型，缓存项个数
+ */
+template <typename K, typename V>
+int LRU_CACHE<K, V>::GetSize() const
+{
+	return this->size;
+}
+
+
+
+/*
+ * Function:		GetCapacity()
+ * Description:		获取缓存容量
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			int类型，缓存容量
+ */
+template <typename K, typename V>
+int LRU_CACHE<K, V>::GetCapacity() const
+{
+	return this->capacity;
+}
+
+
+
+/*
+ * Function:		IsEmpty()
+ * Description:		判断缓存是否为空
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			bool类型，如果缓存为空返回true，否则返回false
+ */
+template <typename K, typename V>
+bool LRU_CACHE<K, V>::IsEmpty() const
+{
+	return (this->size == 0) ? true : false;
+}
+
+
+
+/*
+ * Function:		Get()
+ * Description:		查找键对应的值，找到时将该项移到最近使用的位置
+ * Time complexity:	O(1)，与类V的赋值操作符时间复杂度相同
+ * Input:
+ *		key:		const K&类型，查找的键
+ * Output:
+ *		out_value:	V&类型，找到时通过该引用将值传给调用者
+ * Return:			int类型，找到返回0，不存在返回-2
+ */
+template <typename K, typename V>
+int LRU_CACHE<K, V>::Get(const K& key, V& out_value)
+{
+	typename std::unordered_map<K, NODE*>::iterator it = this->index.find(key);
+	if (it == this->index.end())
+	{
+		return -2;
+	}
+
+	NODE* node = it->second;
+	this->Unlink(node);
+	this->LinkFront(node);
+	out_value = node->GetDataRef().value;
+	return 0;
+}
+
+
+
+/*
+ * Function:		Peek()
+ * Description:		查找键对应的值，不改变使用顺序
+ * Time complexity:	O(1)，与类V的赋值操作符时间复杂度相同
+ * Input:
+ *		key:		const K&类型，查找的键
+ * Output:
+ *		out_value:	V&类型，找到时通过该引用将值传给调用者
+ * Return:			int类型，找到返回0，不存在返回-2
+ */
+template <typename K, typename V>
+int LRU_CACHE<K, V>::Peek(const K& key, V& out_value) const
+{
+	typename std::unordered_map<K, NODE*>::const_iterator it = this->index.find(key);
+	if (it == this->index.end())
+	{
+		return -2;
+	}
+
+	out_value = it->second->GetDataRef().value;
+	return 0;
+}
+
+
+
+/*
+ * Function:		Put()
+ * Description:		插入或更新键值对，并将该项移到最近使用的位置。缓存已满时先淘汰最久未使用的项，并复用其结点
+ * Time complexity:	O(1)，与类K、V的赋值操作符时间复杂度相同
+ * Input:
+ *		key:		const K&类型，键
+ *		value:		const V&类型，值
+ * Output:
+ * Return:			int类型，插入新项返回0，更新已有项返回1，操作失败返回负数
+ */
+template <typename K, typename V>
+int LRU_CACHE<K, V>::Put(const K& key, const V& value)
+{
+	// 已存在，更新值并移到表头
+	typename std::unordered_map<K, NODE*>::iterator it = this->index.find(key);
+	if (it != this->index.end())
+	{
+		NODE* node = it->second;
+		node->GetDataRef().value = value;
+		this->Unlink(node);
+		this->LinkFront(node);
+		return 1;
+	}
+
+	// 缓存已满，直接把表尾结点改成新项，哈希表的结点也一并复用，不申请任何内存
+	if (this->size >= this->capacity)
+	{
+		NODE* node = this->sentinel.GetPriorNode();
+		this->Unlink(node);
+		typename std::unordered_map<K, NODE*>::node_type index_node = this->index.extract(node->GetDataRef().key);
+		index_node.key() = key;
+		this->index.insert(std::move(index_node));
+
+		node->GetDataRef().key = key;
+		node->GetDataRef().value = value;
+		this->LinkFront(node);
+		return 0;
+	}
+
+	NODE* node = this->AllocNode();
+	if (node == NULL)
+	{
+		cout << "func LRU_CACHE<K, V>::Put() err: node == NULL" << endl;
+		return -3;
+	}
+	node->GetDataRef().key = key;
+	node->GetDataRef().value = value;
+	this->LinkFront(node);
+	this->index[key] = node;
+	this->size ++;
+	return 0;
+}
+
+
+
+/*
+ * Function:		Touch()
+ * Description:		将键对应的项移到最近使用的位置，不读取值
+ * Time complexity:	O(1)
+ * Input:
+ *		key:		const K&类型，键
+ * Output:
+ * Return:			int类型，操作成功返回0，不存在返回-2
+ */
+template <typename K, typename V>
+int LRU_CACHE<K, V>::Touch(const K& key)
+{
+	typename std::unordered_map<K, NODE*>::iterator it = this->index.find(key);
+	if (it == this->index.end())
+	{
+		return -2;
+	}
+
+	this->Unlink(it->second);
+	this->LinkFront(it->second);
+	return 0;
+}
+
+
+
+/*
+ * Function:		Erase()
+ * Description:		删除键对应的项，结点放入空闲链表
+ * Time complexity:	O(1)
+ * Input:
+ *		key:		const K&类型，键
+ * Output:
+ * Return:			int类型，操作成功返回0，不存在返回-2
+ */
+template <typename K, typename V>
+int LRU_CACHE<K, V>::Erase(const K& key)
+{
+	typename std::unordered_map<K, NODE*>::iterator it = this->index.find(key);
+	if (it == this->index.end())
+	{
+		return -2;
+	}
+
+	NODE* node = it->second;
+	this->index.erase(it);
+	this->Unlink(node);
+	this->FreeNode(node);
+	this->size --;
+	return 0;
+}
+
+
+
+/*
+ * Function:		EvictTail()
+ * Description:		淘汰最久未使用的项，结点放入空闲链表
+ * Time complexity:	O(1)，与类K、V的赋值操作符时间复杂度相同
+ * Input:
+ * Output:
+ *		out_key:	K&类型，被淘汰项的键
+ *		out_value:	V&类型，被淘汰项的值
+ * Return:			int类型，操作成功返回0，缓存为空返回-2
+ */
+template <typename K, typename V>
+int LRU_CACHE<K, V>::EvictTail(K& out_key, V& out_value)
+{
+	if (this->size == 0)
+	{
+		return -2;
+	}
+
+	NODE* node = this->sentinel.GetPriorNode();
+	out_key = node->GetDataRef().key;
+	out_value = node->GetDataRef().value;
+	this->index.erase(out_key);
+	this->Unlink(node);
+	this->FreeNode(node);
+	this->size --;
+	return 0;
+}
+
+
+
+/*
+ * Function:		Traverse()
+ * Description:		从最近使用到最久未使用的顺序遍历缓存，不改变使用顺序
+ * Time complexity:	O(n*t)，t为visit()的时间复杂度
+ * Input:
+ *		visit:		int (*)(const K& key, V& value)类型，函数指针，以键和值的引用为参数
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename K, typename V>
+int LRU_CACHE<K, V>::Traverse(int (*visit)(const K& key, V& value))
+{
+	NODE* current_node = this->sentinel.GetNextNode();
+	while (current_node != &this->sentinel)
+	{
+		if (visit(current_node->GetDataRef().key, current_node->GetDataRef().value) != 0)
+		{
+			cout << "func LRU_CACHE<K, V>::Traverse() err: func_status != 0" << endl;
+			return -1;
+		}
+		current_node = current_node->GetNextNode();
+	}
+	return 0;
+}
+
+
+
+/*
+ * Function:		Unlink()
+ * Description:		将结点从使用顺序链表中摘下
+ * Time complexity:	O(1)
+ * Input:
+ *		node:		NODE*类型，要摘下的结点
+ * Output:
+ * Return:
+ */
+template <typename K, typename V>
+void LRU_CACHE<K, V>::Unlink(NODE* node)
+{
+	node->GetPriorNode()->SetNextNode(node->GetNextNode());
+	node->GetNextNode()->SetPriorNode(node->GetPriorNode());
+}
+
+
+
+/*
+ * Function:		LinkFront()
+ * Description:		将结点插入到最近使用的位置
+ * Time complexity:	O(1)
+ * Input:
+ *		node:		NODE*类型，要插入的结点
+ * Output:
+ * Return:
+ */
+template <typename K, typename V>
+void LRU_CACHE<K, V>::LinkFront(NODE* node)
+{
+	NODE* first_node = this->sentinel.GetNextNode();
+	node->SetNextNode(first_node);
+	node->SetPriorNode(&this->sentinel);
+	first_node->SetPriorNode(node);
+	this->sentinel.SetNextNode(node);
+}
+
+
+
+/*
+ * Function:		AllocNode()
+ * Description:		从空闲链表取一个结点，空闲链表为空时申请新结点
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			NODE*类型，操作成功返回结点地址，操作失败返回NULL
+ */
+template <typename K, typename V>
+typename LRU_CACHE<K, V>::NODE* LRU_CACHE<K, V>::AllocNode()
+{
+	if (this->free_nodes == NULL)
+	{
+		return new NODE();
+	}
+
+	NODE* node = this->free_nodes;
+	this->free_nodes = node->GetNextNode();
+	return node;
+}
+
+
+
+/*
+ * Function:		FreeNode()
+ * Description:		将结点的键和值重置为默认值后放入空闲链表，被删除或淘汰的值持有的资源随之释放，不会留到结点被重用或缓存析构
+ * Time complexity:	与类K、V的无参构造函数和赋值操作符时间复杂度相同
+ * Input:
+ *		node:		NODE*类型，要放入的结点
+ * Output:
+ * Return:
+ */
+template <typename K, typename V>
+void LRU_CACHE<K, V>::FreeNode(NODE* node)
+{
+	node->GetDataRef() = LRU_CACHE_ENTRY<K, V>();
+	node->SetNextNode(this->free_nodes);
+	this->free_nodes = node;
+}
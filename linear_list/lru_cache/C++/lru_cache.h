@@ -0,0 +1,233 @@
+/*****************************************************************************************************************************
+ * File name:	lru_cache.h
+ * Author:	guoke
+ * Date:	2026.10.19
+ * Description:	C++ LRU缓存的头文件，该文件包含了模板类LRU_CACHE的声明，其实现包含在文件lru_cache.cpp中。
+ *				缓存项按最近使用的顺序串在一个带哨兵结点的双向循环链表上（结点类型为link_list.h中的LIST_NODE），
+ *				哨兵的后继是最近使用的项，前驱是最久未使用的项；另用哈希表记录键到结点的映射，查找、提到表头、淘汰表尾都是O(1)。
+ *				被淘汰或删除的结点放入空闲链表循环使用，移动结点只修改指针，不重新申请内存。
+ *				类K需要能作为std::unordered_map的键（支持std::hash<K>和==操作符）。
+ * History:	1. 2026.10.19 创建并完成初始版本
+ *			2. 2026.10.19 FreeNode()重置结点的键和值
+ ****************************************************************************************************************************/
+
+#ifndef _LRU_CACHE_H_
+#define _LRU_CACHE_H_
+
+#include <unordered_map>
+#include "../../link_list/C++/link_list.h"
+
+/* 缓存项，链表结点的数据域 */
+template <typename K, typename V>
+struct LRU_CACHE_ENTRY{
+	K	key;				// 键
+	V	value;				// 值
+};
+
+
+
+/****************************************************************** LRU_CACHE类型，LRU缓存 ****************************************************************/
+template <typename K, typename V>
+class LRU_CACHE{
+private:
+	typedef LIST_NODE< LRU_CACHE_ENTRY<K, V> > NODE;
+
+	NODE								sentinel;			// 哨兵结点，后继为最近使用的项，前驱为最久未使用的项
+	NODE*								free_nodes;			// 空闲结点链表，只用后继指针串联
+	std::unordered_map<K, NODE*>		index;				// 键到结点的映射
+	int									capacity;			// 缓存容量
+	int									size;				// 缓存项个数
+
+public:
+	/*
+	 * Function:		LRU_CACHE()
+	 * Description:		LRU_CACHE类的有参构造函数，构造一个空缓存并为哈希表预留capacity个位置
+	 * Time complexity:	O(capacity)
+	 * Input:
+	 *		my_capacity:	int类型，缓存容量，小于1时按1处理
+	 * Output:
+	 * Return:
+	 */
+	LRU_CACHE(int my_capacity);
+
+	/*
+	 * Function:		~LRU_CACHE()
+	 * Description:		LRU_CACHE类的析构函数，释放所有缓存项和空闲结点
+	 * Time complexity:	O(n)
+	 * Input:
+	 * Output:
+	 * Return:
+	 */
+	~LRU_CACHE();
+
+private:
+	LRU_CACHE(const LRU_CACHE&);				// 禁止拷贝
+	LRU_CACHE& operator=(const LRU_CACHE&);
+
+public:
+	/*
+	 * Function:		Clear()
+	 * Description:		清空缓存，所有结点放入空闲链表
+	 * Time complexity:	O(n)
+	 * Input:
+	 * Output:
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int Clear();
+
+	/*
+	 * Function:		GetSize()
+	 * Description:		获取缓存项个数
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			int类型，缓存项个数
+	 */
+	int GetSize() const;
+
+	/*
+	 * Function:		GetCapacity()
+	 * Description:		获取缓存容量
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			int类型，缓存容量
+	 */
+	int GetCapacity() const;
+
+	/*
+	 * Function:		IsEmpty()
+	 * Description:		判断缓存是否为空
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			bool类型，如果缓存为空返回true，否则返回false
+	 */
+	bool IsEmpty() const;
+
+	/*
+	 * Function:		Get()
+	 * Description:		查找键对应的值，找到时将该项移到最近使用的位置
+	 * Time complexity:	O(1)，与类V的赋值操作符时间复杂度相同
+	 * Input:
+	 *		key:		const K&类型，查找的键
+	 * Output:
+	 *		out_value:	V&类型，找到时通过该引用将值传给调用者
+	 * Return:			int类型，找到返回0，不存在返回-2
+	 */
+	int Get(const K& key, V& out_value);
+
+	/*
+	 * Function:		Peek()
+	 * Description:		查找键对应的值，不改变使用顺序
+	 * Time complexity:	O(1)，与类V的赋值操作符时间复杂度相同
+	 * Input:
+	 *		key:		const K&类型，查找的键
+	 * Output:
+	 *		out_value:	V&类型，找到时通过该引用将值传给调用者
+	 * Return:			int类型，找到返回0，不存在返回-2
+	 */
+	int Peek(const K& key, V& out_value) const;
+
+	/*
+	 * Function:		Put()
+	 * Description:		插入或更新键值对，并将该项移到最近使用的位置。缓存已满时先淘汰最久未使用的项，并复用其结点
+	 * Time complexity:	O(1)，与类K、V的赋值操作符时间复杂度相同
+	 * Input:
+	 *		key:		const K&类型，键
+	 *		value:		const V&类型，值
+	 * Output:
+	 * Return:			int类型，插入新项返回0，更新已有项返回1，操作失败返回负数
+	 */
+	int Put(const K& key, const V& value);
+
+	/*
+	 * Function:		Touch()
+	 * Description:		将键对应的项移到最近使用的位置，不读取值
+	 * Time complexity:	O(1)
+	 * Input:
+	 *		key:		const K&类型，键
+	 * Output:
+	 * Return:			int类型，操作成功返回0，不存在返回-2
+	 */
+	int Touch(const K& key);
+
+	/*
+	 * Function:		Erase()
+	 * Description:		删除键对应的项，结点放入空闲链表
+	 * Time complexity:	O(1)
+	 * Input:
+	 *		key:		const K&类型，键
+	 * Output:
+	 * Return:			int类型，操作成功返回0，不存在返回-2
+	 */
+	int Erase(const K& key);
+
+	/*
+	 * Function:		EvictTail()
+	 * Description:		淘汰最久未使用的项，结点放入空闲链表
+	 * Time complexity:	O(1)，与类K、V的赋值操作符时间复杂度相同
+	 * Input:
+	 * Output:
+	 *		out_key:	K&类型，被淘汰项的键
+	 *		out_value:	V&类型，被淘汰项的值
+	 * Return:			int类型，操作成功返回0，缓存为空返回-2
+	 */
+	int EvictTail(K& out_key, V& out_value);
+
+	/*
+	 * Function:		Traverse()
+	 * Description:		从最近使用到最久未使用的顺序遍历缓存，不改变使用顺序
+	 * Time complexity:	O(n*t)，t为visit()的时间复杂度
+	 * Input:
+	 *		visit:		int (*)(const K& key, V& value)类型，函数指针，以键和值的引用为参数
+	 * Output:
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int Traverse(int (*visit)(const K& key, V& value));
+
+private:
+	/*
+	 * Function:		Unlink()
+	 * Description:		将结点从使用顺序链表中摘下
+	 * Time complexity:	O(1)
+	 * Input:
+	 *		node:		NODE*类型，要摘下的结点
+	 * Output:
+	 * Return:
+	 */
+	void Unlink(NODE* node);
+
+	/*
+	 * Function:		LinkFront()
+	 * Description:		将结点插入到最近使用的位置
+	 * Time complexity:	O(1)
+	 * Input:
+	 *		node:		NODE*类型，要插入的结点
+	 * Output:
+	 * Return:
+	 */
+	void LinkFront(NODE* node);
+
+	/*
+	 * Function:		AllocNode()
+	 * Description:		从空闲链表取一个结点，空闲链表为空时申请新结点
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			NODE*类型，操作成功返回结点地址，操作失败返回NULL
+	 */
+	NODE* AllocNode();
+
+	/*
+	 * Function:		FreeNode()
+	 * Description:		将结点的键和值重置为默认值后放入空闲链表
+	 * Time complexity:	与类K、V的无参构造函数和赋值操作符时间复杂度相同
+	 * Input:
+	 *		node:		NODE*类型，要放入的结点
+	 * Output:
+	 * Return:
+	 */
+	void FreeNode(NODE* node);
+};
+#endif
@@ -0,0 +1,98 @@
+/******************************************************************************************************************************************
+ * File name:	test.cpp
+ * Author:	guoke
+ * Date:	2026.10.19
+ * Description:	C++ LRU缓存库lru_cache.cpp、lru_cache.h的API测试程序
+ * History:	1. 2026.10.19 创建并完成初始版本
+ *			2. 2026.10.19 增加被淘汰的值不再被空闲结点持有的测试
+ *****************************************************************************************************************************************/
+
+#include <iostream>
+#include <string>
+#include <memory>
+#include "lru_cache.cpp"
+
+using namespace std;
+
+// 打印缓存项
+int PrintEntry(const int& key, string& value);
+
+int main(void)
+{
+	string value;
+	int key = 0;
+
+	// 创建缓存
+	cout << "\n***************************************** 创建缓存 **********************************" << endl;
+	LRU_CACHE<int, string> cache(3);
+	cout << "capacity = " << cache.GetCapacity() << ", size = " << cache.GetSize() << ", empty = " << cache.IsEmpty() << endl;
+
+	// 插入缓存项
+	cout << "\n***************************************** 插入缓存项 **********************************" << endl;
+	cout << "put 1: " << cache.Put(1, "one") << endl;
+	cout << "put 2: " << cache.Put(2, "two") << endl;
+	cout << "put 3: " << cache.Put(3, "three") << endl;
+	cout << "put 2 again: " << cache.Put(2, "TWO") << endl;
+	cache.Traverse(PrintEntry);
+
+	// 查找缓存项
+	cout << "\n***************************************** 查找缓存项 **********************************" << endl;
+	cout << "get 1: " << cache.Get(1, value) << ", value = " << value << endl;
+	cout << "get 4: " << cache.Get(4, value) << endl;
+	cout << "peek 3: " << cache.Peek(3, value) << ", value = " << value << endl;
+	cache.Traverse(PrintEntry);
+
+	// 缓存已满时插入，淘汰最久未使用的项
+	cout << "\n***************************************** 缓存已满时插入 **********************************" << endl;
+	cout << "put 4: " << cache.Put(4, "four") << endl;
+	cout << "get 3: " << cache.Get(3, value) << endl;
+	cache.Traverse(PrintEntry);
+
+	// 移到表头、删除和淘汰表尾
+	cout << "\n***************************************** 移到表头、删除和淘汰表尾 **********************************" << endl;
+	cout << "touch 2: " << cache.Touch(2) << ", touch 3: " << cache.Touch(3) << endl;
+	cache.Traverse(PrintEntry);
+	cout << "erase 4: " << cache.Erase(4) << ", erase 4 again: " << cache.Erase(4) << endl;
+	cout << "evict tail: " << cache.EvictTail(key, value) << ", key = " << key << ", value = " << value << endl;
+	cout << "size = " << cache.GetSize() << endl;
+	cache.Traverse(PrintEntry);
+
+	// 清空缓存
+	cout << "\n***************************************** 清空缓存 **********************************" << endl;
+	cache.Clear();
+	cout << "size = " << cache.GetSize() << ", evict tail: " << cache.EvictTail(key, value) << endl;
+	cout << "put 5: " << cache.Put(5, "five") << endl;
+	cache.Traverse(PrintEntry);
+
+	// 被删除或淘汰的值不再被空闲结点持有
+	cout << "\n***************************************** 释放被淘汰的值 **********************************" << endl;
+	{
+		LRU_CACHE<int, shared_ptr<int> > ptr_cache(2);
+		shared_ptr<int> first_ptr = make_shared<int>(1);
+		shared_ptr<int> second_ptr = make_shared<int>(2);
+		shared_ptr<int> third_ptr = make_shared<int>(3);
+		shared_ptr<int> evicted_ptr;
+		int evicted_key = 0;
+
+		ptr_cache.Put(1, first_ptr);
+		ptr_cache.Put(2, second_ptr);
+		ptr_cache.Put(3, third_ptr);				// 淘汰1
+		ptr_cache.Erase(2);
+		cout << "use_count: evicted " << first_ptr.use_count() << ", erased " << second_ptr.use_count() << ", cached " << third_ptr.use_count() << endl;
+		ptr_cache.EvictTail(evicted_key, evicted_ptr);
+		evicted_ptr.reset();
+		cout << "after EvictTail: " << third_ptr.use_count() << endl;
+	}
+
+	cout << "Hello world!" << endl;
+	return 0;
+}
+
+
+
+// 打印缓存项
+int PrintEntry(const int& key, string& value)
+{
+	cout << "key = " << key << "\tvalue = " << value << endl;
+	return 0;
+}
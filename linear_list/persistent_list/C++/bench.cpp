@@ -0,0 +1,131 @@
+/******************************************************************************************************************************************
+ * File name:	bench.cpp
+ * Author:	guoke
+ * Date:	2026.10.19
+ * Description:	C++持久化链表与整表拷贝快照的对比程序。从一个n个结点的链表开始生成若干个版本，每个版本在前一个版本的基础上
+ *				在表头插入一个结点并修改前100个结点中的一个，所有版本都保留。LINK_LIST每个版本拷贝整个链表，PERSISTENT_LIST只复制修改位置之前的结点。
+ *				通过重载全局operator new统计两种方式申请的内存。
+ *				用法：./bench [结点数] [版本数]
+ * History:	1. 2026.10.19 创建并完成初始版本
+ *****************************************************************************************************************************************/
+
+#include <iostream>
+#include <cstdlib>
+#include <chrono>
+#include <new>
+#include <vector>
+#include "persistent_list.cpp"
+#include "../../link_list/C++/link_list.cpp"
+
+using namespace std;
+
+static size_t allocated_bytes = 0;			// 重载的operator new累计申请的字节数
+
+void* operator new(size_t size)
+{
+	allocated_bytes += size;
+	void* memory = malloc(size);
+	if (memory == NULL)
+	{
+		throw bad_alloc();
+	}
+	return memory;
+}
+
+void operator delete(void* memory) noexcept
+{
+	free(memory);
+}
+
+void operator delete(void* memory, size_t size) noexcept
+{
+	(void)size;
+	free(memory);
+}
+
+// 获取当前时间，单位为秒
+double NowSeconds();
+
+int main(int argc, char* argv[])
+{
+	int node_num = (argc > 1) ? atoi(argv[1]) : 100000;
+	int version_num = (argc > 2) ? atoi(argv[2]) : 200;
+	vector<int> positions(version_num);
+	srand(1);
+	for (int i = 0; i < version_num; ++i)
+	{
+		positions[i] = rand() % 100;
+	}
+	cout << "nodes = " << node_num << ", versions = " << version_num << endl;
+
+	// 整表拷贝：每个版本拷贝前一个版本，再插入和修改
+	vector<LINK_LIST<int>*> copies;
+	copies.reserve(version_num + 1);
+	copies.push_back(new LINK_LIST<int>());
+	for (int i = 0; i < node_num; ++i)
+	{
+		copies[0]->Insert(copies[0]->end(), i);
+	}
+	size_t start_bytes = allocated_bytes;
+	double start = NowSeconds();
+	for (int v = 0; v < version_num; ++v)
+	{
+		LINK_LIST<int>* version = new LINK_LIST<int>();
+		for (LINK_LIST<int>::iterator it = copies[v]->begin(); it != copies[v]->end(); ++it)
+		{
+			version->Insert(version->end(), *it);
+		}
+		version->Insert(version->begin(), -v);
+		LINK_LIST<int>::iterator it = version->begin();
+		advance(it, positions[v]);
+		*it = v;
+		copies.push_back(version);
+	}
+	double copy_time = NowSeconds() - start;
+	size_t copy_bytes = allocated_bytes - start_bytes;
+
+	// 持久化链表：每个版本只复制修改位置之前的结点
+	vector< PERSISTENT_LIST<int> > versions(1);
+	versions.reserve(version_num + 1);
+	for (int i = node_num - 1; i >= 0; --i)
+	{
+		versions[0].PushFront(i, versions[0]);
+	}
+	start_bytes = allocated_bytes;
+	start = NowSeconds();
+	for (int v = 0; v < version_num; ++v)
+	{
+		PERSISTENT_LIST<int> version;
+		versions[v].PushFront(-v, version);
+		version.Set(positions[v], v, version);
+		versions.push_back(version);
+	}
+	double persistent_time = NowSeconds() - start;
+	size_t persistent_bytes = allocated_bytes - start_bytes;
+
+	// 检查最后一个版本的内容相同
+	bool equal = true;
+	int index = 0;
+	for (LINK_LIST<int>::iterator it = copies[version_num]->begin(); it != copies[version_num]->end() && index < 200; ++it, ++index)
+	{
+		int data = 0;
+		versions[version_num].Get(index, data);
+		equal = equal && (data == *it);
+	}
+
+	cout << "full copies:\t" << copy_time << " s\t" << copy_bytes / 1024 << " KB" << endl;
+	cout << "persistent:\t" << persistent_time << " s\t" << persistent_bytes / 1024 << " KB" << endl;
+	cout << "memory ratio " << (double)copy_bytes / persistent_bytes << ", content " << (equal ? "equal" : "DIFFERENT") << endl;
+
+	for (size_t i = 0; i < copies.size(); ++i)
+	{
+		delete copies[i];
+	}
+	return 0;
+}
+
+// 获取当前时间，单位为秒
+double NowSeconds()
+{
+	return chrono::duration<double>(chrono::steady_clock::now().time_since_epoch()).count();
+}
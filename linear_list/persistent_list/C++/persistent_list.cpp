@@ -0,0 +1,540 @@
+/*****************************************************************************************************************************
+ * File name:	persistent_list.cpp
+ * Author:	guoke
+ * Date:	2026.10.19
+ * Description:	C++持久化链表的源文件，该文件包含了persistent_list.h中模板类PERSISTENT_LIST的实现。
+ * History:	1. 2026.10.19 创建并完成初始版本
+ ****************************************************************************************************************************/
+
+#include <iostream>
+#include "persistent_list.h"
+
+using namespace std;
+
+/****************************************************************** PERSISTENT_LIST类型API ****************************************************************/
+
+/*
+ * Function:		PERSISTENT_LIST()
+ * Description:		PERSISTENT_LIST类的无参构造函数，构造一个空表版本
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:
+ */
+template <typename T>
+PERSISTENT_LIST<T>::PERSISTENT_LIST():head(NULL), length(0)
+{
+}
+
+
+
+/*
+ * Function:		PERSISTENT_LIST()
+ * Description:		PERSISTENT_LIST类的拷贝构造函数，与list共享所有结点
+ * Time complexity:	O(1)
+ * Input:
+ *		list:		const PERSISTENT_LIST&类型，被拷贝的版本
+ * Output:
+ * Return:
+ */
+template <typename T>
+PERSISTENT_LIST<T>::PERSISTENT_LIST(const PERSISTENT_LIST& list):head(list.head), length(list.length)
+{
+	Retain(this->head);
+}
+
+
+
+/*
+ * Function:		~PERSISTENT_LIST()
+ * Description:		PERSISTENT_LIST类的析构函数，释放不再被任何版本引用的结点
+ * Time complexity:	O(k)，k为只属于本版本的结点数
+ * Input:
+ * Output:
+ * Return:
+ */
+template <typename T>
+PERSISTENT_LIST<T>::~PERSISTENT_LIST()
+{
+	Release(this->head);
+}
+
+
+
+/*
+ * Function:		operator=()
+ * Description:		赋值操作符，本对象改为与list共享所有结点，原来的结点不再被引用时释放
+ * Time complexity:	O(k)，k为只属于原版本的结点数
+ * Input:
+ *		list:		const PERSISTENT_LIST&类型，赋值的版本
+ * Output:
+ * Return:			PERSISTENT_LIST&类型，自身的引用
+ */
+template <typename T>
+PERSISTENT_LIST<T>& PERSISTENT_LIST<T>::operator=(const PERSISTENT_LIST& list)
+{
+	if (this != &list)
+	{
+		// 先取得新引用再释放旧引用，两个版本共享结点时不会提前释放
+		Retain(list.head);
+		this->Assign(list.head, list.length);
+	}
+	return *this;
+}
+
+
+
+/*
+ * Function:		Clear()
+ * Description:		本对象改为空表版本，其他版本不受影响
+ * Time complexity:	O(k)，k为只属于本版本的结点数
+ * Input:
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int PERSISTENT_LIST<T>::Clear()
+{
+	this->Assign(NULL, 0);
+	return 0;
+}
+
+
+
+/*
+ * Function:		GetLength()
+ * Description:		获取链表长度
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			int类型，链表长度
+ */
+template <typename T>
+int PERSISTENT_LIST<T>::GetLength() const
+{
+	return this->length;
+}
+
+
+
+/*
+ * Function:		IsEmpty()
+ * Description:		判断链表是否为空表
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			bool类型，如果链表为空表返回true，否则返回false
+ */
+template <typename T>
+bool PERSISTENT_LIST<T>::IsEmpty() const
+{
+	return (this->length == 0) ? true : false;
+}
+
+
+
+/*
+ * Function:		GetFront()
+ * Description:		获取第一个结点的数据
+ * Time complexity:	与类T的赋值操作符时间复杂度相同
+ * Input:
+ * Output:
+ *		out_data:	T&类型，第一个结点的数据
+ * Return:			int类型，操作成功返回0，空表返回负数
+ */
+template <typename T>
+int PERSISTENT_LIST<T>::GetFront(T& out_data) const
+{
+	if (this->length == 0)
+	{
+		cout << "func PERSISTENT_LIST<T>::GetFront() err: this->length == 0" << endl;
+		return -1;
+	}
+
+	out_data = this->head->data;
+	return 0;
+}
+
+
+
+/*
+ * Function:		Get()
+ * Description:		获取第index个结点（从0开始）的数据
+ * Time complexity:	O(index)
+ * Input:
+ *		index:		int类型，结点下标，0 <= index < length
+ * Output:
+ *		out_data:	T&类型，结点的数据
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int PERSISTENT_LIST<T>::Get(int index, T& out_data) const
+{
+	if (index < 0 || index >= this->length)
+	{
+		cout << "func PERSISTENT_LIST<T>::Get() err: index < 0 || index >= this->length" << endl;
+		return -1;
+	}
+
+	PERSISTENT_LIST_NODE<T>* current_node = this->head;
+	for (int i = 0; i < index; ++i)
+	{
+		current_node = current_node->next;
+	}
+	out_data = current_node->data;
+	return 0;
+}
+
+
+
+/*
+ * Function:		PushFront()
+ * Description:		生成在表头插入data的新版本，新版本与本版本共享全部原有结点
+ * Time complexity:	O(1)，与类T的拷贝构造函数时间复杂度相同
+ * Input:
+ *		data:		const T&类型，插入的数据
+ * Output:
+ *		out_version:	PERSISTENT_LIST&类型，新版本，可以是本对象
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int PERSISTENT_LIST<T>::PushFront(const T& data, PERSISTENT_LIST& out_version) const
+{
+	PERSISTENT_LIST_NODE<T>* new_node = new PERSISTENT_LIST_NODE<T>(data, this->head);
+	if (new_node == NULL)
+	{
+		cout << "func PERSISTENT_LIST<T>::PushFront() err: new_node == NULL" << endl;
+		return -1;
+	}
+
+	// 新结点持有原第一个结点的一个引用
+	Retain(this->head);
+	out_version.Assign(new_node, this->length + 1);
+	return 0;
+}
+
+
+
+/*
+ * Function:		PopFront()
+ * Description:		生成删除第一个结点的新版本，新版本与本版本共享其余结点
+ * Time complexity:	O(1)，与类T的赋值操作符时间复杂度相同
+ * Input:
+ * Output:
+ *		out_data:		T&类型，被删除结点的数据
+ *		out_version:	PERSISTENT_LIST&类型，新版本，可以是本对象
+ * Return:			int类型，操作成功返回0，空表返回负数
+ */
+template <typename T>
+int PERSISTENT_LIST<T>::PopFront(T& out_data, PERSISTENT_LIST& out_version) const
+{
+	if (this->length == 0)
+	{
+		cout << "func PERSISTENT_LIST<T>::PopFront() err: this->length == 0" << endl;
+		return -1;
+	}
+
+	out_data = this->head->data;
+	Retain(this->head->next);
+	out_version.Assign(this->head->next, this->length - 1);
+	return 0;
+}
+
+
+
+/*
+ * Function:		Insert()
+ * Description:		生成在第index个位置插入data的新版本，复制前index个结点，之后的结点与本版本共享
+ * Time complexity:	假设类T的拷贝构造函数时间复杂度为O(m)，则本函数时间复杂度为O(index*m)
+ * Input:
+ *		index:		int类型，插入位置，0 <= index <= length，等于length时插入到表尾
+ *		data:		const T&类型，插入的数据
+ * Output:
+ *		out_version:	PERSISTENT_LIST&类型，新版本，可以是本对象
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int PERSISTENT_LIST<T>::Insert(int index, const T& data, PERSISTENT_LIST& out_version) const
+{
+	if (index < 0 || index > this->length)
+	{
+		cout << "func PERSISTENT_LIST<T>::Insert() err: index < 0 || index > this->length" << endl;
+		return -1;
+	}
+
+	// 第index个结点及其之后的结点共享，插入的结点持有它的一个引用
+	PERSISTENT_LIST_NODE<T>* shared_node = this->head;
+	for (int i = 0; i < index; ++i)
+	{
+		shared_node = shared_node->next;
+	}
+	PERSISTENT_LIST_NODE<T>* new_node = new PERSISTENT_LIST_NODE<T>(data, shared_node);
+	if (new_node == NULL)
+	{
+		cout << "func PERSISTENT_LIST<T>::Insert() err: new_node == NULL" << endl;
+		return -1;
+	}
+	Retain(shared_node);
+
+	PERSISTENT_LIST_NODE<T>* new_head = this->CopyPrefix(index, new_node);
+	if (new_head == NULL)
+	{
+		cout << "func PERSISTENT_LIST<T>::Insert() err: new_head == NULL" << endl;
+		return -1;
+	}
+	out_version.Assign(new_head, this->length + 1);
+	return 0;
+}
+
+
+
+/*
+ * Function:		Erase()
+ * Description:		生成删除第index个结点的新版本，复制前index个结点，之后的结点与本版本共享
+ * Time complexity:	假设类T的拷贝构造函数时间复杂度为O(m)，则本函数时间复杂度为O(index*m)
+ * Input:
+ *		index:		int类型，删除位置，0 <= index < length
+ * Output:
+ *		out_version:	PERSISTENT_LIST&类型，新版本，可以是本对象
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int PERSISTENT_LIST<T>::Erase(int index, PERSISTENT_LIST& out_version) const
+{
+	if (index < 0 || index >= this->length)
+	{
+		cout << "func PERSISTENT_LIST<T>::Erase() err: index < 0 || index >= this->length" << endl;
+		return -1;
+	}
+
+	// 第index + 1个结点及其之后的结点共享
+	PERSISTENT_LIST_NODE<T>* erased_node = this->head;
+	for (int i = 0; i < index; ++i)
+	{
+		erased_node = erased_node->next;
+	}
+	PERSISTENT_LIST_NODE<T>* shared_node = erased_node->next;
+	Retain(shared_node);
+
+	PERSISTENT_LIST_NODE<T>* new_head = this->CopyPrefix(index, shared_node);
+	if (new_head == NULL && index > 0)
+	{
+		cout << "func PERSISTENT_LIST<T>::Erase() err: new_head == NULL" << endl;
+		return -1;
+	}
+	out_version.Assign(new_head, this->length - 1);
+	return 0;
+}
+
+
+
+/*
+ * Function:		Set()
+ * Description:		生成把第index个结点的数据改为data的新版本，复制前index + 1个结点，之后的结点与本版本共享
+ * Time complexity:	假设类T的拷贝构造函数时间复杂度为O(m)，则本函数时间复杂度为O(index*m)
+ * Input:
+ *		index:		int类型，修改位置，0 <= index < length
+ *		data:		const T&类型，新的数据
+ * Output:
+ *		out_version:	PERSISTENT_LIST&类型，新版本，可以是本对象
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int PERSISTENT_LIST<T>::Set(int index, const T& data, PERSISTENT_LIST& out_version) const
+{
+	if (index < 0 || index >= this->length)
+	{
+		cout << "func PERSISTENT_LIST<T>::Set() err: index < 0 || index >= this->length" << endl;
+		return -1;
+	}
+
+	// 用新结点代替第index个结点，其后继共享
+	PERSISTENT_LIST_NODE<T>* old_node = this->head;
+	for (int i = 0; i < index; ++i)
+	{
+		old_node = old_node->next;
+	}
+	PERSISTENT_LIST_NODE<T>* new_node = new PERSISTENT_LIST_NODE<T>(data, old_node->next);
+	if (new_node == NULL)
+	{
+		cout << "func PERSISTENT_LIST<T>::Set() err: new_node == NULL" << endl;
+		return -1;
+	}
+	Retain(old_node->next);
+
+	PERSISTENT_LIST_NODE<T>* new_head = this->CopyPrefix(index, new_node);
+	if (new_head == NULL)
+	{
+		cout << "func PERSISTENT_LIST<T>::Set() err: new_head == NULL" << endl;
+		return -1;
+	}
+	out_version.Assign(new_head, this->length);
+	return 0;
+}
+
+
+
+/*
+ * Function:		Traverse()
+ * Description:		从第一个结点开始遍历本版本，以每个结点的数据为参数调用visit()，数据是只读的
+ * Time complexity:	假设visit()的时间复杂度为O(t)，则本函数时间复杂度为O(n*t)
+ * Input:
+ *		visit:		int (*)(const T& data)类型，函数指针
+ * Output:
+ * Return:			int类型，操作成功返回0，visit()返回非0时返回负数
+ */
+template <typename T>
+int PERSISTENT_LIST<T>::Traverse(int (*visit)(const T& data)) const
+{
+	for (PERSISTENT_LIST_NODE<T>* current_node = this->head; current_node != NULL; current_node = current_node->next)
+	{
+		if (visit(current_node->data) != 0)
+		{
+			cout << "func PERSISTENT_LIST<T>::Traverse() err: func_status != 0" << endl;
+			return -1;
+		}
+	}
+	return 0;
+}
+
+
+
+/*
+ * Function:		SharesTailWith()
+ * Description:		计算本版本与list从表尾算起共享的结点数，两个版本共享一个结点时，该结点之后的结点也都共享
+ * Time complexity:	O(n + n')
+ * Input:
+ *		list:		const PERSISTENT_LIST&类型，另一个版本
+ * Output:
+ * Return:			int类型，共享的结点数
+ */
+template <typename T>
+int PERSISTENT_LIST<T>::SharesTailWith(const PERSISTENT_LIST& list) const
+{
+	// 先让较长的版本走过多出的结点，两边剩余长度相同之后同步前进，第一个相同的结点开始都是共享的
+	PERSISTENT_LIST_NODE<T>* node_a = this->head;
+	PERSISTENT_LIST_NODE<T>* node_b = list.head;
+	int rest = this->length;
+	for (int i = list.length; i < rest; ++i)
+	{
+		node_a = node_a->next;
+	}
+	for (int i = this->length; i < list.length; ++i)
+	{
+		node_b = node_b->next;
+	}
+	rest = (this->length < list.length) ? this->length : list.length;
+
+	while (node_a != node_b)
+	{
+		node_a = node_a->next;
+		node_b = node_b->next;
+		rest --;
+	}
+	return rest;
+}
+
+
+
+/*
+ * Function:		Retain()
+ * Description:		结点的引用计数加1
+ * Time complexity:	O(1)
+ * Input:
+ *		node:		PERSISTENT_LIST_NODE<T>*类型，结点，可以为NULL
+ * Output:
+ * Return:
+ */
+template <typename T>
+void PERSISTENT_LIST<T>::Retain(PERSISTENT_LIST_NODE<T>* node)
+{
+	if (node != NULL)
+	{
+		// 调用者已经持有一个引用，计数不会在这里从0变成1，不需要同步其他内存
+		node->refs.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+
+
+/*
+ * Function:		Release()
+ * Description:		结点的引用计数减1，降为0时释放该结点并继续释放其后继，循环而不是递归，长链表不会栈溢出
+ * Time complexity:	O(k)，k为释放的结点数
+ * Input:
+ *		node:		PERSISTENT_LIST_NODE<T>*类型，结点，可以为NULL
+ * Output:
+ * Return:
+ */
+template <typename T>
+void PERSISTENT_LIST<T>::Release(PERSISTENT_LIST_NODE<T>* node)
+{
+	while (node != NULL)
+	{
+		// 最后一个引用的释放者要看到其他线程之前对结点的所有访问，用acq_rel
+		if (node->refs.fetch_sub(1, std::memory_order_acq_rel) != 1)
+		{
+			return;
+		}
+		PERSISTENT_LIST_NODE<T>* next_node = node->next;
+		delete node;
+		node = next_node;
+	}
+}
+
+
+
+/*
+ * Function:		CopyPrefix()
+ * Description:		复制本版本的前count个结点，最后一个副本的后继为tail（tail的引用转交给副本链），用于生成新版本
+ * Time complexity:	假设类T的拷贝构造函数时间复杂度为O(m)，则本函数时间复杂度为O(count*m)
+ * Input:
+ *		count:		int类型，复制的结点数，0 <= count <= length
+ *		tail:		PERSISTENT_LIST_NODE<T>*类型，副本链的后继，调用者已为其持有一个引用
+ * Output:
+ * Return:			PERSISTENT_LIST_NODE<T>*类型，副本链的第一个结点，count为0时返回tail，操作失败时释放tail的引用并返回NULL
+ */
+template <typename T>
+PERSISTENT_LIST_NODE<T>* PERSISTENT_LIST<T>::CopyPrefix(int count, PERSISTENT_LIST_NODE<T>* tail) const
+{
+	PERSISTENT_LIST_NODE<T>* new_head = NULL;
+	PERSISTENT_LIST_NODE<T>** link = &new_head;			// 指向最后一个副本的后继指针
+	PERSISTENT_LIST_NODE<T>* source_node = this->head;
+	for (int i = 0; i < count; ++i)
+	{
+		PERSISTENT_LIST_NODE<T>* new_node = new PERSISTENT_LIST_NODE<T>(source_node->data, NULL);
+		if (new_node == NULL)
+		{
+			// 已复制的结点和tail的引用一起释放
+			*link = tail;
+			Release(new_head);
+			return NULL;
+		}
+		*link = new_node;
+		link = &new_node->next;
+		source_node = source_node->next;
+	}
+	*link = tail;
+	return new_head;
+}
+
+
+
+/*
+ * Function:		Assign()
+ * Description:		把本对象改为以new_head开头、长度为new_length的版本，接管new_head的一个引用并释放原来的引用
+ * Time complexity:	O(k)，k为只属于原版本的结点数
+ * Input:
+ *		new_head:	PERSISTENT_LIST_NODE<T>*类型，新版本的第一个结点
+ *		new_length:	int类型，新版本的长度
+ * Output:
+ * Return:
+ */
+template <typename T>
+void PERSISTENT_LIST<T>::Assign(PERSISTENT_LIST_NODE<T>* new_head, int new_length)
+{
+	PERSISTENT_LIST_NODE<T>* old_head = this->head;
+	this->head = new_head;
+	this->length = new_length;
+	Release(old_head);
+}
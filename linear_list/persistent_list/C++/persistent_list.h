@@ -0,0 +1,265 @@
+/*****************************************************************************************************************************
+ * File name:	persistent_list.h
+ * Author:	guoke
+ * Date:	2026.10.19
+ * Description:	C++持久化链表的头文件，该文件包含了模板类PERSISTENT_LIST的声明，其实现包含在文件persistent_list.cpp中。
+ *				链表一旦建立就不再修改，每个修改操作都生成一个新版本，新版本只复制修改位置之前的结点，之后的结点与旧版本共享（结构共享）。
+ *				结点是带引用计数的单链表结点，拷贝一个版本只把第一个结点的引用计数加1，是O(1)的；某个版本析构时只释放不再被任何版本引用的结点。
+ *				引用计数是原子变量，不同线程可以同时持有、拷贝和析构共享结点的不同版本对象，读者持有的版本不会被写者改变；
+ *				同一个PERSISTENT_LIST对象被多个线程同时修改时仍需调用者自己同步。
+ * History:	1. 2026.10.19 创建并完成初始版本
+ ****************************************************************************************************************************/
+
+#ifndef _PERSISTENT_LIST_H_
+#define _PERSISTENT_LIST_H_
+
+#include <atomic>
+
+/* 持久化链表的结点，创建之后数据和后继不再改变 */
+template <typename T>
+struct PERSISTENT_LIST_NODE{
+	T									data;			// 数据域
+	PERSISTENT_LIST_NODE*				next;			// 后继结点，结点持有后继的一个引用
+	std::atomic<int>					refs;			// 引用计数：前驱结点和以本结点开头的版本各持有一个引用
+
+	PERSISTENT_LIST_NODE(const T& my_data, PERSISTENT_LIST_NODE* my_next):data(my_data), next(my_next), refs(1){}
+};
+
+
+
+/****************************************************************** PERSISTENT_LIST类型，持久化链表的一个版本 ****************************************************************/
+template <typename T>
+class PERSISTENT_LIST{
+private:
+	PERSISTENT_LIST_NODE<T>*	head;				// 第一个结点，空表为NULL，本对象持有它的一个引用
+	int							length;				// 链表长度
+
+public:
+	/*
+	 * Function:		PERSISTENT_LIST()
+	 * Description:		PERSISTENT_LIST类的无参构造函数，构造一个空表版本
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:
+	 */
+	PERSISTENT_LIST();
+
+	/*
+	 * Function:		PERSISTENT_LIST()
+	 * Description:		PERSISTENT_LIST类的拷贝构造函数，与list共享所有结点
+	 * Time complexity:	O(1)
+	 * Input:
+	 *		list:		const PERSISTENT_LIST&类型，被拷贝的版本
+	 * Output:
+	 * Return:
+	 */
+	PERSISTENT_LIST(const PERSISTENT_LIST& list);
+
+	/*
+	 * Function:		~PERSISTENT_LIST()
+	 * Description:		PERSISTENT_LIST类的析构函数，释放不再被任何版本引用的结点
+	 * Time complexity:	O(k)，k为只属于本版本的结点数
+	 * Input:
+	 * Output:
+	 * Return:
+	 */
+	~PERSISTENT_LIST();
+
+	/*
+	 * Function:		operator=()
+	 * Description:		赋值操作符，本对象改为与list共享所有结点，原来的结点不再被引用时释放
+	 * Time complexity:	O(k)，k为只属于原版本的结点数
+	 * Input:
+	 *		list:		const PERSISTENT_LIST&类型，赋值的版本
+	 * Output:
+	 * Return:			PERSISTENT_LIST&类型，自身的引用
+	 */
+	PERSISTENT_LIST& operator=(const PERSISTENT_LIST& list);
+
+public:
+	/*
+	 * Function:		Clear()
+	 * Description:		本对象改为空表版本，其他版本不受影响
+	 * Time complexity:	O(k)，k为只属于本版本的结点数
+	 * Input:
+	 * Output:
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int Clear();
+
+	/*
+	 * Function:		GetLength()
+	 * Description:		获取链表长度
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			int类型，链表长度
+	 */
+	int GetLength() const;
+
+	/*
+	 * Function:		IsEmpty()
+	 * Description:		判断链表是否为空表
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			bool类型，如果链表为空表返回true，否则返回false
+	 */
+	bool IsEmpty() const;
+
+	/*
+	 * Function:		GetFront()
+	 * Description:		获取第一个结点的数据
+	 * Time complexity:	与类T的赋值操作符时间复杂度相同
+	 * Input:
+	 * Output:
+	 *		out_data:	T&类型，第一个结点的数据
+	 * Return:			int类型，操作成功返回0，空表返回负数
+	 */
+	int GetFront(T& out_data) const;
+
+	/*
+	 * Function:		Get()
+	 * Description:		获取第index个结点（从0开始）的数据
+	 * Time complexity:	O(index)
+	 * Input:
+	 *		index:		int类型，结点下标，0 <= index < length
+	 * Output:
+	 *		out_data:	T&类型，结点的数据
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int Get(int index, T& out_data) const;
+
+	/*
+	 * Function:		PushFront()
+	 * Description:		生成在表头插入data的新版本，新版本与本版本共享全部原有结点
+	 * Time complexity:	O(1)，与类T的拷贝构造函数时间复杂度相同
+	 * Input:
+	 *		data:		const T&类型，插入的数据
+	 * Output:
+	 *		out_version:	PERSISTENT_LIST&类型，新版本，可以是本对象
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int PushFront(const T& data, PERSISTENT_LIST& out_version) const;
+
+	/*
+	 * Function:		PopFront()
+	 * Description:		生成删除第一个结点的新版本，新版本与本版本共享其余结点
+	 * Time complexity:	O(1)，与类T的赋值操作符时间复杂度相同
+	 * Input:
+	 * Output:
+	 *		out_data:		T&类型，被删除结点的数据
+	 *		out_version:	PERSISTENT_LIST&类型，新版本，可以是本对象
+	 * Return:			int类型，操作成功返回0，空表返回负数
+	 */
+	int PopFront(T& out_data, PERSISTENT_LIST& out_version) const;
+
+	/*
+	 * Function:		Insert()
+	 * Description:		生成在第index个位置插入data的新版本，复制前index个结点，之后的结点与本版本共享
+	 * Time complexity:	假设类T的拷贝构造函数时间复杂度为O(m)，则本函数时间复杂度为O(index*m)
+	 * Input:
+	 *		index:		int类型，插入位置，0 <= index <= length，等于length时插入到表尾
+	 *		data:		const T&类型，插入的数据
+	 * Output:
+	 *		out_version:	PERSISTENT_LIST&类型，新版本，可以是本对象
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int Insert(int index, const T& data, PERSISTENT_LIST& out_version) const;
+
+	/*
+	 * Function:		Erase()
+	 * Description:		生成删除第index个结点的新版本，复制前index个结点，之后的结点与本版本共享
+	 * Time complexity:	假设类T的拷贝构造函数时间复杂度为O(m)，则本函数时间复杂度为O(index*m)
+	 * Input:
+	 *		index:		int类型，删除位置，0 <= index < length
+	 * Output:
+	 *		out_version:	PERSISTENT_LIST&类型，新版本，可以是本对象
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int Erase(int index, PERSISTENT_LIST& out_version) const;
+
+	/*
+	 * Function:		Set()
+	 * Description:		生成把第index个结点的数据改为data的新版本，复制前index + 1个结点，之后的结点与本版本共享
+	 * Time complexity:	假设类T的拷贝构造函数时间复杂度为O(m)，则本函数时间复杂度为O(index*m)
+	 * Input:
+	 *		index:		int类型，修改位置，0 <= index < length
+	 *		data:		const T&类型，新的数据
+	 * Output:
+	 *		out_version:	PERSISTENT_LIST&类型，新版本，可以是本对象
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int Set(int index, const T& data, PERSISTENT_LIST& out_version) const;
+
+	/*
+	 * Function:		Traverse()
+	 * Description:		从第一个结点开始遍历本版本，以每个结点的数据为参数调用visit()，数据是只读的
+	 * Time complexity:	假设visit()的时间复杂度为O(t)，则本函数时间复杂度为O(n*t)
+	 * Input:
+	 *		visit:		int (*)(const T& data)类型，函数指针
+	 * Output:
+	 * Return:			int类型，操作成功返回0，visit()返回非0时返回负数
+	 */
+	int Traverse(int (*visit)(const T& data)) const;
+
+	/*
+	 * Function:		SharesTailWith()
+	 * Description:		计算本版本与list从表尾算起共享的结点数，两个版本共享一个结点时，该结点之后的结点也都共享
+	 * Time complexity:	O(n + n')
+	 * Input:
+	 *		list:		const PERSISTENT_LIST&类型，另一个版本
+	 * Output:
+	 * Return:			int类型，共享的结点数
+	 */
+	int SharesTailWith(const PERSISTENT_LIST& list) const;
+
+private:
+	/*
+	 * Function:		Retain()
+	 * Description:		结点的引用计数加1
+	 * Time complexity:	O(1)
+	 * Input:
+	 *		node:		PERSISTENT_LIST_NODE<T>*类型，结点，可以为NULL
+	 * Output:
+	 * Return:
+	 */
+	static void Retain(PERSISTENT_LIST_NODE<T>* node);
+
+	/*
+	 * Function:		Release()
+	 * Description:		结点的引用计数减1，降为0时释放该结点并继续释放其后继，循环而不是递归，长链表不会栈溢出
+	 * Time complexity:	O(k)，k为释放的结点数
+	 * Input:
+	 *		node:		PERSISTENT_LIST_NODE<T>*类型，结点，可以为NULL
+	 * Output:
+	 * Return:
+	 */
+	static void Release(PERSISTENT_LIST_NODE<T>* node);
+
+	/*
+	 * Function:		CopyPrefix()
+	 * Description:		复制本版本的前count个结点，最后一个副本的后继为tail（tail的引用转交给副本链），用于生成新版本
+	 * Time complexity:	假设类T的拷贝构造函数时间复杂度为O(m)，则本函数时间复杂度为O(count*m)
+	 * Input:
+	 *		count:		int类型，复制的结点数，0 <= count <= length
+	 *		tail:		PERSISTENT_LIST_NODE<T>*类型，副本链的后继，调用者已为其持有一个引用
+	 * Output:
+	 * Return:			PERSISTENT_LIST_NODE<T>*类型，副本链的第一个结点，count为0时返回tail，操作失败时释放tail的引用并返回NULL
+	 */
+	PERSISTENT_LIST_NODE<T>* CopyPrefix(int count, PERSISTENT_LIST_NODE<T>* tail) const;
+
+	/*
+	 * Function:		Assign()
+	 * Description:		把本对象改为以new_head开头、长度为new_length的版本，接管new_head的一个引用并释放原来的引用
+	 * Time complexity:	O(k)，k为只属于原版本的结点数
+	 * Input:
+	 *		new_head:	PERSISTENT_LIST_NODE<T>*类型，新版本的第一个结点
+	 *		new_length:	int类型，新版本的长度
+	 * Output:
+	 * Return:
+	 */
+	void Assign(PERSISTENT_LIST_NODE<T>* new_head, int new_length);
+};
+#endif
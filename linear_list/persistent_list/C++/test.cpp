@@ -0,0 +1,155 @@
+/******************************************************************************************************************************************
+ * File name:	test.cpp
+ * Author:	guoke
+ * Date:	2026.10.19
+ * Description:	C++持久化链表库persistent_list.cpp、persistent_list.h的API测试程序
+ * History:	1. 2026.10.19 创建并完成初始版本
+ *****************************************************************************************************************************************/
+
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "persistent_list.cpp"
+
+using namespace std;
+
+// 打印结点数据
+int PrintData(const string& data);
+
+// 打印一个版本
+void PrintVersion(const char* name, const PERSISTENT_LIST<string>& version);
+
+// 读者线程：反复遍历自己持有的快照并求和，每个读者一个累加函数
+static long long reader_sums[2] = {0, 0};
+int SumReader0(const int& data);
+int SumReader1(const int& data);
+void ReadSnapshot(PERSISTENT_LIST<int> snapshot, int reader);
+
+int main(void)
+{
+	string data;
+
+	// 生成版本
+	cout << "\n***************************************** 生成版本 **********************************" << endl;
+	PERSISTENT_LIST<string> v0;
+	PERSISTENT_LIST<string> v1, v2, v3, v4, v5;
+	v0.PushFront("c", v0);
+	v0.PushFront("b", v0);
+	v0.PushFront("a", v0);							// v0: a b c
+	v0.PushFront("x", v1);							// v1: x a b c，与v0共享a b c
+	v0.Set(1, "B", v2);								// v2: a B c，只复制a和B
+	v0.Insert(3, "d", v3);							// v3: a b c d，复制全部3个结点
+	v1.Erase(2, v4);								// v4: x a c
+	PrintVersion("v0", v0);
+	PrintVersion("v1", v1);
+	PrintVersion("v2", v2);
+	PrintVersion("v3", v3);
+	PrintVersion("v4", v4);
+	cout << "shared tail: v0/v1 = " << v0.SharesTailWith(v1) << ", v0/v2 = " << v0.SharesTailWith(v2) << ", v0/v3 = " << v0.SharesTailWith(v3)
+		 << ", v1/v4 = " << v1.SharesTailWith(v4) << endl;
+
+	// 读取和删除表头
+	cout << "\n***************************************** 读取和删除表头 **********************************" << endl;
+	v1.Get(2, data);
+	cout << "v1[2] = " << data << ", get v1[4]: " << v1.Get(4, data) << endl;
+	v1.PopFront(data, v5);
+	cout << "pop front of v1 = " << data << ", v5 shares " << v5.SharesTailWith(v0) << " nodes with v0" << endl;
+	PrintVersion("v1", v1);
+	PrintVersion("v5", v5);
+
+	// 旧版本释放之后，仍被其他版本共享的结点保留
+	cout << "\n***************************************** 释放版本 **********************************" << endl;
+	v0.Clear();
+	v1 = v4;
+	PrintVersion("v0", v0);
+	PrintVersion("v1", v1);
+	PrintVersion("v2", v2);
+	PrintVersion("v5", v5);
+	cout << "erase v0[0]: " << v0.Erase(0, v0) << ", pop v0: " << v0.PopFront(data, v0) << endl;
+
+	// 很长的版本链一次释放，不会递归过深
+	cout << "\n***************************************** 释放长链表 **********************************" << endl;
+	PERSISTENT_LIST<int> long_list;
+	for (int i = 0; i < 1000000; ++i)
+	{
+		long_list.PushFront(i, long_list);
+	}
+	PERSISTENT_LIST<int> long_copy(long_list);
+	long_list.Clear();
+	cout << "copy length = " << long_copy.GetLength() << ", list length = " << long_list.GetLength() << endl;
+	long_copy.Clear();
+
+	// 读者持有快照，写者继续生成新版本
+	cout << "\n***************************************** 读者持有快照 **********************************" << endl;
+	PERSISTENT_LIST<int> writer;
+	for (int i = 1; i <= 1000; ++i)
+	{
+		writer.PushFront(i, writer);
+	}
+	PERSISTENT_LIST<int> snapshot(writer);
+	thread reader_a(ReadSnapshot, snapshot, 0);
+	thread reader_b(ReadSnapshot, snapshot, 1);
+	for (int i = 0; i < 2000; ++i)
+	{
+		int popped = 0;
+		writer.PopFront(popped, writer);
+		writer.Set(i % 100, -i, writer);
+		writer.PushFront(i, writer);
+	}
+	snapshot.Clear();
+	reader_a.join();
+	reader_b.join();
+	cout << "reader sums = " << reader_sums[0] << " " << reader_sums[1] << " (expected " << 1000LL * 1001 / 2 * 100 << "), writer length = " << writer.GetLength() << endl;
+
+	cout << "Hello world!" << endl;
+	return 0;
+}
+
+
+
+// 打印结点数据
+int PrintData(const string& data)
+{
+	cout << data << " ";
+	return 0;
+}
+
+
+
+// 打印一个版本
+void PrintVersion(const char* name, const PERSISTENT_LIST<string>& version)
+{
+	cout << name << " (length " << version.GetLength() << "): ";
+	version.Traverse(PrintData);
+	cout << endl;
+}
+
+
+
+// 读者0的累加函数
+int SumReader0(const int& data)
+{
+	reader_sums[0] += data;
+	return 0;
+}
+
+
+
+// 读者1的累加函数
+int SumReader1(const int& data)
+{
+	reader_sums[1] += data;
+	return 0;
+}
+
+
+
+// 读者线程：反复遍历自己持有的快照并求和
+void ReadSnapshot(PERSISTENT_LIST<int> snapshot, int reader)
+{
+	for (int round = 0; round < 100; ++round)
+	{
+		snapshot.Traverse((reader == 0) ? SumReader0 : SumReader1);
+	}
+}
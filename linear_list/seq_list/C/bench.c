@@ -0,0 +1,403 @@
+/***********************************************************************************************************************************************
+ * File name:	bench.c
+ * Author:	guoke
+ * Date:	2026.10.19
+ * Description:	C语言顺序线性表两种存放方式的性能对比程序：SeqList_Create()的槽中存放指针，数据元素由调用者逐个申请、在内存中分散；
+ *				SeqList_CreateSized()把数据元素按值存放在一块连续空间中。对比顺序查找SeqList_LocateElem()和在表头插入删除的耗时。
+ *				另外对比通用顺序线性表经函数指针比较的SeqList_LocateElem()与SEQ_LIST_DEFINE()生成的内联比较的IntList_LocateElem()。
+ *				以及排序之后用SeqList_BSearch()二分查找与顺序查找的对比，逐个SeqList_Delete()与一趟SeqList_RemoveIf()删除一半元素的对比，
+ *				SeqList_TraverseEx()与不同线程数的SeqList_ParallelTraverse()的对比（加速比取决于机器的核数），
+ *				调用者对每个元素加一次互斥锁与线程安全句柄的逐个操作、批量操作的对比。
+ *				用法：./bench [元素个数] [查找次数]
+ * History:	1. 2026.10.19 创建并完成初始版本
+ *			2. 2026.10.19 增加通用顺序线性表与类型专用顺序线性表的查找对比
+ *			3. 2026.10.19 增加排序与二分查找的对比
+ *			4. 2026.10.19 增加逐个删除与条件删除的对比
+ *			5. 2026.10.19 增加单线程遍历与多线程遍历的对比
+ *			6. 2026.10.19 增加逐个加锁与线程安全句柄批量操作的对比
+ **********************************************************************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include "seq_list.h"
+#include "seq_list_define.h"
+
+// 测试使用的数据元素
+typedef struct RECORD{
+	int key;
+	int value;
+	char padding[24];
+}RECORD;
+
+// 按key比较两个RECORD
+int RecordKeyCompare(SEQ_LIST_ELEM r1, SEQ_LIST_ELEM r2);
+
+// 比较两个int
+int IntCompare(SEQ_LIST_ELEM i1, SEQ_LIST_ELEM i2);
+
+// 按key排序RECORD的比较函数
+int RecordKeyOrder(SEQ_LIST_ELEM r1, SEQ_LIST_ELEM r2);
+
+// key为奇数的RECORD满足条件
+int RecordKeyOdd(SEQ_LIST_ELEM r, void* ctx);
+
+// 对RECORD的value做一些计算并原子地累加到*(long long*)ctx中，模拟较重的visit()
+int RecordHashVisit(SEQ_LIST_ELEM r, void* ctx);
+
+// 生成元素类型为int的顺序线性表IntList
+#define INT_EQ(a, b)	((a) == (b))
+SEQ_LIST_DEFINE(IntList, int, INT_EQ)
+
+#define SHARED_BATCH	256			// 线程安全句柄的批量操作每批的元素个数
+#define SHARED_LOOKUP_LENGTH	8		// 查找对比中顺序线性表的长度，表短时加锁的开销占比大
+
+// 获取当前时间，单位为秒
+double NowSeconds(void);
+
+int main(int argc, char* argv[])
+{
+	int elem_num = (argc > 1) ? atoi(argv[1]) : 200000;
+	int query_num = (argc > 2) ? atoi(argv[2]) : 200;
+	int i = 0;
+	int j = 0;
+	double start = 0.0;
+	double pointer_time = 0.0;
+	double sized_time = 0.0;
+	long long pointer_sum = 0;
+	long long sized_sum = 0;
+	RECORD key;
+	RECORD* tmp = NULL;
+
+	SEQ_LIST* pointer_list = SeqList_Create(elem_num);
+	SEQ_LIST* sized_list = SeqList_CreateSized(elem_num, sizeof(RECORD));
+	RECORD** records = (RECORD**)malloc(sizeof(RECORD*) * elem_num);
+	if (pointer_list == NULL || sized_list == NULL || records == NULL)
+	{
+		printf("func main() err: create failed\n");
+		return -1;
+	}
+
+	// 逐个申请数据元素，打乱顺序后放入指针模式的线性表，值模式的线性表拷贝同样顺序的副本
+	memset(&key, 0, sizeof(RECORD));
+	for (i = 0; i < elem_num; ++i)
+	{
+		records[i] = (RECORD*)calloc(1, sizeof(RECORD));
+		records[i]->key = i;
+		records[i]->value = i;
+	}
+	srand(1);
+	for (i = elem_num - 1; i > 0; --i)
+	{
+		j = rand() % (i + 1);
+		tmp = records[i];
+		records[i] = records[j];
+		records[j] = tmp;
+	}
+	for (i = 0; i < elem_num; ++i)
+	{
+		SeqList_Insert(pointer_list, i, (SEQ_LIST_ELEM)records[i]);
+		SeqList_Insert(sized_list, i, (SEQ_LIST_ELEM)records[i]);
+	}
+
+	// 顺序查找
+	start = NowSeconds();
+	for (i = 0; i < query_num; ++i)
+	{
+		key.key = (int)(((long long)i * 7919) % elem_num);
+		pointer_sum += SeqList_LocateElem(pointer_list, &key, RecordKeyCompare);
+	}
+	pointer_time = NowSeconds() - start;
+
+	start = NowSeconds();
+	for (i = 0; i < query_num; ++i)
+	{
+		key.key = (int)(((long long)i * 7919) % elem_num);
+		sized_sum += SeqList_LocateElem(sized_list, &key, RecordKeyCompare);
+	}
+	sized_time = NowSeconds() - start;
+	printf("LocateElem x %d:\tpointer %.4f s\tsized %.4f s\t(%s)\n", query_num, pointer_time, sized_time, (pointer_sum == sized_sum) ? "same result" : "DIFFERENT RESULT");
+
+	// 在表头删除再插入，两种模式都用memmove整体移动
+	start = NowSeconds();
+	for (i = 0; i < query_num; ++i)
+	{
+		tmp = (RECORD*)SeqList_Delete(pointer_list, 0);
+		SeqList_Insert(pointer_list, 0, (SEQ_LIST_ELEM)tmp);
+	}
+	pointer_time = NowSeconds() - start;
+
+	start = NowSeconds();
+	for (i = 0; i < query_num; ++i)
+	{
+		memcpy(&key, SeqList_Delete(sized_list, 0), sizeof(RECORD));
+		SeqList_Insert(sized_list, 0, (SEQ_LIST_ELEM)&key);
+	}
+	sized_time = NowSeconds() - start;
+	printf("Delete+Insert x %d:\tpointer %.4f s\tsized %.4f s\n", query_num, pointer_time, sized_time);
+
+	// 排序之后二分查找
+	{
+		double sort_time = 0.0;
+		double bsearch_time = 0.0;
+		long long bsearch_sum = 0;
+
+		start = NowSeconds();
+		SeqList_Sort(sized_list, RecordKeyOrder);
+		sort_time = NowSeconds() - start;
+
+		start = NowSeconds();
+		for (i = 0; i < query_num; ++i)
+		{
+			key.key = (int)(((long long)i * 7919) % elem_num);
+			bsearch_sum += ((RECORD*)SeqList_GetElem(sized_list, SeqList_BSearch(sized_list, &key, RecordKeyOrder)))->key;
+		}
+		bsearch_time = NowSeconds() - start;
+		printf("Sort %d:\t%.4f s\tBSearch x %d:\t%.6f s\t(checksum %lld)\n", elem_num, sort_time, query_num, bsearch_time, bsearch_sum);
+	}
+
+	// 删除一半元素：逐个SeqList_Delete()与一趟SeqList_RemoveIf()，逐个删除是O(n^2)的，只用elem_num / 8个元素
+	{
+		int sweep_num = elem_num / 8;
+		SEQ_LIST* delete_list = SeqList_CreateSized(sweep_num + 1, sizeof(RECORD));
+		SEQ_LIST* remove_list = SeqList_CreateSized(sweep_num + 1, sizeof(RECORD));
+		double delete_time = 0.0;
+		double remove_time = 0.0;
+
+		for (i = 0; i < sweep_num; ++i)
+		{
+			SeqList_Insert(delete_list, i, (SEQ_LIST_ELEM)records[i]);
+			SeqList_Insert(remove_list, i, (SEQ_LIST_ELEM)records[i]);
+		}
+
+		start = NowSeconds();
+		for (i = 0; i < SeqList_GetLength(delete_list); )
+		{
+			if (RecordKeyOdd(SeqList_GetElem(delete_list, i), NULL))
+			{
+				SeqList_Delete(delete_list, i);
+			}
+			else
+			{
+				++i;
+			}
+		}
+		delete_time = NowSeconds() - start;
+
+		start = NowSeconds();
+		SeqList_RemoveIf(remove_list, RecordKeyOdd, NULL);
+		remove_time = NowSeconds() - start;
+		printf("remove odd keys of %d:\tDelete loop %.4f s\tRemoveIf %.6f s\t(length %d / %d)\n", sweep_num, delete_time, remove_time, SeqList_GetLength(delete_list), SeqList_GetLength(remove_list));
+
+		SeqList_Destroy(delete_list);
+		SeqList_Destroy(remove_list);
+	}
+
+	// 单线程遍历与多线程遍历
+	{
+		long long traverse_sum = 0;
+		int thread_num = 0;
+
+		start = NowSeconds();
+		SeqList_TraverseEx(sized_list, RecordHashVisit, &traverse_sum);
+		printf("TraverseEx:\t\t%.4f s\t(checksum %lld)\n", NowSeconds() - start, traverse_sum);
+		for (thread_num = 2; thread_num <= 8; thread_num *= 2)
+		{
+			traverse_sum = 0;
+			start = NowSeconds();
+			SeqList_ParallelTraverse(sized_list, RecordHashVisit, &traverse_sum, thread_num);
+			printf("ParallelTraverse(%d):\t%.4f s\t(checksum %lld)\n", thread_num, NowSeconds() - start, traverse_sum);
+		}
+	}
+
+	// 通用顺序线性表与类型专用顺序线性表的查找
+	{
+		SEQ_LIST* generic_list = SeqList_CreateSized(elem_num, sizeof(int));
+		IntList* int_list = IntList_Create(elem_num);
+		int target = 0;
+		double generic_time = 0.0;
+		double define_time = 0.0;
+		long long generic_sum = 0;
+		long long define_sum = 0;
+
+		for (i = 0; i < elem_num; ++i)
+		{
+			SeqList_Insert(generic_list, i, (SEQ_LIST_ELEM)&records[i]->key);
+			IntList_Insert(int_list, i, records[i]->key);
+		}
+
+		start = NowSeconds();
+		for (i = 0; i < query_num; ++i)
+		{
+			target = (int)(((long long)i * 7919) % elem_num);
+			generic_sum += SeqList_LocateElem(generic_list, &target, IntCompare);
+		}
+		generic_time = NowSeconds() - start;
+
+		start = NowSeconds();
+		for (i = 0; i < query_num; ++i)
+		{
+			target = (int)(((long long)i * 7919) % elem_num);
+			define_sum += IntList_LocateElem(int_list, target);
+		}
+		define_time = NowSeconds() - start;
+		printf("int LocateElem x %d:\tgeneric %.4f s\tSEQ_LIST_DEFINE %.4f s\t(%s)\n", query_num, generic_time, define_time, (generic_sum == define_sum) ? "same result" : "DIFFERENT RESULT");
+
+		SeqList_Destroy(generic_list);
+		IntList_Destroy(int_list);
+	}
+
+	// 逐个加锁与线程安全句柄的批量操作：插入elem_num个int，在短表中查找elem_num次
+	{
+		pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+		SEQ_LIST* locked_list = SeqList_CreateSized(16, sizeof(int));
+		SEQ_LIST_SHARED* single_shared = SeqList_CreateShared(SeqList_CreateSized(16, sizeof(int)));
+		SEQ_LIST_SHARED* batch_shared = SeqList_CreateShared(SeqList_CreateSized(16, sizeof(int)));
+		int* values = (int*)malloc(sizeof(int) * elem_num);
+		SEQ_LIST_ELEM* keys = (SEQ_LIST_ELEM*)malloc(sizeof(SEQ_LIST_ELEM) * elem_num);
+		int* results = (int*)malloc(sizeof(int) * elem_num);
+		double locked_time = 0.0;
+		double single_time = 0.0;
+		double batch_time = 0.0;
+		long long locked_sum = 0;
+		long long single_sum = 0;
+		long long batch_sum = 0;
+		int count = 0;
+
+		for (i = 0; i < elem_num; ++i)
+		{
+			values[i] = records[i]->key;
+			keys[i] = &values[i];
+		}
+
+		start = NowSeconds();
+		for (i = 0; i < elem_num; ++i)
+		{
+			pthread_mutex_lock(&mutex);
+			SeqList_Insert(locked_list, SeqList_GetLength(locked_list), &values[i]);
+			pthread_mutex_unlock(&mutex);
+		}
+		locked_time = NowSeconds() - start;
+
+		start = NowSeconds();
+		for (i = 0; i < elem_num; ++i)
+		{
+			SeqList_SharedInsert(single_shared, -1, &values[i]);
+		}
+		single_time = NowSeconds() - start;
+
+		start = NowSeconds();
+		for (i = 0; i < elem_num; i += SHARED_BATCH)
+		{
+			count = (elem_num - i < SHARED_BATCH) ? elem_num - i : SHARED_BATCH;
+			SeqList_SharedInsertBatch(batch_shared, -1, &values[i], count);
+		}
+		batch_time = NowSeconds() - start;
+		printf("Insert x %d:\t\tmutex per op %.4f s\tShared per op %.4f s\tShared batch %.4f s\n", elem_num, locked_time, single_time, batch_time);
+
+		// 只保留前SHARED_LOOKUP_LENGTH个元素
+		SeqList_DeleteRange(locked_list, SHARED_LOOKUP_LENGTH, elem_num - SHARED_LOOKUP_LENGTH, NULL);
+		SeqList_DestroyShared(single_shared);
+		single_shared = SeqList_CreateShared(SeqList_CreateSized(SHARED_LOOKUP_LENGTH, sizeof(int)));
+		SeqList_SharedInsertBatch(single_shared, 0, values, SHARED_LOOKUP_LENGTH);
+
+		start = NowSeconds();
+		for (i = 0; i < elem_num; ++i)
+		{
+			pthread_mutex_lock(&mutex);
+			locked_sum += SeqList_LocateElem(locked_list, keys[i], IntCompare);
+			pthread_mutex_unlock(&mutex);
+		}
+		locked_time = NowSeconds() - start;
+
+		start = NowSeconds();
+		for (i = 0; i < elem_num; ++i)
+		{
+			single_sum += SeqList_SharedLocateElem(single_shared, keys[i], IntCompare);
+		}
+		single_time = NowSeconds() - start;
+
+		start = NowSeconds();
+		for (i = 0; i < elem_num; i += SHARED_BATCH)
+		{
+			count = (elem_num - i < SHARED_BATCH) ? elem_num - i : SHARED_BATCH;
+			SeqList_SharedLocateBatch(single_shared, &keys[i], count, IntCompare, &results[i]);
+		}
+		for (i = 0; i < elem_num; ++i)
+		{
+			batch_sum += results[i];
+		}
+		batch_time = NowSeconds() - start;
+		printf("LocateElem x %d (length %d):\tmutex per op %.4f s\tShared per op %.4f s\tShared batch %.4f s\t(%s)\n", elem_num, SHARED_LOOKUP_LENGTH, locked_time, single_time, batch_time, (single_sum == batch_sum) ? "same result" : "DIFFERENT RESULT");
+
+		SeqList_Destroy(locked_list);
+		SeqList_DestroyShared(single_shared);
+		SeqList_DestroyShared(batch_shared);
+		free(values);
+		free(keys);
+		free(results);
+	}
+
+	SeqList_Destroy(pointer_list);
+	SeqList_Destroy(sized_list);
+	for (i = 0; i < elem_num; ++i)
+	{
+		free(records[i]);
+	}
+	free(records);
+	return 0;
+}
+
+
+// 按key比较两个RECORD
+int RecordKeyCompare(SEQ_LIST_ELEM r1, SEQ_LIST_ELEM r2)
+{
+	return (((RECORD*)r1)->key == ((RECORD*)r2)->key) ? 1 : 0;
+}
+
+
+// 比较两个int
+int IntCompare(SEQ_LIST_ELEM i1, SEQ_LIST_ELEM i2)
+{
+	return (*(int*)i1 == *(int*)i2) ? 1 : 0;
+}
+
+
+// 按key排序RECORD的比较函数
+int RecordKeyOrder(SEQ_LIST_ELEM r1, SEQ_LIST_ELEM r2)
+{
+	return (((RECORD*)r1)->key > ((RECORD*)r2)->key) - (((RECORD*)r1)->key < ((RECORD*)r2)->key);
+}
+
+
+// key为奇数的RECORD满足条件
+int RecordKeyOdd(SEQ_LIST_ELEM r, void* ctx)
+{
+	(void)ctx;
+	return ((RECORD*)r)->key & 1;
+}
+
+
+// 对RECORD的value做一些计算并原子地累加到*(long long*)ctx中，模拟较重的visit()
+int RecordHashVisit(SEQ_LIST_ELEM r, void* ctx)
+{
+	unsigned int hash = (unsigned int)((RECORD*)r)->value;
+	int i = 0;
+
+	for (i = 0; i < 64; ++i)
+	{
+		hash = hash * 2654435761u + 12345u;
+	}
+	__atomic_add_fetch((long long*)ctx, hash & 0xff, __ATOMIC_RELAXED);
+	return 0;
+}
+
+
+// 获取当前时间，单位为秒
+double NowSeconds(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
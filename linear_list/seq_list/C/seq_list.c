@@ -4,72 +4,520 @@
  * Date:	2021.10.26
  * Description:	C语言线性表顺序实现的源文件，该文件包含了seq_list.h中所有API的定义。
  * History:	1. 2021.10.26 创建并完成初始版本
+ *			2. 2026.10.19 增加按值存放定长数据元素的SeqList_CreateSized()，数据元素统一存放在连续的槽中，插入删除用memmove整体移动
+ *			3. 2026.10.19 容量不足时按增长因子用realloc自动扩容，增加SeqList_SetGrowth()、SeqList_Reserve()和SeqList_ShrinkToFit()
+ *			4. 2026.10.19 增加内省排序SeqList_Sort()，有序表的二分查找SeqList_BSearch()、SeqList_LowerBound()和有序插入SeqList_InsertSorted()
+ *			5. 2026.10.19 增加一趟完成的条件删除SeqList_RemoveIf()，批量插入SeqList_InsertBatch()和区间删除SeqList_DeleteRange()
+ *			6. 2026.10.19 增加带调用者数据、可提前结束的遍历SeqList_TraverseEx()和多线程遍历SeqList_ParallelTraverse()
+ *			7. 2026.10.19 增加用读写锁保护的线程安全句柄SEQ_LIST_SHARED及其批量API
+ *			8. 2026.10.19 线程安全句柄的查找没有找到时改为返回-3，与compare()出错的-2区分
+ *			9. 2026.10.19 更正值模式下SeqList_Delete()和SeqList_GetElem()返回地址的有效期说明
+ *			10. 2026.10.19 修正SeqList_RemoveIf()对一段保留元素之后的待删除元素重复调用pred()
  ****************************************************************************************************************************/
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <limits.h>
+#include <pthread.h>
 #include "seq_list.h"
 
+#define SEQ_LIST_DEFAULT_GROWTH		2.0			// 默认的增长因子，容量不足时扩容为原来的2倍
+#define SEQ_LIST_INSERTION_SORT_MAX	16			// 内省排序中不超过该长度的区间改用插入排序
+#define SEQ_LIST_PARALLEL_MIN		1024		// 多线程遍历时每个线程至少分到的元素个数，元素太少时创建线程得不偿失
+
 
 // 顺序线性表的元数据节点
 typedef struct SEQ_LIST_METADATA{
 	int length;					// 顺序线性表元素个数
 	int	capacity;				// 顺序线性表容量
-	SEQ_LIST_ELEM* elems;		// 存储第一个数据元素的地址
+	int elem_size;				// 每个槽的字节数，指针模式为sizeof(SEQ_LIST_ELEM)，值模式为数据元素的大小
+	int by_value;				// 为1时数据元素按值存放在槽中，为0时槽中存放调用者传入的指针
+	char* elems;				// 连续存放capacity + 1个槽，最后一个槽在值模式下暂存被删除的数据元素
+	double growth;				// 增长因子，容量不足时扩容为capacity * growth，不大于1时不自动扩容
+	int max_capacity;			// 自动扩容的容量上限，为0时不限制
 }SEQ_LIST_METADATA;
 
 
+// 多线程遍历中一个线程负责的区间和共享的状态
+typedef struct SEQ_LIST_WORKER{
+	SEQ_LIST_METADATA* internal_seq_list;		// 顺序线性表元数据
+	int (*visit)(SEQ_LIST_ELEM, void*);			// 访问函数
+	void* ctx;									// 调用者数据
+	int begin;									// 负责的区间起点
+	int end;									// 负责的区间终点（不含）
+	int* stop_index;							// 所有线程共享，visit()返回非0的最小下标，初值为length
+}SEQ_LIST_WORKER;
+
+
+// 线程安全的句柄
+typedef struct SEQ_LIST_SHARED_METADATA{
+	pthread_rwlock_t lock;			// 读写锁，读操作加读锁，插入删除加写锁
+	SEQ_LIST* seq_list;				// 接管的顺序线性表
+}SEQ_LIST_SHARED_METADATA;
+
+
 
 /*
- * Function:		SeqList_Create()
- * Description:		构造一个空的容量为capacity的顺序线性表
+ * Function:		SeqList_CreateSlots()
+ * Description:		构造一个空的容量为capacity、每个槽elem_size字节的顺序线性表，SeqList_Create()和SeqList_CreateSized()的公共部分
  * Time complexity:	O(1)
  * Input:	
- *		capacity:	int类型，说明构造的顺序线性表的容量
+ *		capacity:	int类型，顺序线性表的容量
+ *		elem_size:	int类型，每个槽的字节数
+ *		by_value:	int类型，为1时数据元素按值存放
  * Output:	
  * Return:			SEQ_LIST*类型，创建成功则返回顺序线性表地址，否则返回NULL
  */
-SEQ_LIST* SeqList_Create(int capacity)
+static SEQ_LIST* SeqList_CreateSlots(int capacity, int elem_size, int by_value)
 {
 	SEQ_LIST_METADATA* internal_seq_list = NULL;
 
-	// 参数检查
-	if (capacity <= 0)
-	{
-		printf("func SeqList_Create() err: capacity <= 0\n");
-		return NULL;
-	}
-
 	// 申请元数据结点空间
 	internal_seq_list = (SEQ_LIST_METADATA*)malloc(sizeof(SEQ_LIST_METADATA));
 	if (internal_seq_list == NULL)
 	{
-		printf("func SeqList_Create() err: internal_seq_list == NULL\n");
+		printf("func SeqList_CreateSlots() err: internal_seq_list == NULL\n");
 		return NULL;
 	}
 	
 	// 给申请的空间赋值
 	memset(internal_seq_list, 0, sizeof(SEQ_LIST_METADATA));
 	internal_seq_list->capacity = capacity;
+	internal_seq_list->elem_size = elem_size;
+	internal_seq_list->by_value = by_value;
+	internal_seq_list->growth = SEQ_LIST_DEFAULT_GROWTH;
+	internal_seq_list->max_capacity = 0;
 
-	// 申请数据元素空间
-	internal_seq_list->elems = (SEQ_LIST_ELEM*)malloc(sizeof(SEQ_LIST_ELEM) * internal_seq_list->capacity);
+	// 申请数据元素空间，多出的一个槽用于暂存被删除的数据元素
+	internal_seq_list->elems = (char*)calloc((size_t)capacity + 1, (size_t)elem_size);
 	if (internal_seq_list->elems == NULL)
 	{
-		printf("func SeqList_Create() err: internal_seq_list->elems == NULL\n");
+		printf("func SeqList_CreateSlots() err: internal_seq_list->elems == NULL\n");
+		free(internal_seq_list);
 		return NULL;
 	}
 
-	// 数据元素空间赋初值
-	memset(internal_seq_list->elems, 0, sizeof(SEQ_LIST_ELEM) * internal_seq_list->capacity);
-
 	// 将内部实现的地址转换为外部地址类型并返回
 	return (SEQ_LIST*)internal_seq_list;
 }
 
 
 
+/*
+ * Function:		SeqList_Slot()
+ * Description:		返回下标为pos的槽的地址
+ * Time complexity:	O(1)
+ * Input:	
+ *		internal_seq_list:	SEQ_LIST_METADATA*类型，顺序线性表元数据
+ *		pos:				int类型，槽的下标，0 <= pos <= capacity
+ * Output:	
+ * Return:			char*类型，槽的地址
+ */
+static char* SeqList_Slot(SEQ_LIST_METADATA* internal_seq_list, int pos)
+{
+	return internal_seq_list->elems + (size_t)pos * (size_t)internal_seq_list->elem_size;
+}
+
+
+
+/*
+ * Function:		SeqList_SlotElem()
+ * Description:		返回下标为pos的槽对外的数据元素：值模式为槽的地址，指针模式为槽中存放的指针
+ * Time complexity:	O(1)
+ * Input:	
+ *		internal_seq_list:	SEQ_LIST_METADATA*类型，顺序线性表元数据
+ *		pos:				int类型，槽的下标，0 <= pos <= capacity
+ * Output:	
+ * Return:			SEQ_LIST_ELEM类型，数据元素
+ */
+static SEQ_LIST_ELEM SeqList_SlotElem(SEQ_LIST_METADATA* internal_seq_list, int pos)
+{
+	char* slot = SeqList_Slot(internal_seq_list, pos);
+	return internal_seq_list->by_value ? (SEQ_LIST_ELEM)slot : *(SEQ_LIST_ELEM*)slot;
+}
+
+
+
+/*
+ * Function:		SeqList_SlotMatch()
+ * Description:		判断下标为pos的数据元素是否就是elem：指针模式比较指针，值模式逐字节比较elem_size个字节
+ * Time complexity:	O(1)，值模式为O(elem_size)
+ * Input:	
+ *		internal_seq_list:	SEQ_LIST_METADATA*类型，顺序线性表元数据
+ *		pos:				int类型，数据元素的下标
+ *		elem:				SEQ_LIST_ELEM类型，参与比较的数据元素
+ * Output:	
+ * Return:			int类型，相同返回1，否则返回0
+ */
+static int SeqList_SlotMatch(SEQ_LIST_METADATA* internal_seq_list, int pos, SEQ_LIST_ELEM elem)
+{
+	char* slot = SeqList_Slot(internal_seq_list, pos);
+	if (internal_seq_list->by_value)
+	{
+		return (memcmp(slot, elem, (size_t)internal_seq_list->elem_size) == 0) ? 1 : 0;
+	}
+	return (*(SEQ_LIST_ELEM*)slot == elem) ? 1 : 0;
+}
+
+
+
+/*
+ * Function:		SeqList_Resize()
+ * Description:		用realloc把数据元素空间调整为new_capacity + 1个槽，已有的数据元素保持不变，新增的槽置零
+ * Time complexity:	O(n)，realloc可能需要搬移已有的数据元素
+ * Input:	
+ *		internal_seq_list:	SEQ_LIST_METADATA*类型，顺序线性表元数据
+ *		new_capacity:		int类型，新的容量，new_capacity >= length
+ * Output:	
+ * Return:			int类型，操作成功返回0，空间申请失败返回负数，原来的空间保持不变
+ */
+static int SeqList_Resize(SEQ_LIST_METADATA* internal_seq_list, int new_capacity)
+{
+	size_t elem_size = (size_t)internal_seq_list->elem_size;
+	char* new_elems = NULL;
+
+	new_elems = (char*)realloc(internal_seq_list->elems, ((size_t)new_capacity + 1) * elem_size);
+	if (new_elems == NULL)
+	{
+		printf("func SeqList_Resize() err: new_elems == NULL\n");
+		return -1;
+	}
+
+	// 新增的槽置零，缩容时只需把新的备用槽置零
+	if (new_capacity > internal_seq_list->capacity)
+	{
+		memset(new_elems + (size_t)(internal_seq_list->capacity + 1) * elem_size, 0, (size_t)(new_capacity - internal_seq_list->capacity) * elem_size);
+	}
+	memset(new_elems + (size_t)new_capacity * elem_size, 0, elem_size);
+
+	internal_seq_list->elems = new_elems;
+	internal_seq_list->capacity = new_capacity;
+	return 0;
+}
+
+
+
+/*
+ * Function:		SeqList_Grow()
+ * Description:		容量小于needed时按增长因子扩容，新容量至少为needed，且不超过容量上限
+ * Time complexity:	O(n)，按倍数扩容时均摊到每次插入为O(1)
+ * Input:	
+ *		internal_seq_list:	SEQ_LIST_METADATA*类型，顺序线性表元数据
+ *		needed:				int类型，需要的容量，needed > capacity
+ * Output:	
+ * Return:			int类型，扩容成功返回0，不允许扩容、超过容量上限或空间申请失败返回负数
+ */
+static int SeqList_Grow(SEQ_LIST_METADATA* internal_seq_list, int needed)
+{
+	double limit = (internal_seq_list->max_capacity > 0) ? internal_seq_list->max_capacity : INT_MAX - 1;
+	double wanted = internal_seq_list->capacity * internal_seq_list->growth;
+	int new_capacity = 0;
+
+	// 不自动扩容或超过容量上限
+	if (internal_seq_list->growth <= 1.0 || needed > limit)
+	{
+		return -1;
+	}
+
+	// 计算新容量
+	if (wanted > limit)
+	{
+		wanted = limit;
+	}
+	new_capacity = (int)wanted;
+	if (new_capacity < needed)
+	{
+		new_capacity = needed;
+	}
+
+	return SeqList_Resize(internal_seq_list, new_capacity);
+}
+
+
+
+/*
+ * Function:		SeqList_SwapSlots()
+ * Description:		交换下标为i和j的两个槽的内容，借用最后一个备用槽作为中转
+ * Time complexity:	O(1)，值模式为O(elem_size)
+ * Input:	
+ *		internal_seq_list:	SEQ_LIST_METADATA*类型，顺序线性表元数据
+ *		i:					int类型，槽的下标
+ *		j:					int类型，槽的下标
+ * Output:	
+ * Return:			
+ */
+static void SeqList_SwapSlots(SEQ_LIST_METADATA* internal_seq_list, int i, int j)
+{
+	size_t elem_size = (size_t)internal_seq_list->elem_size;
+	char* spare_slot = SeqList_Slot(internal_seq_list, internal_seq_list->capacity);
+
+	if (i != j)
+	{
+		memcpy(spare_slot, SeqList_Slot(internal_seq_list, i), elem_size);
+		memcpy(SeqList_Slot(internal_seq_list, i), SeqList_Slot(internal_seq_list, j), elem_size);
+		memcpy(SeqList_Slot(internal_seq_list, j), spare_slot, elem_size);
+	}
+}
+
+
+
+/*
+ * Function:		SeqList_InsertionSort()
+ * Description:		对下标在[low, high)中的数据元素做插入排序：待插入元素暂存在备用槽中，前面比它大的元素用一次memmove整体后移
+ * Time complexity:	O(k^2)，k = high - low
+ * Input:	
+ *		internal_seq_list:	SEQ_LIST_METADATA*类型，顺序线性表元数据
+ *		low:				int类型，区间起点
+ *		high:				int类型，区间终点（不含）
+ *		cmp:				int(*)(SEQ_LIST_ELEM, SEQ_LIST_ELEM)类型，比较函数
+ * Output:	
+ * Return:			
+ */
+static void SeqList_InsertionSort(SEQ_LIST_METADATA* internal_seq_list, int low, int high, int (*cmp)(SEQ_LIST_ELEM, SEQ_LIST_ELEM))
+{
+	size_t elem_size = (size_t)internal_seq_list->elem_size;
+	char* spare_slot = SeqList_Slot(internal_seq_list, internal_seq_list->capacity);
+	SEQ_LIST_ELEM spare_elem = NULL;
+	int i = 0;
+	int j = 0;
+
+	for (i = low + 1; i < high; ++i)
+	{
+		// 已经在正确位置
+		if (cmp(SeqList_SlotElem(internal_seq_list, i - 1), SeqList_SlotElem(internal_seq_list, i)) <= 0)
+		{
+			continue;
+		}
+
+		// 暂存第i个元素，找到插入位置后整体后移
+		memcpy(spare_slot, SeqList_Slot(internal_seq_list, i), elem_size);
+		spare_elem = SeqList_SlotElem(internal_seq_list, internal_seq_list->capacity);
+		for (j = i - 1; j > low && cmp(SeqList_SlotElem(internal_seq_list, j - 1), spare_elem) > 0; --j){}
+		memmove(SeqList_Slot(internal_seq_list, j + 1), SeqList_Slot(internal_seq_list, j), (size_t)(i - j) * elem_size);
+		memcpy(SeqList_Slot(internal_seq_list, j), spare_slot, elem_size);
+	}
+}
+
+
+
+/*
+ * Function:		SeqList_HeapSort()
+ * Description:		对下标在[low, high)中的数据元素做堆排序，内省排序递归过深时使用，保证最坏情况为O(k*log(k))
+ * Time complexity:	O(k*log(k))，k = high - low
+ * Input:	
+ *		internal_seq_list:	SEQ_LIST_METADATA*类型，顺序线性表元数据
+ *		low:				int类型，区间起点
+ *		high:				int类型，区间终点（不含）
+ *		cmp:				int(*)(SEQ_LIST_ELEM, SEQ_LIST_ELEM)类型，比较函数
+ * Output:	
+ * Return:			
+ */
+static void SeqList_HeapSort(SEQ_LIST_METADATA* internal_seq_list, int low, int high, int (*cmp)(SEQ_LIST_ELEM, SEQ_LIST_ELEM))
+{
+	int count = high - low;
+	int start = 0;
+	int end = 0;
+	int root = 0;
+	int child = 0;
+
+	// 建大顶堆，然后依次把堆顶换到末尾
+	for (start = count / 2 - 1, end = count; end > 1; )
+	{
+		if (start >= 0)
+		{
+			root = start--;
+		}
+		else
+		{
+			SeqList_SwapSlots(internal_seq_list, low, low + (--end));
+			root = 0;
+		}
+
+		// 下沉root
+		while ((child = 2 * root + 1) < end)
+		{
+			if (child + 1 < end && cmp(SeqList_SlotElem(internal_seq_list, low + child), SeqList_SlotElem(internal_seq_list, low + child + 1)) < 0)
+			{
+				child++;
+			}
+			if (cmp(SeqList_SlotElem(internal_seq_list, low + root), SeqList_SlotElem(internal_seq_list, low + child)) >= 0)
+			{
+				break;
+			}
+			SeqList_SwapSlots(internal_seq_list, low + root, low + child);
+			root = child;
+		}
+	}
+}
+
+
+
+/*
+ * Function:		SeqList_IntroSort()
+ * Description:		对下标在[low, high)中的数据元素做内省排序：三数取中的快速排序，递归深度超过depth时改用堆排序，短区间用插入排序
+ * Time complexity:	O(k*log(k))，k = high - low
+ * Input:	
+ *		internal_seq_list:	SEQ_LIST_METADATA*类型，顺序线性表元数据
+ *		low:				int类型，区间起点
+ *		high:				int类型，区间终点（不含）
+ *		depth:				int类型，剩余的递归深度
+ *		cmp:				int(*)(SEQ_LIST_ELEM, SEQ_LIST_ELEM)类型，比较函数
+ * Output:	
+ * Return:			
+ */
+static void SeqList_IntroSort(SEQ_LIST_METADATA* internal_seq_list, int low, int high, int depth, int (*cmp)(SEQ_LIST_ELEM, SEQ_LIST_ELEM))
+{
+	int middle = 0;
+	int i = 0;
+	int j = 0;
+
+	while (high - low > SEQ_LIST_INSERTION_SORT_MAX)
+	{
+		// 递归过深，快速排序退化，改用堆排序
+		if (depth-- == 0)
+		{
+			SeqList_HeapSort(internal_seq_list, low, high, cmp);
+			return;
+		}
+
+		// 三数取中，使low、middle、high - 1有序，再把中值换到low作为枢轴
+		middle = low + (high - low) / 2;
+		if (cmp(SeqList_SlotElem(internal_seq_list, middle), SeqList_SlotElem(internal_seq_list, low)) < 0)
+		{
+			SeqList_SwapSlots(internal_seq_list, middle, low);
+		}
+		if (cmp(SeqList_SlotElem(internal_seq_list, high - 1), SeqList_SlotElem(internal_seq_list, middle)) < 0)
+		{
+			SeqList_SwapSlots(internal_seq_list, high - 1, middle);
+			if (cmp(SeqList_SlotElem(internal_seq_list, middle), SeqList_SlotElem(internal_seq_list, low)) < 0)
+			{
+				SeqList_SwapSlots(internal_seq_list, middle, low);
+			}
+		}
+		SeqList_SwapSlots(internal_seq_list, low, middle);
+
+		// 划分，与枢轴相等的元素两边都停下交换，大量重复元素时也能均分
+		i = low;
+		j = high;
+		while (1)
+		{
+			do { ++i; } while (i < high && cmp(SeqList_SlotElem(internal_seq_list, i), SeqList_SlotElem(internal_seq_list, low)) < 0);
+			do { --j; } while (cmp(SeqList_SlotElem(internal_seq_list, j), SeqList_SlotElem(internal_seq_list, low)) > 0);
+			if (i >= j)
+			{
+				break;
+			}
+			SeqList_SwapSlots(internal_seq_list, i, j);
+		}
+		SeqList_SwapSlots(internal_seq_list, low, j);
+
+		// 递归处理较短的一边，较长的一边继续循环，栈深度为O(log(n))
+		if (j - low < high - j - 1)
+		{
+			SeqList_IntroSort(internal_seq_list, low, j, depth, cmp);
+			low = j + 1;
+		}
+		else
+		{
+			SeqList_IntroSort(internal_seq_list, j + 1, high, depth, cmp);
+			high = j;
+		}
+	}
+
+	SeqList_InsertionSort(internal_seq_list, low, high, cmp);
+}
+
+
+
+/*
+ * Function:		SeqList_Bound()
+ * Description:		在有序的顺序线性表中二分查找，upper为0时返回第一个不小于key的下标，为1时返回第一个大于key的下标
+ * Time complexity:	O(log(n))
+ * Input:	
+ *		internal_seq_list:	SEQ_LIST_METADATA*类型，顺序线性表元数据
+ *		key:				SEQ_LIST_ELEM类型，查找的数据元素
+ *		cmp:				int(*)(SEQ_LIST_ELEM, SEQ_LIST_ELEM)类型，比较函数
+ *		upper:				int类型，为1时跳过与key相等的元素
+ * Output:	
+ * Return:			int类型，查找到的下标，0 <= 下标 <= length
+ */
+static int SeqList_Bound(SEQ_LIST_METADATA* internal_seq_list, SEQ_LIST_ELEM key, int (*cmp)(SEQ_LIST_ELEM, SEQ_LIST_ELEM), int upper)
+{
+	int low = 0;
+	int high = internal_seq_list->length;
+	int middle = 0;
+	int order = 0;
+
+	while (low < high)
+	{
+		middle = low + (high - low) / 2;
+		order = cmp(SeqList_SlotElem(internal_seq_list, middle), key);
+		if (order < 0 || (upper && order == 0))
+		{
+			low = middle + 1;
+		}
+		else
+		{
+			high = middle;
+		}
+	}
+
+	return low;
+}
+
+
+
+/*
+ * Function:		SeqList_Create()
+ * Description:		构造一个空的容量为capacity的顺序线性表
+ * Time complexity:	O(1)
+ * Input:	
+ *		capacity:	int类型，说明构造的顺序线性表的容量
+ * Output:	
+ * Return:			SEQ_LIST*类型，创建成功则返回顺序线性表地址，否则返回NULL
+ */
+SEQ_LIST* SeqList_Create(int capacity)
+{
+	// 参数检查
+	if (capacity <= 0)
+	{
+		printf("func SeqList_Create() err: capacity <= 0\n");
+		return NULL;
+	}
+
+	// 槽中存放调用者的指针
+	return SeqList_CreateSlots(capacity, (int)sizeof(SEQ_LIST_ELEM), 0);
+}
+
+
+
+/*
+ * Function:		SeqList_CreateSized()
+ * Description:		构造一个空的容量为capacity的顺序线性表，数据元素按值存放在一块连续的空间中，每个元素elem_size字节。
+ *					插入时拷贝elem指向的elem_size个字节，调用者不必为每个元素单独申请空间，查找时顺序扫描连续内存，不再逐个解引用指针
+ * Time complexity:	O(1)
+ * Input:	
+ *		capacity:	int类型，说明构造的顺序线性表的容量
+ *		elem_size:	int类型，每个数据元素的字节数，一般为sizeof(元素类型)
+ * Output:	
+ * Return:			SEQ_LIST*类型，创建成功则返回顺序线性表地址，否则返回NULL
+ */
+SEQ_LIST* SeqList_CreateSized(int capacity, int elem_size)
+{
+	// 参数检查
+	if (capacity <= 0 || elem_size <= 0)
+	{
+		printf("func SeqList_CreateSized() err: capacity <= 0 || elem_size <= 0\n");
+		return NULL;
+	}
+
+	// 槽中按值存放数据元素
+	return SeqList_CreateSlots(capacity, elem_size, 1);
+}
+
+
+
 /*
  * Function:		SeqList_Destroy()
  * Description:		销毁顺序线性表空间
@@ -226,7 +674,7 @@ int SeqList_GetCapacity(SEQ_LIST* seq_list)
  *		seq_list:	SEQ_LIST*类型，顺序线性表地址
  *		pos:		int类型，需要获取的数据元素的下标
  * Output:	
- * Return:			SEQ_LIST_ELEM类型，操作成功返回数据元素，否则返回NULL
+ * Return:			SEQ_LIST_ELEM类型，操作成功返回数据元素（值模式下为数据元素在顺序线性表中的地址，只在下一次修改顺序线性表的调用之前有效），否则返回NULL
  */
 SEQ_LIST_ELEM SeqList_GetElem(SEQ_LIST* seq_list, int pos) 
 {
@@ -247,8 +695,8 @@ SEQ_LIST_ELEM SeqList_GetElem(SEQ_LIST* seq_list, int pos)
 		return NULL;
 	}
 
-	// 返回下标为pos的数据元素
-	return internal_seq_list->elems[pos];
+	// 返回下标为pos的数据元素，值模式下返回其在顺序线性表中的地址
+	return SeqList_SlotElem(internal_seq_list, pos);
 }
 
 
@@ -281,7 +729,7 @@ int SeqList_LocateElem(SEQ_LIST* seq_list, SEQ_LIST_ELEM elem, int (*compare)(SE
 	// 遍历所有数据元素，根据compare()函数的返回值确定返回的下标
 	for(i = 0; i < internal_seq_list->length; ++i)
 	{
-		func_status = compare(elem, internal_seq_list->elems[i]);	// 比较每个元素
+		func_status = compare(elem, SeqList_SlotElem(internal_seq_list, i));	// 比较每个元素
 		if (func_status == 1)		// 匹配第一个元素之后跳出循环
 		{
 			break;
@@ -301,7 +749,7 @@ int SeqList_LocateElem(SEQ_LIST* seq_list, SEQ_LIST_ELEM elem, int (*compare)(SE
 
 /*
  * Function:		SeqList_PriorElem()
- * Description:		如果current_elem是顺序线性表的元素，且不是第一个，则返回它的前驱元素
+ * Description:		如果current_elem是顺序线性表的元素，且不是第一个，则返回它的前驱元素。值模式下逐字节比较，数据元素中的填充字节也参与比较
  * Time complexity:	O(n)
  * Input:	
  *		seq_list:			SEQ_LIST*类型，顺序线性表地址
@@ -324,7 +772,7 @@ SEQ_LIST_ELEM SeqList_PriorELem(SEQ_LIST* seq_list, SEQ_LIST_ELEM current_elem)
 	}
 
 	// 遍历所有数据元素，找到第一个与current_elem匹配的元素
-	for(i = 0; i < internal_seq_list->length && internal_seq_list->elems[i] != current_elem; ++i){}
+	for(i = 0; i < internal_seq_list->length && !SeqList_SlotMatch(internal_seq_list, i, current_elem); ++i){}
 
 	// 判断找到的下标的合法性
 	if (i == 0 || i >= internal_seq_list->length)
@@ -334,14 +782,14 @@ SEQ_LIST_ELEM SeqList_PriorELem(SEQ_LIST* seq_list, SEQ_LIST_ELEM current_elem)
 	}
 	
 	// 返回current_elem元素的前驱元素
-	return internal_seq_list->elems[i - 1];
+	return SeqList_SlotElem(internal_seq_list, i - 1);
 }
 
 
 
 /*
  * Function:		SeqList_NextElem()
- * Description:		如果current_elem是顺序线性表的元素，且不是最后一个，则返回它的后继元素
+ * Description:		如果current_elem是顺序线性表的元素，且不是最后一个，则返回它的后继元素。值模式下逐字节比较，数据元素中的填充字节也参与比较
  * Time complexity:	O(n)
  * Input:	
  *		seq_list:			SEQ_LIST*类型，顺序线性表地址
@@ -364,7 +812,7 @@ SEQ_LIST_ELEM SeqList_NextElem(SEQ_LIST* seq_list, SEQ_LIST_ELEM current_elem)
 	}
 
 	// 遍历所有数据元素，找到第一个与current_elem匹配的元素
-	for(i = 0; i < internal_seq_list->length && internal_seq_list->elems[i] != current_elem; ++i){}
+	for(i = 0; i < internal_seq_list->length && !SeqList_SlotMatch(internal_seq_list, i, current_elem); ++i){}
 
 	// 判断找到的下标的合法性
 	if (i == internal_seq_list->length - 1 || i >= internal_seq_list->length)
@@ -374,19 +822,19 @@ SEQ_LIST_ELEM SeqList_NextElem(SEQ_LIST* seq_list, SEQ_LIST_ELEM current_elem)
 	}
 	
 	// 返回current_elem元素的后继元素
-	return internal_seq_list->elems[i + 1];
+	return SeqList_SlotElem(internal_seq_list, i + 1);
 }
 
 
 
 /*
  * Function:		SeqList_Insert()
- * Description:		在顺序线性表中第pos个位置之前插入新的数据元素elem，顺序线性表长度加1
- * Time complexity:	O(n)
+ * Description:		在顺序线性表中第pos个位置之前插入新的数据元素elem，顺序线性表长度加1，已满时按增长因子自动扩容
+ * Time complexity:	O(n)，扩容均摊到每次插入为O(1)
  * Input:	
  *		seq_list:	SEQ_LIST*类型，顺序线性表地址
  *		pos:		int类型，将数据元素插入下标为pos的位置
- *		elem:		SEQ_LIST_ELEM类型，插入顺序线性表的元素
+ *		elem:		SEQ_LIST_ELEM类型，插入顺序线性表的元素，值模式下拷贝其指向的elem_size个字节，不能指向本线性表中的数据元素
  * Output:	
  * Return:			int类型，插入成功则返回插入位置下标，插入失败则返回负数
  */
@@ -395,7 +843,8 @@ int SeqList_Insert(SEQ_LIST* seq_list, int pos, SEQ_LIST_ELEM elem)
 	// 将外部的地址转换为内部的地址
 	SEQ_LIST_METADATA* internal_seq_list = (SEQ_LIST_METADATA*)seq_list;
 
-	int i = 0;
+	char* slot = NULL;
+	size_t elem_size = 0;
 
 	// 参数检查
 	if (seq_list == NULL || elem == NULL)
@@ -404,13 +853,6 @@ int SeqList_Insert(SEQ_LIST* seq_list, int pos, SEQ_LIST_ELEM elem)
 		return -1;
 	}
 
-	// 线性表容量检查
-	if (internal_seq_list->length >= internal_seq_list->capacity)
-	{
-		printf("func SeqList_Insert() err: internal_seq_list->length >= internal_seq_list->capacity\n");
-		return -2;
-	}
-
 	// 插入位置合法性检查
 	if (pos < 0 || pos > internal_seq_list->length)
 	{
@@ -418,14 +860,27 @@ int SeqList_Insert(SEQ_LIST* seq_list, int pos, SEQ_LIST_ELEM elem)
 		return -3;
 	}
 
-	// 插入操作之前准备工作：将插入位置即其之后的元素往后移动一个位置
-	for(i = 0; i < internal_seq_list->length - pos; ++i)
+	// 线性表容量检查，已满时先尝试扩容
+	if (internal_seq_list->length >= internal_seq_list->capacity && SeqList_Grow(internal_seq_list, internal_seq_list->length + 1) != 0)
 	{
-		internal_seq_list->elems[internal_seq_list->length - i] = internal_seq_list->elems[internal_seq_list->length - i - 1];
+		printf("func SeqList_Insert() err: internal_seq_list->length >= internal_seq_list->capacity\n");
+		return -2;
 	}
 
-	// 插入操作
-	internal_seq_list->elems[pos] = elem;
+	// 插入操作之前准备工作：将插入位置及其之后的元素整体往后移动一个位置
+	slot = SeqList_Slot(internal_seq_list, pos);
+	elem_size = (size_t)internal_seq_list->elem_size;
+	memmove(slot + elem_size, slot, (size_t)(internal_seq_list->length - pos) * elem_size);
+
+	// 插入操作：值模式拷贝elem指向的数据元素，指针模式拷贝指针本身
+	if (internal_seq_list->by_value)
+	{
+		memcpy(slot, elem, elem_size);
+	}
+	else
+	{
+		memcpy(slot, &elem, elem_size);
+	}
 
 	// 线性表长度加1
 	internal_seq_list->length++;
@@ -443,14 +898,16 @@ int SeqList_Insert(SEQ_LIST* seq_list, int pos, SEQ_LIST_ELEM elem)
  *		seq_list:	SEQ_LIST*类型，顺序线性表地址
  *		pos:		int类型，将数据元素插入下标为pos的位置
  * Output:	
- * Return:			SEQ_LIST_ELEM类型，删除成功则返回删除的元素，插入失败则返回NULL
+ * Return:			SEQ_LIST_ELEM类型，删除成功则返回删除的元素（值模式下为其副本的地址，副本存放在顺序线性表的备用槽中，只在下一次修改顺序线性表的调用之前有效：插入、删除、排序、Reserve()、ShrinkToFit()等都会覆盖或移动它），删除失败则返回NULL
  */
 SEQ_LIST_ELEM SeqList_Delete(SEQ_LIST* seq_list, int pos)
 {
 	// 将外部的地址转换为内部的地址
 	SEQ_LIST_METADATA* internal_seq_list = (SEQ_LIST_METADATA*)seq_list;
 
-	int i = 0;
+	char* slot = NULL;
+	char* spare_slot = NULL;
+	size_t elem_size = 0;
 	SEQ_LIST_ELEM deleted_elem = NULL;
 
 	// 参数检查
@@ -474,15 +931,23 @@ SEQ_LIST_ELEM SeqList_Delete(SEQ_LIST* seq_list, int pos)
 		return NULL;
 	}
 
-	// 删除之前先缓存被删除元素
-	deleted_elem = internal_seq_list->elems[pos];
-
-	// 删除并将删除位置之后所有元素先前移动一位
-	for (i = 0; i < internal_seq_list->length - pos - 1; ++i)
+	// 删除之前先缓存被删除元素，值模式下拷贝到最后一个备用槽中
+	slot = SeqList_Slot(internal_seq_list, pos);
+	elem_size = (size_t)internal_seq_list->elem_size;
+	if (internal_seq_list->by_value)
+	{
+		spare_slot = SeqList_Slot(internal_seq_list, internal_seq_list->capacity);
+		memcpy(spare_slot, slot, elem_size);
+		deleted_elem = (SEQ_LIST_ELEM)spare_slot;
+	}
+	else
 	{
-		internal_seq_list->elems[pos + i] = internal_seq_list->elems[pos + i + 1];
+		deleted_elem = SeqList_SlotElem(internal_seq_list, pos);
 	}
-	internal_seq_list->elems[internal_seq_list->length - 1] = NULL;
+
+	// 删除并将删除位置之后所有元素整体向前移动一位
+	memmove(slot, slot + elem_size, (size_t)(internal_seq_list->length - pos - 1) * elem_size);
+	memset(SeqList_Slot(internal_seq_list, internal_seq_list->length - 1), 0, elem_size);
 
 	// 线性表长度减一
 	internal_seq_list->length--;
@@ -520,7 +985,7 @@ int SeqList_Traverse(SEQ_LIST* seq_list, int (*visit)(SEQ_LIST_ELEM))
 	// 遍历所有数据元素
 	for (i = 0; i < internal_seq_list->length; ++i)
 	{
-		func_status = visit(internal_seq_list->elems[i]);
+		func_status = visit(SeqList_SlotElem(internal_seq_list, i));
 		if (func_status != 0)
 		{
 			printf("func SeqList_Traverse() err: func_status != 0\n");
@@ -530,3 +995,1045 @@ int SeqList_Traverse(SEQ_LIST* seq_list, int (*visit)(SEQ_LIST_ELEM))
 
 	return 0;
 }
+
+
+
+/*
+ * Function:		SeqList_SetGrowth()
+ * Description:		设置自动扩容的增长因子和容量上限。插入时顺序线性表已满，则用realloc把容量扩大为capacity * factor（至少加1），
+ *					不超过max_capacity；factor不大于1时不自动扩容，已满时插入失败。新建的顺序线性表增长因子为2，不限容量
+ * Time complexity:	O(1)
+ * Input:	
+ *		seq_list:		SEQ_LIST*类型，顺序线性表地址
+ *		factor:			double类型，增长因子
+ *		max_capacity:	int类型，自动扩容的容量上限，为0时不限制，不影响SeqList_Reserve()
+ * Output:	
+ * Return:			int类型，操作成功则返回0，否则返回负数
+ */
+int SeqList_SetGrowth(SEQ_LIST* seq_list, double factor, int max_capacity)
+{
+	// 将外部的地址转换为内部的地址
+	SEQ_LIST_METADATA* internal_seq_list = (SEQ_LIST_METADATA*)seq_list;
+
+	// 参数检查
+	if (seq_list == NULL || max_capacity < 0)
+	{
+		printf("func SeqList_SetGrowth() err: seq_list == NULL || max_capacity < 0\n");
+		return -1;
+	}
+
+	internal_seq_list->growth = factor;
+	internal_seq_list->max_capacity = max_capacity;
+	return 0;
+}
+
+
+
+/*
+ * Function:		SeqList_Reserve()
+ * Description:		预留空间，使顺序线性表的容量至少为capacity，之后的插入在长度达到capacity之前不再申请空间
+ * Time complexity:	O(n)，realloc可能需要搬移已有的数据元素
+ * Input:	
+ *		seq_list:	SEQ_LIST*类型，顺序线性表地址
+ *		capacity:	int类型，需要的容量，不大于当前容量时什么也不做
+ * Output:	
+ * Return:			int类型，操作成功则返回0，否则返回负数
+ */
+int SeqList_Reserve(SEQ_LIST* seq_list, int capacity)
+{
+	// 将外部的地址转换为内部的地址
+	SEQ_LIST_METADATA* internal_seq_list = (SEQ_LIST_METADATA*)seq_list;
+
+	// 参数检查
+	if (seq_list == NULL || capacity <= 0 || capacity == INT_MAX)
+	{
+		printf("func SeqList_Reserve() err: seq_list == NULL || capacity <= 0 || capacity == INT_MAX\n");
+		return -1;
+	}
+
+	// 容量已经足够
+	if (capacity <= internal_seq_list->capacity)
+	{
+		return 0;
+	}
+
+	return (SeqList_Resize(internal_seq_list, capacity) == 0) ? 0 : -2;
+}
+
+
+
+/*
+ * Function:		SeqList_ShrinkToFit()
+ * Description:		把顺序线性表的容量缩小为当前长度（空表为1），释放多余的空间
+ * Time complexity:	O(n)，realloc可能需要搬移已有的数据元素
+ * Input:	
+ *		seq_list:	SEQ_LIST*类型，顺序线性表地址
+ * Output:	
+ * Return:			int类型，操作成功则返回0，否则返回负数
+ */
+int SeqList_ShrinkToFit(SEQ_LIST* seq_list)
+{
+	// 将外部的地址转换为内部的地址
+	SEQ_LIST_METADATA* internal_seq_list = (SEQ_LIST_METADATA*)seq_list;
+
+	int new_capacity = 0;
+
+	// 参数检查
+	if (seq_list == NULL)
+	{
+		printf("func SeqList_ShrinkToFit() err: seq_list == NULL\n");
+		return -1;
+	}
+
+	// 容量至少为1，与SeqList_Create()的要求一致
+	new_capacity = (internal_seq_list->length > 0) ? internal_seq_list->length : 1;
+	if (new_capacity == internal_seq_list->capacity)
+	{
+		return 0;
+	}
+
+	return (SeqList_Resize(internal_seq_list, new_capacity) == 0) ? 0 : -2;
+}
+
+
+
+/*
+ * Function:		SeqList_Sort()
+ * Description:		按cmp()把顺序线性表从小到大排序，内省排序：快速排序为主，递归过深时改用堆排序，短区间用插入排序。
+ *					指针模式下交换的是槽中的指针，值模式下直接交换连续存放的数据元素。排序不稳定
+ * Time complexity:	假设cmp()的时间复杂度为O(m)，则本函数时间复杂度为O(n*log(n)*m)
+ * Input:	
+ *		seq_list:	SEQ_LIST*类型，顺序线性表地址
+ *		cmp:		int(*)(SEQ_LIST_ELEM, SEQ_LIST_ELEM)类型，函数指针，第一个参数小于、等于、大于第二个参数时分别返回负数、0、正数
+ * Output:	
+ * Return:			int类型，操作成功则返回0，否则返回负数
+ */
+int SeqList_Sort(SEQ_LIST* seq_list, int (*cmp)(SEQ_LIST_ELEM, SEQ_LIST_ELEM))
+{
+	// 将外部的地址转换为内部的地址
+	SEQ_LIST_METADATA* internal_seq_list = (SEQ_LIST_METADATA*)seq_list;
+
+	int depth = 0;
+	int n = 0;
+
+	// 参数检查
+	if (seq_list == NULL || cmp == NULL)
+	{
+		printf("func SeqList_Sort() err: seq_list == NULL || cmp == NULL\n");
+		return -1;
+	}
+
+	// 快速排序的递归深度上限为2*log2(n)
+	for (n = internal_seq_list->length; n > 1; n >>= 1)
+	{
+		depth += 2;
+	}
+
+	SeqList_IntroSort(internal_seq_list, 0, internal_seq_list->length, depth, cmp);
+	return 0;
+}
+
+
+
+/*
+ * Function:		SeqList_LowerBound()
+ * Description:		在按cmp()有序的顺序线性表中二分查找第一个不小于key的数据元素的下标
+ * Time complexity:	假设cmp()的时间复杂度为O(m)，则本函数时间复杂度为O(log(n)*m)
+ * Input:	
+ *		seq_list:	SEQ_LIST*类型，顺序线性表地址
+ *		key:		SEQ_LIST_ELEM类型，查找的数据元素，作为cmp()的第二个参数，值模式下指向与数据元素同类型的值
+ *		cmp:		int(*)(SEQ_LIST_ELEM, SEQ_LIST_ELEM)类型，与排序时使用的比较函数相同
+ * Output:	
+ * Return:			int类型，第一个不小于key的下标，都小于key时返回length，操作失败返回负数
+ */
+int SeqList_LowerBound(SEQ_LIST* seq_list, SEQ_LIST_ELEM key, int (*cmp)(SEQ_LIST_ELEM, SEQ_LIST_ELEM))
+{
+	// 将外部的地址转换为内部的地址
+	SEQ_LIST_METADATA* internal_seq_list = (SEQ_LIST_METADATA*)seq_list;
+
+	// 参数检查
+	if (seq_list == NULL || key == NULL || cmp == NULL)
+	{
+		printf("func SeqList_LowerBound() err: seq_list == NULL || key == NULL || cmp == NULL\n");
+		return -1;
+	}
+
+	return SeqList_Bound(internal_seq_list, key, cmp, 0);
+}
+
+
+
+/*
+ * Function:		SeqList_BSearch()
+ * Description:		在按cmp()有序的顺序线性表中二分查找与key相等的数据元素，有多个时返回第一个
+ * Time complexity:	假设cmp()的时间复杂度为O(m)，则本函数时间复杂度为O(log(n)*m)
+ * Input:	
+ *		seq_list:	SEQ_LIST*类型，顺序线性表地址
+ *		key:		SEQ_LIST_ELEM类型，查找的数据元素，作为cmp()的第二个参数，值模式下指向与数据元素同类型的值
+ *		cmp:		int(*)(SEQ_LIST_ELEM, SEQ_LIST_ELEM)类型，与排序时使用的比较函数相同
+ * Output:	
+ * Return:			int类型，找到则返回其下标，找不到返回-2，操作失败返回-1
+ */
+int SeqList_BSearch(SEQ_LIST* seq_list, SEQ_LIST_ELEM key, int (*cmp)(SEQ_LIST_ELEM, SEQ_LIST_ELEM))
+{
+	// 将外部的地址转换为内部的地址
+	SEQ_LIST_METADATA* internal_seq_list = (SEQ_LIST_METADATA*)seq_list;
+
+	int pos = 0;
+
+	// 参数检查
+	if (seq_list == NULL || key == NULL || cmp == NULL)
+	{
+		printf("func SeqList_BSearch() err: seq_list == NULL || key == NULL || cmp == NULL\n");
+		return -1;
+	}
+
+	// 第一个不小于key的元素等于key则找到
+	pos = SeqList_Bound(internal_seq_list, key, cmp, 0);
+	if (pos < internal_seq_list->length && cmp(SeqList_SlotElem(internal_seq_list, pos), key) == 0)
+	{
+		return pos;
+	}
+
+	return -2;
+}
+
+
+
+/*
+ * Function:		SeqList_InsertSorted()
+ * Description:		在按cmp()有序的顺序线性表中插入elem并保持有序，二分查找插入位置，与elem相等的元素之后插入，插入保持稳定
+ * Time complexity:	O(n)，其中查找位置为O(log(n))次cmp()，其余为一次memmove
+ * Input:	
+ *		seq_list:	SEQ_LIST*类型，顺序线性表地址
+ *		elem:		SEQ_LIST_ELEM类型，插入的数据元素，与SeqList_Insert()相同
+ *		cmp:		int(*)(SEQ_LIST_ELEM, SEQ_LIST_ELEM)类型，与排序时使用的比较函数相同
+ * Output:	
+ * Return:			int类型，插入成功则返回插入位置下标，插入失败则返回负数
+ */
+int SeqList_InsertSorted(SEQ_LIST* seq_list, SEQ_LIST_ELEM elem, int (*cmp)(SEQ_LIST_ELEM, SEQ_LIST_ELEM))
+{
+	// 将外部的地址转换为内部的地址
+	SEQ_LIST_METADATA* internal_seq_list = (SEQ_LIST_METADATA*)seq_list;
+
+	// 参数检查
+	if (seq_list == NULL || elem == NULL || cmp == NULL)
+	{
+		printf("func SeqList_InsertSorted() err: seq_list == NULL || elem == NULL || cmp == NULL\n");
+		return -1;
+	}
+
+	// 插入到最后一个不大于elem的元素之后
+	return SeqList_Insert(seq_list, SeqList_Bound(internal_seq_list, elem, cmp, 1), elem);
+}
+
+
+
+/*
+ * Function:		SeqList_RemoveIf()
+ * Description:		删除所有满足pred()的数据元素，一趟扫描完成：保留的元素按原来的顺序整段前移，每个元素只调用一次pred()。
+ *					逐个调用SeqList_Delete()删除k个元素需要移动O(k*n)次，本函数总共只移动O(n)次
+ * Time complexity:	假设pred()的时间复杂度为O(m)，则本函数时间复杂度为O(n*m)
+ * Input:	
+ *		seq_list:	SEQ_LIST*类型，顺序线性表地址
+ *		pred:		int(*)(SEQ_LIST_ELEM, void*)类型，函数指针，第一个参数为数据元素，第二个参数为ctx，返回非0表示删除该元素
+ *		ctx:		void*类型，原样传给pred()的调用者数据，可以为NULL
+ * Output:	
+ * Return:			int类型，操作成功返回删除的元素个数，否则返回负数
+ */
+int SeqList_RemoveIf(SEQ_LIST* seq_list, int (*pred)(SEQ_LIST_ELEM, void*), void* ctx)
+{
+	// 将外部的地址转换为内部的地址
+	SEQ_LIST_METADATA* internal_seq_list = (SEQ_LIST_METADATA*)seq_list;
+
+	size_t elem_size = 0;
+	int read = 0;
+	int write = 0;
+	int run_start = 0;
+	int removed = 0;
+
+	// 参数检查
+	if (seq_list == NULL || pred == NULL)
+	{
+		printf("func SeqList_RemoveIf() err: seq_list == NULL || pred == NULL\n");
+		return -1;
+	}
+
+	// read扫描所有元素，保留的元素成段移动到write处
+	elem_size = (size_t)internal_seq_list->elem_size;
+	while (read < internal_seq_list->length)
+	{
+		if (pred(SeqList_SlotElem(internal_seq_list, read), ctx))
+		{
+			read++;
+			continue;
+		}
+
+		// 找到一段连续保留的元素，整段移动
+		run_start = read;
+		for (read++; read < internal_seq_list->length && !pred(SeqList_SlotElem(internal_seq_list, read), ctx); ++read){}
+		if (write != run_start)
+		{
+			memmove(SeqList_Slot(internal_seq_list, write), SeqList_Slot(internal_seq_list, run_start), (size_t)(read - run_start) * elem_size);
+		}
+		write += read - run_start;
+
+		// 这一段之后的元素已经判定为要删除，直接跳过，保证每个元素只调用一次pred()
+		read++;
+	}
+
+	// 空出的槽置零
+	removed = internal_seq_list->length - write;
+	memset(SeqList_Slot(internal_seq_list, write), 0, (size_t)removed * elem_size);
+	internal_seq_list->length = write;
+
+	return removed;
+}
+
+
+
+/*
+ * Function:		SeqList_InsertBatch()
+ * Description:		在顺序线性表中第pos个位置之前依次插入count个数据元素，后面的元素只整体移动一次，容量不足时一次扩容到位
+ * Time complexity:	O(n + count)
+ * Input:	
+ *		seq_list:	SEQ_LIST*类型，顺序线性表地址
+ *		pos:		int类型，插入位置，0 <= pos <= length
+ *		elems:		const void*类型，插入的数据元素：指针模式下为count个SEQ_LIST_ELEM组成的数组，不能含NULL；
+ *					值模式下为count个数据元素连续存放的数组，不能指向本线性表中的数据元素
+ *		count:		int类型，插入的元素个数
+ * Output:	
+ * Return:			int类型，插入成功则返回插入位置下标，插入失败则返回负数，此时顺序线性表不变
+ */
+int SeqList_InsertBatch(SEQ_LIST* seq_list, int pos, const void* elems, int count)
+{
+	// 将外部的地址转换为内部的地址
+	SEQ_LIST_METADATA* internal_seq_list = (SEQ_LIST_METADATA*)seq_list;
+
+	char* slot = NULL;
+	size_t elem_size = 0;
+	int i = 0;
+
+	// 参数检查
+	if (seq_list == NULL || elems == NULL || count < 0)
+	{
+		printf("func SeqList_InsertBatch() err: seq_list == NULL || elems == NULL || count < 0\n");
+		return -1;
+	}
+
+	// 插入位置合法性检查
+	if (pos < 0 || pos > internal_seq_list->length)
+	{
+		printf("func SeqList_InsertBatch() err: pos < 0 || pos > internal_seq_list->length\n");
+		return -3;
+	}
+
+	// 指针模式下不能插入NULL，与SeqList_Insert()一致
+	if (!internal_seq_list->by_value)
+	{
+		for (i = 0; i < count; ++i)
+		{
+			if (((const SEQ_LIST_ELEM*)elems)[i] == NULL)
+			{
+				printf("func SeqList_InsertBatch() err: elems[%d] == NULL\n", i);
+				return -1;
+			}
+		}
+	}
+
+	// 容量检查，不足时一次扩容到位
+	if (count > INT_MAX - 1 - internal_seq_list->length || (internal_seq_list->length + count > internal_seq_list->capacity && SeqList_Grow(internal_seq_list, internal_seq_list->length + count) != 0))
+	{
+		printf("func SeqList_InsertBatch() err: internal_seq_list->length + count > internal_seq_list->capacity\n");
+		return -2;
+	}
+
+	// 后面的元素整体后移count个位置，再把count个元素一次拷贝进来
+	slot = SeqList_Slot(internal_seq_list, pos);
+	elem_size = (size_t)internal_seq_list->elem_size;
+	memmove(slot + (size_t)count * elem_size, slot, (size_t)(internal_seq_list->length - pos) * elem_size);
+	memcpy(slot, elems, (size_t)count * elem_size);
+	internal_seq_list->length += count;
+
+	return pos;
+}
+
+
+
+/*
+ * Function:		SeqList_DeleteRange()
+ * Description:		删除顺序线性表中下标在[pos, pos + count)中的数据元素，后面的元素只整体前移一次
+ * Time complexity:	O(n)
+ * Input:	
+ *		seq_list:	SEQ_LIST*类型，顺序线性表地址
+ *		pos:		int类型，删除的第一个元素的下标
+ *		count:		int类型，删除的元素个数，pos + count <= length
+ * Output:	
+ *		out_elems:	void*类型，不为NULL时按InsertBatch()中elems的格式存放被删除的count个数据元素，由调用者提供空间
+ * Return:			int类型，操作成功则返回0，否则返回负数
+ */
+int SeqList_DeleteRange(SEQ_LIST* seq_list, int pos, int count, void* out_elems)
+{
+	// 将外部的地址转换为内部的地址
+	SEQ_LIST_METADATA* internal_seq_list = (SEQ_LIST_METADATA*)seq_list;
+
+	char* slot = NULL;
+	size_t elem_size = 0;
+
+	// 参数检查
+	if (seq_list == NULL)
+	{
+		printf("func SeqList_DeleteRange() err: seq_list == NULL\n");
+		return -1;
+	}
+
+	// 删除区间合法性检查
+	if (pos < 0 || count < 0 || count > internal_seq_list->length - pos)
+	{
+		printf("func SeqList_DeleteRange() err: pos < 0 || count < 0 || pos + count > internal_seq_list->length\n");
+		return -2;
+	}
+
+	// 需要时先拷贝出被删除的元素
+	slot = SeqList_Slot(internal_seq_list, pos);
+	elem_size = (size_t)internal_seq_list->elem_size;
+	if (out_elems != NULL)
+	{
+		memcpy(out_elems, slot, (size_t)count * elem_size);
+	}
+
+	// 后面的元素整体前移count个位置，空出的槽置零
+	memmove(slot, slot + (size_t)count * elem_size, (size_t)(internal_seq_list->length - pos - count) * elem_size);
+	internal_seq_list->length -= count;
+	memset(SeqList_Slot(internal_seq_list, internal_seq_list->length), 0, (size_t)count * elem_size);
+
+	return 0;
+}
+
+
+
+/*
+ * Function:		SeqList_TraverseEx()
+ * Description:		依次对顺序线性表的每个元素调用visit(elem, ctx)，visit()返回非0时停止遍历。
+ *					ctx原样传给visit()，调用者的状态不必放在全局变量中，同时进行的多个遍历互不影响；提前停止可以用来查找
+ * Time complexity:	如果visit()时间复杂度为m，则本函数时间复杂度为O(n*m)
+ * Input:	
+ *		seq_list:	SEQ_LIST*类型，顺序线性表地址
+ *		visit:		int(*)(SEQ_LIST_ELEM, void*)类型，函数指针，第一个参数为数据元素，第二个参数为ctx，返回0继续，返回非0停止
+ *		ctx:		void*类型，原样传给visit()的调用者数据，可以为NULL
+ * Output:	
+ * Return:			int类型，visit()返回非0的元素下标，全部访问完则返回length，操作失败返回负数
+ */
+int SeqList_TraverseEx(SEQ_LIST* seq_list, int (*visit)(SEQ_LIST_ELEM, void*), void* ctx)
+{
+	// 将外部的地址转换为内部的地址
+	SEQ_LIST_METADATA* internal_seq_list = (SEQ_LIST_METADATA*)seq_list;
+
+	int i = 0;
+
+	// 参数检查
+	if (seq_list == NULL || visit == NULL)
+	{
+		printf("func SeqList_TraverseEx() err: seq_list == NULL || visit == NULL\n");
+		return -1;
+	}
+
+	// 遍历数据元素，visit()返回非0时停在该元素
+	for (i = 0; i < internal_seq_list->length; ++i)
+	{
+		if (visit(SeqList_SlotElem(internal_seq_list, i), ctx) != 0)
+		{
+			break;
+		}
+	}
+
+	return i;
+}
+
+
+
+/*
+ * Function:		SeqList_TraverseRange()
+ * Description:		多线程遍历中每个线程执行的函数，访问[begin, end)中的元素，下标超过共享的stop_index时停止，
+ *					visit()返回非0时用CAS把stop_index降为当前下标
+ * Time complexity:	如果visit()时间复杂度为m，则本函数时间复杂度为O((end - begin)*m)
+ * Input:	
+ *		arg:		void*类型，SEQ_LIST_WORKER*
+ * Output:	
+ * Return:			void*类型，总是NULL
+ */
+static void* SeqList_TraverseRange(void* arg)
+{
+	SEQ_LIST_WORKER* worker = (SEQ_LIST_WORKER*)arg;
+	int stop = 0;
+	int i = 0;
+
+	for (i = worker->begin; i < worker->end; ++i)
+	{
+		// 更小的下标已经停止，之后的元素不必访问
+		if (i > __atomic_load_n(worker->stop_index, __ATOMIC_RELAXED))
+		{
+			break;
+		}
+
+		if (worker->visit(SeqList_SlotElem(worker->internal_seq_list, i), worker->ctx) != 0)
+		{
+			stop = __atomic_load_n(worker->stop_index, __ATOMIC_RELAXED);
+			while (i < stop && !__atomic_compare_exchange_n(worker->stop_index, &stop, i, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED)){}
+			break;
+		}
+	}
+
+	return NULL;
+}
+
+
+
+/*
+ * Function:		SeqList_ParallelTraverse()
+ * Description:		把下标区间平均分成thread_num段，用thread_num个线程（包括调用线程）同时调用visit(elem, ctx)。
+ *					某个visit()返回非0时，下标更大的元素不再访问，返回值与SeqList_TraverseEx()相同：返回值之前的元素都已访问，
+ *					之后的元素可能访问过也可能没有。visit()会在多个线程中同时执行，它对ctx的修改需要自己保证线程安全，
+ *					遍历期间不能修改顺序线性表。元素个数较少时线程数相应减少，元素少于SEQ_LIST_PARALLEL_MIN时在调用线程中遍历
+ * Time complexity:	如果visit()时间复杂度为m，则本函数时间复杂度为O(n*m/thread_num)
+ * Input:	
+ *		seq_list:	SEQ_LIST*类型，顺序线性表地址
+ *		visit:		int(*)(SEQ_LIST_ELEM, void*)类型，函数指针，第一个参数为数据元素，第二个参数为ctx，返回0继续，返回非0停止
+ *		ctx:		void*类型，原样传给visit()的调用者数据，可以为NULL
+ *		thread_num:	int类型，线程数，不大于1时与SeqList_TraverseEx()相同
+ * Output:	
+ * Return:			int类型，visit()返回非0的最小元素下标，全部访问完则返回length，操作失败返回负数
+ */
+int SeqList_ParallelTraverse(SEQ_LIST* seq_list, int (*visit)(SEQ_LIST_ELEM, void*), void* ctx, int thread_num)
+{
+	// 将外部的地址转换为内部的地址
+	SEQ_LIST_METADATA* internal_seq_list = (SEQ_LIST_METADATA*)seq_list;
+
+	SEQ_LIST_WORKER* workers = NULL;
+	pthread_t* threads = NULL;
+	int* started = NULL;
+	int stop_index = 0;
+	int length = 0;
+	int i = 0;
+
+	// 参数检查
+	if (seq_list == NULL || visit == NULL)
+	{
+		printf("func SeqList_ParallelTraverse() err: seq_list == NULL || visit == NULL\n");
+		return -1;
+	}
+
+	// 每个线程至少分到SEQ_LIST_PARALLEL_MIN个元素
+	length = internal_seq_list->length;
+	if (thread_num > length / SEQ_LIST_PARALLEL_MIN)
+	{
+		thread_num = length / SEQ_LIST_PARALLEL_MIN;
+	}
+	if (thread_num <= 1)
+	{
+		return SeqList_TraverseEx(seq_list, visit, ctx);
+	}
+
+	workers = (SEQ_LIST_WORKER*)malloc(sizeof(SEQ_LIST_WORKER) * (size_t)thread_num);
+	threads = (pthread_t*)malloc(sizeof(pthread_t) * (size_t)thread_num);
+	started = (int*)calloc((size_t)thread_num, sizeof(int));
+	if (workers == NULL || threads == NULL || started == NULL)
+	{
+		printf("func SeqList_ParallelTraverse() err: workers == NULL || threads == NULL || started == NULL\n");
+		free(workers);
+		free(threads);
+		free(started);
+		return -2;
+	}
+
+	// 平均划分下标区间，第0段由调用线程自己处理，线程创建失败的段也由调用线程处理
+	stop_index = length;
+	for (i = 0; i < thread_num; ++i)
+	{
+		workers[i].internal_seq_list = internal_seq_list;
+		workers[i].visit = visit;
+		workers[i].ctx = ctx;
+		workers[i].begin = (int)((long long)length * i / thread_num);
+		workers[i].end = (int)((long long)length * (i + 1) / thread_num);
+		workers[i].stop_index = &stop_index;
+		if (i > 0)
+		{
+			started[i] = (pthread_create(&threads[i], NULL, SeqList_TraverseRange, &workers[i]) == 0);
+		}
+	}
+	for (i = 0; i < thread_num; ++i)
+	{
+		if (!started[i])
+		{
+			SeqList_TraverseRange(&workers[i]);
+		}
+	}
+	for (i = 1; i < thread_num; ++i)
+	{
+		if (started[i])
+		{
+			pthread_join(threads[i], NULL);
+		}
+	}
+
+	free(workers);
+	free(threads);
+	free(started);
+
+	return stop_index;
+}
+
+
+
+/*
+ * Function:		SeqList_CreateShared()
+ * Description:		构造一个线程安全的句柄，初始化读写锁并接管seq_list
+ * Time complexity:	O(1)
+ * Input:	
+ *		seq_list:	SEQ_LIST*类型，接管的顺序线性表
+ * Output:	
+ * Return:			SEQ_LIST_SHARED*类型，创建成功则返回句柄地址，否则返回NULL
+ */
+SEQ_LIST_SHARED* SeqList_CreateShared(SEQ_LIST* seq_list)
+{
+	SEQ_LIST_SHARED_METADATA* internal_shared = NULL;
+
+	// 参数检查
+	if (seq_list == NULL)
+	{
+		printf("func SeqList_CreateShared() err: seq_list == NULL\n");
+		return NULL;
+	}
+
+	// 申请句柄空间并初始化读写锁
+	internal_shared = (SEQ_LIST_SHARED_METADATA*)malloc(sizeof(SEQ_LIST_SHARED_METADATA));
+	if (internal_shared == NULL)
+	{
+		printf("func SeqList_CreateShared() err: internal_shared == NULL\n");
+		return NULL;
+	}
+	if (pthread_rwlock_init(&internal_shared->lock, NULL) != 0)
+	{
+		printf("func SeqList_CreateShared() err: pthread_rwlock_init() != 0\n");
+		free(internal_shared);
+		return NULL;
+	}
+	internal_shared->seq_list = seq_list;
+
+	return (SEQ_LIST_SHARED*)internal_shared;
+}
+
+
+
+/*
+ * Function:		SeqList_DestroyShared()
+ * Description:		销毁读写锁、句柄和它接管的顺序线性表
+ * Time complexity:	O(1)
+ * Input:	
+ *		shared:		SEQ_LIST_SHARED*类型，句柄地址
+ * Output:	
+ * Return:			int类型，操作成功返回0，否则返回负数
+ */
+int SeqList_DestroyShared(SEQ_LIST_SHARED* shared)
+{
+	// 将外部的地址转换为内部的地址
+	SEQ_LIST_SHARED_METADATA* internal_shared = (SEQ_LIST_SHARED_METADATA*)shared;
+
+	// 参数检查
+	if (shared == NULL)
+	{
+		printf("func SeqList_DestroyShared() err: shared == NULL\n");
+		return -1;
+	}
+
+	SeqList_Destroy(internal_shared->seq_list);
+	pthread_rwlock_destroy(&internal_shared->lock);
+	free(internal_shared);
+
+	return 0;
+}
+
+
+
+/*
+ * Function:		SeqList_SharedGetLength()
+ * Description:		加读锁获取顺序线性表的长度
+ * Time complexity:	O(1)
+ * Input:	
+ *		shared:		SEQ_LIST_SHARED*类型，句柄地址
+ * Output:	
+ * Return:			int类型，顺序线性表长度，操作失败返回负数
+ */
+int SeqList_SharedGetLength(SEQ_LIST_SHARED* shared)
+{
+	// 将外部的地址转换为内部的地址
+	SEQ_LIST_SHARED_METADATA* internal_shared = (SEQ_LIST_SHARED_METADATA*)shared;
+
+	int result = 0;
+
+	// 参数检查
+	if (shared == NULL)
+	{
+		printf("func SeqList_SharedGetLength() err: shared == NULL\n");
+		return -1;
+	}
+
+	// 加读锁，其他读者可以同时进入
+	if (pthread_rwlock_rdlock(&internal_shared->lock) != 0)
+	{
+		printf("func SeqList_SharedGetLength() err: pthread_rwlock_rdlock() != 0\n");
+		return -1;
+	}
+	result = SeqList_GetLength(internal_shared->seq_list);
+	pthread_rwlock_unlock(&internal_shared->lock);
+
+	return result;
+}
+
+
+
+/*
+ * Function:		SeqList_SharedGetElem()
+ * Description:		加读锁把第pos个数据元素所在的槽拷贝到out_elem中，指针模式下槽中就是SEQ_LIST_ELEM
+ * Time complexity:	O(1)
+ * Input:	
+ *		shared:		SEQ_LIST_SHARED*类型，句柄地址
+ *		pos:		int类型，数据元素的下标
+ * Output:	
+ *		out_elem:	void*类型，存放数据元素
+ * Return:			int类型，操作成功返回0，否则返回负数
+ */
+int SeqList_SharedGetElem(SEQ_LIST_SHARED* shared, int pos, void* out_elem)
+{
+	// 将外部的地址转换为内部的地址
+	SEQ_LIST_SHARED_METADATA* internal_shared = (SEQ_LIST_SHARED_METADATA*)shared;
+
+	int result = 0;
+
+	// 参数检查
+	if (shared == NULL || out_elem == NULL)
+	{
+		printf("func SeqList_SharedGetElem() err: shared == NULL || out_elem == NULL\n");
+		return -1;
+	}
+
+	// 加读锁，其他读者可以同时进入
+	if (pthread_rwlock_rdlock(&internal_shared->lock) != 0)
+	{
+		printf("func SeqList_SharedGetElem() err: pthread_rwlock_rdlock() != 0\n");
+		return -1;
+	}
+	{
+		SEQ_LIST_METADATA* internal_seq_list = (SEQ_LIST_METADATA*)internal_shared->seq_list;
+		if (pos < 0 || pos >= internal_seq_list->length)
+		{
+			printf("func SeqList_SharedGetElem() err: pos < 0 || pos >= length\n");
+			result = -2;
+		}
+		else
+		{
+			memcpy(out_elem, SeqList_Slot(internal_seq_list, pos), (size_t)internal_seq_list->elem_size);
+		}
+	}
+	pthread_rwlock_unlock(&internal_shared->lock);
+
+	return result;
+}
+
+
+
+/*
+ * Function:		SeqList_SharedLocateElem()
+ * Description:		加读锁执行SeqList_LocateElem()，没有找到时返回-3，compare()出错时返回-2
+ * Time complexity:	如果compare()时间复杂度为m，则本函数时间复杂度为O(n*m)
+ * Input:	
+ *		shared:		SEQ_LIST_SHARED*类型，句柄地址
+ *		elem:		SEQ_LIST_ELEM类型，compare()函数中第一个参数
+ *		compare:	int(*)(SEQ_LIST_ELEM, SEQ_LIST_ELEM)类型，函数指针
+ * Output:	
+ * Return:			int类型，数据元素的下标，没有找到返回-3，compare()出错返回-2，参数错误返回-1
+ */
+int SeqList_SharedLocateElem(SEQ_LIST_SHARED* shared, SEQ_LIST_ELEM elem, int (*compare)(SEQ_LIST_ELEM, SEQ_LIST_ELEM))
+{
+	// 将外部的地址转换为内部的地址
+	SEQ_LIST_SHARED_METADATA* internal_shared = (SEQ_LIST_SHARED_METADATA*)shared;
+
+	int result = 0;
+
+	// 参数检查
+	if (shared == NULL)
+	{
+		printf("func SeqList_SharedLocateElem() err: shared == NULL\n");
+		return -1;
+	}
+
+	// 加读锁，其他读者可以同时进入
+	if (pthread_rwlock_rdlock(&internal_shared->lock) != 0)
+	{
+		printf("func SeqList_SharedLocateElem() err: pthread_rwlock_rdlock() != 0\n");
+		return -1;
+	}
+	result = SeqList_LocateElem(internal_shared->seq_list, elem, compare);
+	if (result == SeqList_GetLength(internal_shared->seq_list))
+	{
+		result = -3;
+	}
+	pthread_rwlock_unlock(&internal_shared->lock);
+
+	return result;
+}
+
+
+
+/*
+ * Function:		SeqList_SharedLocateBatch()
+ * Description:		只加一次读锁，对elems中的count个数据元素分别执行SeqList_LocateElem()，没有找到的结果为-3
+ * Time complexity:	如果compare()时间复杂度为m，则本函数时间复杂度为O(count*n*m)
+ * Input:	
+ *		shared:		SEQ_LIST_SHARED*类型，句柄地址
+ *		elems:		SEQ_LIST_ELEM[]类型，查找的count个数据元素
+ *		count:		int类型，查找的个数
+ *		compare:	int(*)(SEQ_LIST_ELEM, SEQ_LIST_ELEM)类型，函数指针
+ * Output:	
+ *		results:	int[]类型，results[i]为elems[i]的查找结果
+ * Return:			int类型，操作成功返回0，否则返回负数
+ */
+int SeqList_SharedLocateBatch(SEQ_LIST_SHARED* shared, SEQ_LIST_ELEM elems[], int count, int (*compare)(SEQ_LIST_ELEM, SEQ_LIST_ELEM), int results[])
+{
+	// 将外部的地址转换为内部的地址
+	SEQ_LIST_SHARED_METADATA* internal_shared = (SEQ_LIST_SHARED_METADATA*)shared;
+
+	int result = 0;
+
+	// 参数检查
+	if (shared == NULL || elems == NULL || results == NULL || count < 0)
+	{
+		printf("func SeqList_SharedLocateBatch() err: shared == NULL || elems == NULL || results == NULL || count < 0\n");
+		return -1;
+	}
+
+	// 加读锁，其他读者可以同时进入
+	if (pthread_rwlock_rdlock(&internal_shared->lock) != 0)
+	{
+		printf("func SeqList_SharedLocateBatch() err: pthread_rwlock_rdlock() != 0\n");
+		return -1;
+	}
+	{
+		int i = 0;
+		for (i = 0; i < count; ++i)
+		{
+			results[i] = SeqList_LocateElem(internal_shared->seq_list, elems[i], compare);
+			if (results[i] == SeqList_GetLength(internal_shared->seq_list))
+			{
+				results[i] = -3;
+			}
+		}
+	}
+	pthread_rwlock_unlock(&internal_shared->lock);
+
+	return result;
+}
+
+
+
+/*
+ * Function:		SeqList_SharedInsert()
+ * Description:		加写锁执行SeqList_Insert()，pos为负数时插入到表尾
+ * Time complexity:	O(n)
+ * Input:	
+ *		shared:		SEQ_LIST_SHARED*类型，句柄地址
+ *		pos:		int类型，插入位置，负数表示表尾
+ *		elem:		SEQ_LIST_ELEM类型，插入的数据元素
+ * Output:	
+ * Return:			int类型，插入成功则返回插入位置下标，插入失败则返回负数
+ */
+int SeqList_SharedInsert(SEQ_LIST_SHARED* shared, int pos, SEQ_LIST_ELEM elem)
+{
+	// 将外部的地址转换为内部的地址
+	SEQ_LIST_SHARED_METADATA* internal_shared = (SEQ_LIST_SHARED_METADATA*)shared;
+
+	int result = 0;
+
+	// 参数检查
+	if (shared == NULL)
+	{
+		printf("func SeqList_SharedInsert() err: shared == NULL\n");
+		return -1;
+	}
+
+	// 加写锁，独占顺序线性表
+	if (pthread_rwlock_wrlock(&internal_shared->lock) != 0)
+	{
+		printf("func SeqList_SharedInsert() err: pthread_rwlock_wrlock() != 0\n");
+		return -1;
+	}
+	if (pos < 0)
+	{
+		pos = SeqList_GetLength(internal_shared->seq_list);
+	}
+	result = SeqList_Insert(internal_shared->seq_list, pos, elem);
+	pthread_rwlock_unlock(&internal_shared->lock);
+
+	return result;
+}
+
+
+
+/*
+ * Function:		SeqList_SharedInsertBatch()
+ * Description:		只加一次写锁执行SeqList_InsertBatch()，pos为负数时插入到表尾
+ * Time complexity:	O(n + count)
+ * Input:	
+ *		shared:		SEQ_LIST_SHARED*类型，句柄地址
+ *		pos:		int类型，插入位置，负数表示表尾
+ *		elems:		const void*类型，插入的数据元素，格式与SeqList_InsertBatch()相同
+ *		count:		int类型，插入的元素个数
+ * Output:	
+ * Return:			int类型，插入成功则返回插入位置下标，插入失败则返回负数
+ */
+int SeqList_SharedInsertBatch(SEQ_LIST_SHARED* shared, int pos, const void* elems, int count)
+{
+	// 将外部的地址转换为内部的地址
+	SEQ_LIST_SHARED_METADATA* internal_shared = (SEQ_LIST_SHARED_METADATA*)shared;
+
+	int result = 0;
+
+	// 参数检查
+	if (shared == NULL)
+	{
+		printf("func SeqList_SharedInsertBatch() err: shared == NULL\n");
+		return -1;
+	}
+
+	// 加写锁，独占顺序线性表
+	if (pthread_rwlock_wrlock(&internal_shared->lock) != 0)
+	{
+		printf("func SeqList_SharedInsertBatch() err: pthread_rwlock_wrlock() != 0\n");
+		return -1;
+	}
+	if (pos < 0)
+	{
+		pos = SeqList_GetLength(internal_shared->seq_list);
+	}
+	result = SeqList_InsertBatch(internal_shared->seq_list, pos, elems, count);
+	pthread_rwlock_unlock(&internal_shared->lock);
+
+	return result;
+}
+
+
+
+/*
+ * Function:		SeqList_SharedDelete()
+ * Description:		加写锁删除第pos个数据元素，借助SeqList_DeleteRange()把它拷贝到out_elem中，不经过值模式下暂存被删除元素的槽
+ * Time complexity:	O(n)
+ * Input:	
+ *		shared:		SEQ_LIST_SHARED*类型，句柄地址
+ *		pos:		int类型，删除的数据元素的下标
+ * Output:	
+ *		out_elem:	void*类型，不为NULL时存放被删除的数据元素
+ * Return:			int类型，操作成功返回0，否则返回负数
+ */
+int SeqList_SharedDelete(SEQ_LIST_SHARED* shared, int pos, void* out_elem)
+{
+	// 将外部的地址转换为内部的地址
+	SEQ_LIST_SHARED_METADATA* internal_shared = (SEQ_LIST_SHARED_METADATA*)shared;
+
+	int result = 0;
+
+	// 参数检查
+	if (shared == NULL)
+	{
+		printf("func SeqList_SharedDelete() err: shared == NULL\n");
+		return -1;
+	}
+
+	// 加写锁，独占顺序线性表
+	if (pthread_rwlock_wrlock(&internal_shared->lock) != 0)
+	{
+		printf("func SeqList_SharedDelete() err: pthread_rwlock_wrlock() != 0\n");
+		return -1;
+	}
+	result = SeqList_DeleteRange(internal_shared->seq_list, pos, 1, out_elem);
+	pthread_rwlock_unlock(&internal_shared->lock);
+
+	return result;
+}
+
+
+
+/*
+ * Function:		SeqList_SharedRemoveIf()
+ * Description:		只加一次写锁执行SeqList_RemoveIf()
+ * Time complexity:	假设pred()的时间复杂度为O(m)，则本函数时间复杂度为O(n*m)
+ * Input:	
+ *		shared:		SEQ_LIST_SHARED*类型，句柄地址
+ *		pred:		int(*)(SEQ_LIST_ELEM, void*)类型，函数指针，返回非0表示删除该元素
+ *		ctx:		void*类型，原样传给pred()的调用者数据
+ * Output:	
+ * Return:			int类型，操作成功返回删除的元素个数，否则返回负数
+ */
+int SeqList_SharedRemoveIf(SEQ_LIST_SHARED* shared, int (*pred)(SEQ_LIST_ELEM, void*), void* ctx)
+{
+	// 将外部的地址转换为内部的地址
+	SEQ_LIST_SHARED_METADATA* internal_shared = (SEQ_LIST_SHARED_METADATA*)shared;
+
+	int result = 0;
+
+	// 参数检查
+	if (shared == NULL)
+	{
+		printf("func SeqList_SharedRemoveIf() err: shared == NULL\n");
+		return -1;
+	}
+
+	// 加写锁，独占顺序线性表
+	if (pthread_rwlock_wrlock(&internal_shared->lock) != 0)
+	{
+		printf("func SeqList_SharedRemoveIf() err: pthread_rwlock_wrlock() != 0\n");
+		return -1;
+	}
+	result = SeqList_RemoveIf(internal_shared->seq_list, pred, ctx);
+	pthread_rwlock_unlock(&internal_shared->lock);
+
+	return result;
+}
+
+
+
+/*
+ * Function:		SeqList_SharedTraverse()
+ * Description:		加读锁执行SeqList_TraverseEx()
+ * Time complexity:	如果visit()时间复杂度为m，则本函数时间复杂度为O(n*m)
+ * Input:	
+ *		shared:		SEQ_LIST_SHARED*类型，句柄地址
+ *		visit:		int(*)(SEQ_LIST_ELEM, void*)类型，函数指针，返回0继续，返回非0停止
+ *		ctx:		void*类型，原样传给visit()的调用者数据
+ * Output:	
+ * Return:			int类型，与SeqList_TraverseEx()相同
+ */
+int SeqList_SharedTraverse(SEQ_LIST_SHARED* shared, int (*visit)(SEQ_LIST_ELEM, void*), void* ctx)
+{
+	// 将外部的地址转换为内部的地址
+	SEQ_LIST_SHARED_METADATA* internal_shared = (SEQ_LIST_SHARED_METADATA*)shared;
+
+	int result = 0;
+
+	// 参数检查
+	if (shared == NULL)
+	{
+		printf("func SeqList_SharedTraverse() err: shared == NULL\n");
+		return -1;
+	}
+
+	// 加读锁，其他读者可以同时进入
+	if (pthread_rwlock_rdlock(&internal_shared->lock) != 0)
+	{
+		printf("func SeqList_SharedTraverse() err: pthread_rwlock_rdlock() != 0\n");
+		return -1;
+	}
+	result = SeqList_TraverseEx(internal_shared->seq_list, visit, ctx);
+	pthread_rwlock_unlock(&internal_shared->lock);
+
+	return result;
+}
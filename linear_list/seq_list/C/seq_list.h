@@ -4,6 +4,14 @@
  * Date:	2021.10.26
  * Description:	C语言线性表顺序实现的头文件，该文件包含了顺序线性表类型的声明、顺序线性表数据元素类型的声明和顺序线性表API的声明，其实现包含在文件seq_list.c文件中。
  * History:	1. 2021.10.26 创建并完成初始版本
+ *			2. 2026.10.19 增加按值存放定长数据元素的SeqList_CreateSized()
+ *			3. 2026.10.19 容量不足时自动扩容，增加SeqList_SetGrowth()、SeqList_Reserve()和SeqList_ShrinkToFit()
+ *			4. 2026.10.19 增加排序SeqList_Sort()，二分查找SeqList_BSearch()、SeqList_LowerBound()和有序插入SeqList_InsertSorted()
+ *			5. 2026.10.19 增加条件删除SeqList_RemoveIf()，批量插入SeqList_InsertBatch()和区间删除SeqList_DeleteRange()
+ *			6. 2026.10.19 增加带调用者数据、可提前结束的遍历SeqList_TraverseEx()和多线程遍历SeqList_ParallelTraverse()
+ *			7. 2026.10.19 增加用读写锁保护的线程安全句柄SEQ_LIST_SHARED及其批量API
+ *			8. 2026.10.19 线程安全句柄的查找没有找到时改为返回-3，与compare()出错的-2区分
+ *			9. 2026.10.19 更正值模式下SeqList_Delete()和SeqList_GetElem()返回地址的有效期说明
  **********************************************************************************************************************************************/
 
 #ifndef _SEQ_LIST_H_
@@ -15,6 +23,7 @@ extern "C"{
 
 typedef void SEQ_LIST;				// 对外的顺序线性表的类型
 typedef void* SEQ_LIST_ELEM;		// 对外的顺序线性表节点的类型
+typedef void SEQ_LIST_SHARED;		// 对外的线程安全的顺序线性表句柄类型
 
 
 /*
@@ -29,6 +38,20 @@ typedef void* SEQ_LIST_ELEM;		// 对外的顺序线性表节点的类型
 SEQ_LIST* SeqList_Create(int capacity);
 
 
+/*
+ * Function:		SeqList_CreateSized()
+ * Description:		构造一个空的容量为capacity的顺序线性表，数据元素按值存放在一块连续的空间中，每个元素elem_size字节。
+ *					插入时拷贝elem指向的elem_size个字节，调用者不必为每个元素单独申请空间，查找时顺序扫描连续内存，不再逐个解引用指针
+ * Time complexity:	O(1)
+ * Input:	
+ *		capacity:	int类型，说明构造的顺序线性表的容量
+ *		elem_size:	int类型，每个数据元素的字节数，一般为sizeof(元素类型)
+ * Output:	
+ * Return:			SEQ_LIST*类型，创建成功则返回顺序线性表地址，否则返回NULL
+ */
+SEQ_LIST* SeqList_CreateSized(int capacity, int elem_size);
+
+
 /*
  * Function:		SeqList_Destroy()
  * Description:		销毁顺序线性表空间
@@ -97,7 +120,7 @@ int SeqList_GetCapacity(SEQ_LIST* seq_list);
  *		seq_list:	SEQ_LIST*类型，顺序线性表地址
  *		pos:		int类型，需要获取的数据元素的下标
  * Output:	
- * Return:			SEQ_LIST_ELEM类型，操作成功返回数据元素，否则返回NULL
+ * Return:			SEQ_LIST_ELEM类型，操作成功返回数据元素（值模式下为数据元素在顺序线性表中的地址，只在下一次修改顺序线性表的调用之前有效），否则返回NULL
  */
 SEQ_LIST_ELEM SeqList_GetElem(SEQ_LIST* seq_list, int pos); 
 
@@ -118,7 +141,7 @@ int SeqList_LocateElem(SEQ_LIST* seq_list, SEQ_LIST_ELEM elem, int (*compare)(SE
 
 /*
  * Function:		SeqList_PriorElem()
- * Description:		如果current_elem是顺序线性表的元素，且不是第一个，则返回它的前驱元素
+ * Description:		如果current_elem是顺序线性表的元素，且不是第一个，则返回它的前驱元素。值模式下逐字节比较，数据元素中的填充字节也参与比较
  * Time complexity:	O(n)
  * Input:	
  *		seq_list:			SEQ_LIST*类型，顺序线性表地址
@@ -131,7 +154,7 @@ SEQ_LIST_ELEM SeqList_PriorELem(SEQ_LIST* seq_list, SEQ_LIST_ELEM current_elem);
 
 /*
  * Function:		SeqList_NextElem()
- * Description:		如果current_elem是顺序线性表的元素，且不是最后一个，则返回它的后继元素
+ * Description:		如果current_elem是顺序线性表的元素，且不是最后一个，则返回它的后继元素。值模式下逐字节比较，数据元素中的填充字节也参与比较
  * Time complexity:	O(n)
  * Input:	
  *		seq_list:			SEQ_LIST*类型，顺序线性表地址
@@ -144,12 +167,12 @@ SEQ_LIST_ELEM SeqList_NextElem(SEQ_LIST* seq_list, SEQ_LIST_ELEM current_elem);
 
 /*
  * Function:		SeqList_Insert()
- * Description:		在顺序线性表中第pos个位置之前插入新的数据元素elem，顺序线性表长度加1
- * Time complexity:	O(n)
+ * Description:		在顺序线性表中第pos个位置之前插入新的数据元素elem，顺序线性表长度加1，已满时按增长因子自动扩容
+ * Time complexity:	O(n)，扩容均摊到每次插入为O(1)
  * Input:	
  *		seq_list:	SEQ_LIST*类型，顺序线性表地址
  *		pos:		int类型，将数据元素插入下标为pos的位置
- *		elem:		SEQ_LIST_ELEM类型，插入顺序线性表的元素
+ *		elem:		SEQ_LIST_ELEM类型，插入顺序线性表的元素，值模式下拷贝其指向的elem_size个字节，不能指向本线性表中的数据元素
  * Output:	
  * Return:			int类型，插入成功则返回插入位置下标，插入失败则返回负数
  */
@@ -164,7 +187,7 @@ int SeqList_Insert(SEQ_LIST* seq_list, int pos, SEQ_LIST_ELEM elem);
  *		seq_list:	SEQ_LIST*类型，顺序线性表地址
  *		pos:		int类型，将数据元素插入下标为pos的位置
  * Output:	
- * Return:			SEQ_LIST_ELEM类型，删除成功则返回删除的元素，插入失败则返回NULL
+ * Return:			SEQ_LIST_ELEM类型，删除成功则返回删除的元素（值模式下为其副本的地址，副本存放在顺序线性表的备用槽中，只在下一次修改顺序线性表的调用之前有效：插入、删除、排序、Reserve()、ShrinkToFit()等都会覆盖或移动它），删除失败则返回NULL
  */
 SEQ_LIST_ELEM SeqList_Delete(SEQ_LIST* seq_list, int pos);
 
@@ -182,6 +205,335 @@ SEQ_LIST_ELEM SeqList_Delete(SEQ_LIST* seq_list, int pos);
 int SeqList_Traverse(SEQ_LIST* seq_list, int (*visit)(SEQ_LIST_ELEM));
 
 
+/*
+ * Function:		SeqList_TraverseEx()
+ * Description:		依次对顺序线性表的每个元素调用visit(elem, ctx)，visit()返回非0时停止遍历。
+ *					ctx原样传给visit()，调用者的状态不必放在全局变量中，同时进行的多个遍历互不影响；提前停止可以用来查找
+ * Time complexity:	如果visit()时间复杂度为m，则本函数时间复杂度为O(n*m)
+ * Input:	
+ *		seq_list:	SEQ_LIST*类型，顺序线性表地址
+ *		visit:		int(*)(SEQ_LIST_ELEM, void*)类型，函数指针，第一个参数为数据元素，第二个参数为ctx，返回0继续，返回非0停止
+ *		ctx:		void*类型，原样传给visit()的调用者数据，可以为NULL
+ * Output:	
+ * Return:			int类型，visit()返回非0的元素下标，全部访问完则返回length，操作失败返回负数
+ */
+int SeqList_TraverseEx(SEQ_LIST* seq_list, int (*visit)(SEQ_LIST_ELEM, void*), void* ctx);
+
+
+/*
+ * Function:		SeqList_ParallelTraverse()
+ * Description:		把下标区间平均分成thread_num段，用thread_num个线程（包括调用线程）同时调用visit(elem, ctx)。
+ *					某个visit()返回非0时，下标更大的元素不再访问，返回值与SeqList_TraverseEx()相同：返回值之前的元素都已访问，
+ *					之后的元素可能访问过也可能没有。visit()会在多个线程中同时执行，它对ctx的修改需要自己保证线程安全，
+ *					遍历期间不能修改顺序线性表。元素个数较少时线程数相应减少，元素少于SEQ_LIST_PARALLEL_MIN时在调用线程中遍历
+ * Time complexity:	如果visit()时间复杂度为m，则本函数时间复杂度为O(n*m/thread_num)
+ * Input:	
+ *		seq_list:	SEQ_LIST*类型，顺序线性表地址
+ *		visit:		int(*)(SEQ_LIST_ELEM, void*)类型，函数指针，第一个参数为数据元素，第二个参数为ctx，返回0继续，返回非0停止
+ *		ctx:		void*类型，原样传给visit()的调用者数据，可以为NULL
+ *		thread_num:	int类型，线程数，不大于1时与SeqList_TraverseEx()相同
+ * Output:	
+ * Return:			int类型，visit()返回非0的最小元素下标，全部访问完则返回length，操作失败返回负数
+ */
+int SeqList_ParallelTraverse(SEQ_LIST* seq_list, int (*visit)(SEQ_LIST_ELEM, void*), void* ctx, int thread_num);
+
+
+/*
+ * Function:		SeqList_SetGrowth()
+ * Description:		设置自动扩容的增长因子和容量上限。插入时顺序线性表已满，则用realloc把容量扩大为capacity * factor（至少加1），
+ *					不超过max_capacity；factor不大于1时不自动扩容，已满时插入失败。新建的顺序线性表增长因子为2，不限容量
+ * Time complexity:	O(1)
+ * Input:	
+ *		seq_list:		SEQ_LIST*类型，顺序线性表地址
+ *		factor:			double类型，增长因子
+ *		max_capacity:	int类型，自动扩容的容量上限，为0时不限制，不影响SeqList_Reserve()
+ * Output:	
+ * Return:			int类型，操作成功则返回0，否则返回负数
+ */
+int SeqList_SetGrowth(SEQ_LIST* seq_list, double factor, int max_capacity);
+
+
+/*
+ * Function:		SeqList_Reserve()
+ * Description:		预留空间，使顺序线性表的容量至少为capacity，之后的插入在长度达到capacity之前不再申请空间
+ * Time complexity:	O(n)，realloc可能需要搬移已有的数据元素
+ * Input:	
+ *		seq_list:	SEQ_LIST*类型，顺序线性表地址
+ *		capacity:	int类型，需要的容量，不大于当前容量时什么也不做
+ * Output:	
+ * Return:			int类型，操作成功则返回0，否则返回负数
+ */
+int SeqList_Reserve(SEQ_LIST* seq_list, int capacity);
+
+
+/*
+ * Function:		SeqList_ShrinkToFit()
+ * Description:		把顺序线性表的容量缩小为当前长度（空表为1），释放多余的空间
+ * Time complexity:	O(n)，realloc可能需要搬移已有的数据元素
+ * Input:	
+ *		seq_list:	SEQ_LIST*类型，顺序线性表地址
+ * Output:	
+ * Return:			int类型，操作成功则返回0，否则返回负数
+ */
+int SeqList_ShrinkToFit(SEQ_LIST* seq_list);
+
+
+/*
+ * Function:		SeqList_Sort()
+ * Description:		按cmp()把顺序线性表从小到大排序，内省排序：快速排序为主，递归过深时改用堆排序，短区间用插入排序。
+ *					指针模式下交换的是槽中的指针，值模式下直接交换连续存放的数据元素。排序不稳定
+ * Time complexity:	假设cmp()的时间复杂度为O(m)，则本函数时间复杂度为O(n*log(n)*m)
+ * Input:	
+ *		seq_list:	SEQ_LIST*类型，顺序线性表地址
+ *		cmp:		int(*)(SEQ_LIST_ELEM, SEQ_LIST_ELEM)类型，函数指针，第一个参数小于、等于、大于第二个参数时分别返回负数、0、正数
+ * Output:	
+ * Return:			int类型，操作成功则返回0，否则返回负数
+ */
+int SeqList_Sort(SEQ_LIST* seq_list, int (*cmp)(SEQ_LIST_ELEM, SEQ_LIST_ELEM));
+
+
+/*
+ * Function:		SeqList_LowerBound()
+ * Description:		在按cmp()有序的顺序线性表中二分查找第一个不小于key的数据元素的下标
+ * Time complexity:	假设cmp()的时间复杂度为O(m)，则本函数时间复杂度为O(log(n)*m)
+ * Input:	
+ *		seq_list:	SEQ_LIST*类型，顺序线性表地址
+ *		key:		SEQ_LIST_ELEM类型，查找的数据元素，作为cmp()的第二个参数，值模式下指向与数据元素同类型的值
+ *		cmp:		int(*)(SEQ_LIST_ELEM, SEQ_LIST_ELEM)类型，与排序时使用的比较函数相同
+ * Output:	
+ * Return:			int类型，第一个不小于key的下标，都小于key时返回length，操作失败返回负数
+ */
+int SeqList_LowerBound(SEQ_LIST* seq_list, SEQ_LIST_ELEM key, int (*cmp)(SEQ_LIST_ELEM, SEQ_LIST_ELEM));
+
+
+/*
+ * Function:		SeqList_BSearch()
+ * Description:		在按cmp()有序的顺序线性表中二分查找与key相等的数据元素，有多个时返回第一个
+ * Time complexity:	假设cmp()的时间复杂度为O(m)，则本函数时间复杂度为O(log(n)*m)
+ * Input:	
+ *		seq_list:	SEQ_LIST*类型，顺序线性表地址
+ *		key:		SEQ_LIST_ELEM类型，查找的数据元素，作为cmp()的第二个参数，值模式下指向与数据元素同类型的值
+ *		cmp:		int(*)(SEQ_LIST_ELEM, SEQ_LIST_ELEM)类型，与排序时使用的比较函数相同
+ * Output:	
+ * Return:			int类型，找到则返回其下标，找不到返回-2，操作失败返回-1
+ */
+int SeqList_BSearch(SEQ_LIST* seq_list, SEQ_LIST_ELEM key, int (*cmp)(SEQ_LIST_ELEM, SEQ_LIST_ELEM));
+
+
+/*
+ * Function:		SeqList_InsertSorted()
+ * Description:		在按cmp()有序的顺序线性表中插入elem并保持有序，二分查找插入位置，与elem相等的元素之后插入，插入保持稳定
+ * Time complexity:	O(n)，其中查找位置为O(log(n))次cmp()，其余为一次memmove
+ * Input:	
+ *		seq_list:	SEQ_LIST*类型，顺序线性表地址
+ *		elem:		SEQ_LIST_ELEM类型，插入的数据元素，与SeqList_Insert()相同
+ *		cmp:		int(*)(SEQ_LIST_ELEM, SEQ_LIST_ELEM)类型，与排序时使用的比较函数相同
+ * Output:	
+ * Return:			int类型，插入成功则返回插入位置下标，插入失败则返回负数
+ */
+int SeqList_InsertSorted(SEQ_LIST* seq_list, SEQ_LIST_ELEM elem, int (*cmp)(SEQ_LIST_ELEM, SEQ_LIST_ELEM));
+
+
+/*
+ * Function:		SeqList_RemoveIf()
+ * Description:		删除所有满足pred()的数据元素，一趟扫描完成：保留的元素按原来的顺序整段前移，每个元素只调用一次pred()。
+ *					逐个调用SeqList_Delete()删除k个元素需要移动O(k*n)次，本函数总共只移动O(n)次
+ * Time complexity:	假设pred()的时间复杂度为O(m)，则本函数时间复杂度为O(n*m)
+ * Input:	
+ *		seq_list:	SEQ_LIST*类型，顺序线性表地址
+ *		pred:		int(*)(SEQ_LIST_ELEM, void*)类型，函数指针，第一个参数为数据元素，第二个参数为ctx，返回非0表示删除该元素
+ *		ctx:		void*类型，原样传给pred()的调用者数据，可以为NULL
+ * Output:	
+ * Return:			int类型，操作成功返回删除的元素个数，否则返回负数
+ */
+int SeqList_RemoveIf(SEQ_LIST* seq_list, int (*pred)(SEQ_LIST_ELEM, void*), void* ctx);
+
+
+/*
+ * Function:		SeqList_InsertBatch()
+ * Description:		在顺序线性表中第pos个位置之前依次插入count个数据元素，后面的元素只整体移动一次，容量不足时一次扩容到位
+ * Time complexity:	O(n + count)
+ * Input:	
+ *		seq_list:	SEQ_LIST*类型，顺序线性表地址
+ *		pos:		int类型，插入位置，0 <= pos <= length
+ *		elems:		const void*类型，插入的数据元素：指针模式下为count个SEQ_LIST_ELEM组成的数组，不能含NULL；
+ *					值模式下为count个数据元素连续存放的数组，不能指向本线性表中的数据元素
+ *		count:		int类型，插入的元素个数
+ * Output:	
+ * Return:			int类型，插入成功则返回插入位置下标，插入失败则返回负数，此时顺序线性表不变
+ */
+int SeqList_InsertBatch(SEQ_LIST* seq_list, int pos, const void* elems, int count);
+
+
+/*
+ * Function:		SeqList_DeleteRange()
+ * Description:		删除顺序线性表中下标在[pos, pos + count)中的数据元素，后面的元素只整体前移一次
+ * Time complexity:	O(n)
+ * Input:	
+ *		seq_list:	SEQ_LIST*类型，顺序线性表地址
+ *		pos:		int类型，删除的第一个元素的下标
+ *		count:		int类型，删除的元素个数，pos + count <= length
+ * Output:	
+ *		out_elems:	void*类型，不为NULL时按InsertBatch()中elems的格式存放被删除的count个数据元素，由调用者提供空间
+ * Return:			int类型，操作成功则返回0，否则返回负数
+ */
+int SeqList_DeleteRange(SEQ_LIST* seq_list, int pos, int count, void* out_elems);
+
+
+/*
+ * Function:		SeqList_CreateShared()
+ * Description:		构造一个线程安全的句柄，接管已构造好的顺序线性表seq_list，之后只能通过句柄访问它，SeqList_DestroyShared()时一起销毁。
+ *					句柄内有一把读写锁：查找、读取、遍历加读锁，多个线程可以同时进行；插入、删除加写锁。
+ *					不需要线程安全的顺序线性表不受影响，没有加锁的开销。每个Shared函数只加锁一次，批量API一次加锁完成多个元素的操作
+ * Time complexity:	O(1)
+ * Input:	
+ *		seq_list:	SEQ_LIST*类型，由SeqList_Create()或SeqList_CreateSized()构造的顺序线性表，扩容策略等应在此之前设置好
+ * Output:	
+ * Return:			SEQ_LIST_SHARED*类型，创建成功则返回句柄地址，否则返回NULL，此时seq_list仍归调用者所有
+ */
+SEQ_LIST_SHARED* SeqList_CreateShared(SEQ_LIST* seq_list);
+
+
+/*
+ * Function:		SeqList_DestroyShared()
+ * Description:		销毁线程安全的句柄和它接管的顺序线性表，调用时不能有其他线程正在使用该句柄
+ * Time complexity:	O(1)
+ * Input:	
+ *		shared:		SEQ_LIST_SHARED*类型，句柄地址
+ * Output:	
+ * Return:			int类型，操作成功返回0，否则返回负数
+ */
+int SeqList_DestroyShared(SEQ_LIST_SHARED* shared);
+
+
+/*
+ * Function:		SeqList_SharedGetLength()
+ * Description:		加读锁获取顺序线性表的长度
+ * Time complexity:	O(1)
+ * Input:	
+ *		shared:		SEQ_LIST_SHARED*类型，句柄地址
+ * Output:	
+ * Return:			int类型，顺序线性表长度，操作失败返回负数
+ */
+int SeqList_SharedGetLength(SEQ_LIST_SHARED* shared);
+
+
+/*
+ * Function:		SeqList_SharedGetElem()
+ * Description:		加读锁把第pos个数据元素拷贝到out_elem中。不返回元素在表中的地址，因为解锁之后其他线程的插入删除会使地址失效
+ * Time complexity:	O(1)
+ * Input:	
+ *		shared:		SEQ_LIST_SHARED*类型，句柄地址
+ *		pos:		int类型，数据元素的下标
+ * Output:	
+ *		out_elem:	void*类型，指针模式下为SEQ_LIST_ELEM*，存放数据元素；值模式下存放数据元素的副本，由调用者提供空间
+ * Return:			int类型，操作成功返回0，否则返回负数
+ */
+int SeqList_SharedGetElem(SEQ_LIST_SHARED* shared, int pos, void* out_elem);
+
+
+/*
+ * Function:		SeqList_SharedLocateElem()
+ * Description:		加读锁执行SeqList_LocateElem()，compare()可能在多个线程中同时执行。
+ *					没有找到时返回-3而不是length，因为解锁之后长度可能已经改变，调用者无法用当时的长度判断；-2与SeqList_LocateElem()相同，表示compare()出错
+ * Time complexity:	如果compare()时间复杂度为m，则本函数时间复杂度为O(n*m)
+ * Input:	
+ *		shared:		SEQ_LIST_SHARED*类型，句柄地址
+ *		elem:		SEQ_LIST_ELEM类型，compare()函数中第一个参数
+ *		compare:	int(*)(SEQ_LIST_ELEM, SEQ_LIST_ELEM)类型，函数指针
+ * Output:	
+ * Return:			int类型，第1个满足关系compare()的数据元素的下标，没有找到返回-3，compare()出错返回-2，参数错误返回-1
+ */
+int SeqList_SharedLocateElem(SEQ_LIST_SHARED* shared, SEQ_LIST_ELEM elem, int (*compare)(SEQ_LIST_ELEM, SEQ_LIST_ELEM));
+
+
+/*
+ * Function:		SeqList_SharedLocateBatch()
+ * Description:		只加一次读锁，对elems中的count个数据元素分别执行SeqList_LocateElem()，所有结果来自同一时刻的顺序线性表
+ * Time complexity:	如果compare()时间复杂度为m，则本函数时间复杂度为O(count*n*m)
+ * Input:	
+ *		shared:		SEQ_LIST_SHARED*类型，句柄地址
+ *		elems:		SEQ_LIST_ELEM[]类型，查找的count个数据元素，作为compare()函数的第一个参数
+ *		count:		int类型，查找的个数
+ *		compare:	int(*)(SEQ_LIST_ELEM, SEQ_LIST_ELEM)类型，函数指针
+ * Output:	
+ *		results:	int[]类型，results[i]为elems[i]的查找结果，与SeqList_SharedLocateElem()的返回值相同
+ * Return:			int类型，操作成功返回0，否则返回负数
+ */
+int SeqList_SharedLocateBatch(SEQ_LIST_SHARED* shared, SEQ_LIST_ELEM elems[], int count, int (*compare)(SEQ_LIST_ELEM, SEQ_LIST_ELEM), int results[]);
+
+
+/*
+ * Function:		SeqList_SharedInsert()
+ * Description:		加写锁执行SeqList_Insert()。其他线程可能同时改变长度，pos为负数时插入到加锁时的表尾
+ * Time complexity:	O(n)
+ * Input:	
+ *		shared:		SEQ_LIST_SHARED*类型，句柄地址
+ *		pos:		int类型，插入位置，负数表示表尾
+ *		elem:		SEQ_LIST_ELEM类型，插入的数据元素，与SeqList_Insert()相同
+ * Output:	
+ * Return:			int类型，插入成功则返回插入位置下标，插入失败则返回负数
+ */
+int SeqList_SharedInsert(SEQ_LIST_SHARED* shared, int pos, SEQ_LIST_ELEM elem);
+
+
+/*
+ * Function:		SeqList_SharedInsertBatch()
+ * Description:		只加一次写锁执行SeqList_InsertBatch()，其他线程看到的是全部插入之前或之后的顺序线性表。pos为负数时插入到加锁时的表尾
+ * Time complexity:	O(n + count)
+ * Input:	
+ *		shared:		SEQ_LIST_SHARED*类型，句柄地址
+ *		pos:		int类型，插入位置，负数表示表尾
+ *		elems:		const void*类型，插入的数据元素，格式与SeqList_InsertBatch()相同
+ *		count:		int类型，插入的元素个数
+ * Output:	
+ * Return:			int类型，插入成功则返回插入位置下标，插入失败则返回负数
+ */
+int SeqList_SharedInsertBatch(SEQ_LIST_SHARED* shared, int pos, const void* elems, int count);
+
+
+/*
+ * Function:		SeqList_SharedDelete()
+ * Description:		加写锁删除第pos个数据元素，并把它拷贝到out_elem中
+ * Time complexity:	O(n)
+ * Input:	
+ *		shared:		SEQ_LIST_SHARED*类型，句柄地址
+ *		pos:		int类型，删除的数据元素的下标
+ * Output:	
+ *		out_elem:	void*类型，不为NULL时存放被删除的数据元素，格式与SeqList_SharedGetElem()相同
+ * Return:			int类型，操作成功返回0，否则返回负数
+ */
+int SeqList_SharedDelete(SEQ_LIST_SHARED* shared, int pos, void* out_elem);
+
+
+/*
+ * Function:		SeqList_SharedRemoveIf()
+ * Description:		只加一次写锁执行SeqList_RemoveIf()，一次删除所有满足pred()的数据元素
+ * Time complexity:	假设pred()的时间复杂度为O(m)，则本函数时间复杂度为O(n*m)
+ * Input:	
+ *		shared:		SEQ_LIST_SHARED*类型，句柄地址
+ *		pred:		int(*)(SEQ_LIST_ELEM, void*)类型，函数指针，返回非0表示删除该元素
+ *		ctx:		void*类型，原样传给pred()的调用者数据，可以为NULL
+ * Output:	
+ * Return:			int类型，操作成功返回删除的元素个数，否则返回负数
+ */
+int SeqList_SharedRemoveIf(SEQ_LIST_SHARED* shared, int (*pred)(SEQ_LIST_ELEM, void*), void* ctx);
+
+
+/*
+ * Function:		SeqList_SharedTraverse()
+ * Description:		加读锁执行SeqList_TraverseEx()，多个线程可以同时遍历，visit()不能修改顺序线性表，也不能调用同一句柄的加写锁的函数
+ * Time complexity:	如果visit()时间复杂度为m，则本函数时间复杂度为O(n*m)
+ * Input:	
+ *		shared:		SEQ_LIST_SHARED*类型，句柄地址
+ *		visit:		int(*)(SEQ_LIST_ELEM, void*)类型，函数指针，返回0继续，返回非0停止
+ *		ctx:		void*类型，原样传给visit()的调用者数据，可以为NULL
+ * Output:	
+ * Return:			int类型，与SeqList_TraverseEx()相同
+ */
+int SeqList_SharedTraverse(SEQ_LIST_SHARED* shared, int (*visit)(SEQ_LIST_ELEM, void*), void* ctx);
+
+
 #ifdef __cplusplus
 }
 #endif
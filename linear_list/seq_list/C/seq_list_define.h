@@ -0,0 +1,225 @@
+/***********************************************************************************************************************************************
+ * File name:	seq_list_define.h
+ * Author:	guoke
+ * Date:	2026.10.19
+ * Description:	C语言类型专用顺序线性表的生成宏，只有头文件。SEQ_LIST_DEFINE(name, type, eq)生成元素类型为type的顺序线性表类型name
+ *				和一组static inline函数name_Create()、name_Insert()等，数据元素按值存放在连续空间中。
+ *				seq_list.h中的通用顺序线性表通过函数指针调用compare()和visit()，编译器无法内联，每个元素都是一次间接调用；
+ *				这里的比较eq直接写在生成的循环中，可以是函数也可以是宏，编译器能够内联甚至向量化查找循环。
+ *				Traverse()的visit仍是函数指针参数，但Traverse()本身是static inline的，以常量函数名调用时优化后同样可以内联。
+ *				例如：
+ *					#define INT_EQ(a, b)	((a) == (b))
+ *					SEQ_LIST_DEFINE(IntList, int, INT_EQ)
+ *					IntList* list = IntList_Create(16);
+ *					IntList_Insert(list, 0, 42);
+ *					int pos = IntList_LocateElem(list, 42);
+ *				同一个name在一个翻译单元中只能生成一次，多个源文件各自生成同名的static函数互不影响。
+ * History:	1. 2026.10.19 创建并完成初始版本
+ **********************************************************************************************************************************************/
+
+#ifndef _SEQ_LIST_DEFINE_H_
+#define _SEQ_LIST_DEFINE_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+/*
+ * Macro:			SEQ_LIST_DEFINE()
+ * Description:		生成类型专用的顺序线性表，生成的类型和函数如下，语义与seq_list.h中同名的API相同：
+ *					name							顺序线性表类型，成员length、capacity、elems
+ *					name* name_Create(capacity)		构造一个空的容量为capacity的顺序线性表，失败返回NULL
+ *					int name_Destroy(list)			销毁顺序线性表
+ *					int name_Clear(list)			置为空表
+ *					int name_GetLength(list)		返回长度
+ *					int name_GetCapacity(list)		返回容量
+ *					type* name_GetElem(list, pos)	返回下标为pos的元素的地址，插入删除之后失效，失败返回NULL
+ *					int name_LocateElem(list, elem)	返回第一个满足eq(elem, 元素)的下标，没有则返回length
+ *					int name_Insert(list, pos, elem)	在下标pos之前插入elem的副本，已满时容量翻倍，成功返回pos
+ *					int name_Delete(list, pos, out_elem)	删除下标为pos的元素，out_elem不为NULL时存放被删除的元素
+ *					int name_Traverse(list, visit)	依次以每个元素的地址调用visit()，visit()返回非0时停止并返回负数
+ *					出错时返回负数并打印错误信息，与通用库一致
+ * Input:
+ *		name:		生成的类型名，同时是函数名的前缀
+ *		type:		数据元素类型，按值拷贝
+ *		eq:			int eq(type a, type b)形式的函数或宏，相等返回非0
+ */
+#define SEQ_LIST_DEFINE(name, type, eq)																				\
+																													\
+typedef struct name{																								\
+	int length;						/* 数据元素个数 */																\
+	int capacity;					/* 容量 */																		\
+	type* elems;					/* 连续存放capacity个数据元素 */												\
+}name;																												\
+																													\
+static inline name* name##_Create(int capacity)																		\
+{																													\
+	name* list = NULL;																								\
+	if (capacity <= 0)																								\
+	{																												\
+		printf("func " #name "_Create() err: capacity <= 0\n");														\
+		return NULL;																								\
+	}																												\
+	list = (name*)malloc(sizeof(name));																				\
+	if (list == NULL)																								\
+	{																												\
+		printf("func " #name "_Create() err: list == NULL\n");														\
+		return NULL;																								\
+	}																												\
+	list->length = 0;																								\
+	list->capacity = capacity;																						\
+	list->elems = (type*)malloc(sizeof(type) * (size_t)capacity);													\
+	if (list->elems == NULL)																						\
+	{																												\
+		printf("func " #name "_Create() err: list->elems == NULL\n");												\
+		free(list);																									\
+		return NULL;																								\
+	}																												\
+	return list;																									\
+}																													\
+																													\
+static inline int name##_Destroy(name* list)																		\
+{																													\
+	if (list == NULL)																								\
+	{																												\
+		printf("func " #name "_Destroy() err: list == NULL\n");														\
+		return -1;																									\
+	}																												\
+	free(list->elems);																								\
+	free(list);																										\
+	return 0;																										\
+}																													\
+																													\
+static inline int name##_Clear(name* list)																			\
+{																													\
+	if (list == NULL)																								\
+	{																												\
+		printf("func " #name "_Clear() err: list == NULL\n");														\
+		return -1;																									\
+	}																												\
+	list->length = 0;																								\
+	return 0;																										\
+}																													\
+																													\
+static inline int name##_GetLength(name* list)																		\
+{																													\
+	if (list == NULL)																								\
+	{																												\
+		printf("func " #name "_GetLength() err: list == NULL\n");													\
+		return -1;																									\
+	}																												\
+	return list->length;																							\
+}																													\
+																													\
+static inline int name##_GetCapacity(name* list)																	\
+{																													\
+	if (list == NULL)																								\
+	{																												\
+		printf("func " #name "_GetCapacity() err: list == NULL\n");													\
+		return -1;																									\
+	}																												\
+	return list->capacity;																							\
+}																													\
+																													\
+static inline type* name##_GetElem(name* list, int pos)																\
+{																													\
+	if (list == NULL || pos < 0 || pos >= list->length)																\
+	{																												\
+		printf("func " #name "_GetElem() err: list == NULL || pos < 0 || pos >= list->length\n");					\
+		return NULL;																								\
+	}																												\
+	return &list->elems[pos];																						\
+}																													\
+																													\
+static inline int name##_LocateElem(name* list, type elem)															\
+{																													\
+	int i = 0;																										\
+	if (list == NULL)																								\
+	{																												\
+		printf("func " #name "_LocateElem() err: list == NULL\n");													\
+		return -1;																									\
+	}																												\
+	/* eq()直接展开在循环中，没有间接调用 */																		\
+	for (i = 0; i < list->length; ++i)																				\
+	{																												\
+		if (eq(elem, list->elems[i]))																				\
+		{																											\
+			break;																									\
+		}																											\
+	}																												\
+	return i;																										\
+}																													\
+																													\
+static inline int name##_Insert(name* list, int pos, type elem)														\
+{																													\
+	type* new_elems = NULL;																							\
+	if (list == NULL)																								\
+	{																												\
+		printf("func " #name "_Insert() err: list == NULL\n");														\
+		return -1;																									\
+	}																												\
+	if (pos < 0 || pos > list->length)																				\
+	{																												\
+		printf("func " #name "_Insert() err: pos < 0 || pos > list->length\n");										\
+		return -3;																									\
+	}																												\
+	/* 已满时容量翻倍 */																							\
+	if (list->length >= list->capacity)																				\
+	{																												\
+		if (list->capacity > INT_MAX / 2)																			\
+		{																											\
+			printf("func " #name "_Insert() err: list->capacity > INT_MAX / 2\n");									\
+			return -2;																								\
+		}																											\
+		new_elems = (type*)realloc(list->elems, sizeof(type) * (size_t)list->capacity * 2);							\
+		if (new_elems == NULL)																						\
+		{																											\
+			printf("func " #name "_Insert() err: new_elems == NULL\n");												\
+			return -2;																								\
+		}																											\
+		list->elems = new_elems;																					\
+		list->capacity *= 2;																						\
+	}																												\
+	memmove(&list->elems[pos + 1], &list->elems[pos], sizeof(type) * (size_t)(list->length - pos));					\
+	list->elems[pos] = elem;																						\
+	list->length++;																									\
+	return pos;																										\
+}																													\
+																													\
+static inline int name##_Delete(name* list, int pos, type* out_elem)												\
+{																													\
+	if (list == NULL || pos < 0 || pos >= list->length)																\
+	{																												\
+		printf("func " #name "_Delete() err: list == NULL || pos < 0 || pos >= list->length\n");					\
+		return -1;																									\
+	}																												\
+	if (out_elem != NULL)																							\
+	{																												\
+		*out_elem = list->elems[pos];																				\
+	}																												\
+	memmove(&list->elems[pos], &list->elems[pos + 1], sizeof(type) * (size_t)(list->length - pos - 1));				\
+	list->length--;																									\
+	return 0;																										\
+}																													\
+																													\
+static inline int name##_Traverse(name* list, int (*visit)(type* elem))												\
+{																													\
+	int i = 0;																										\
+	if (list == NULL || visit == NULL)																				\
+	{																												\
+		printf("func " #name "_Traverse() err: list == NULL || visit == NULL\n");									\
+		return -1;																									\
+	}																												\
+	for (i = 0; i < list->length; ++i)																				\
+	{																												\
+		if (visit(&list->elems[i]) != 0)																			\
+		{																											\
+			printf("func " #name "_Traverse() err: visit() != 0\n");												\
+			return -2;																								\
+		}																											\
+	}																												\
+	return 0;																										\
+}
+
+#endif
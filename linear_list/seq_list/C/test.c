@@ -4,12 +4,22 @@
  * Date:	2021.10.26
  * Description:	C语言线性表顺序存储库seq_list.c、seq_list.h的API测试程序
  * History:	1. 2021.10.26 创建并完成初始版本
+ *			2. 2026.10.19 增加按值存放数据元素的顺序线性表的测试
+ *			3. 2026.10.19 增加自动扩容、预留空间和释放多余空间的测试
+ *			4. 2026.10.19 增加SEQ_LIST_DEFINE()生成的类型专用顺序线性表的测试
+ *			5. 2026.10.19 增加排序、二分查找和有序插入的测试
+ *			6. 2026.10.19 增加条件删除、批量插入和区间删除的测试
+ *			7. 2026.10.19 增加带调用者数据的遍历和多线程遍历的测试
+ *			8. 2026.10.19 增加线程安全句柄的测试
+ *			9. 2026.10.19 增加条件删除每个元素只调用一次pred()的测试
  *****************************************************************************************************************************************/
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <pthread.h>
 #include "seq_list.h"
+#include "seq_list_define.h"
 
 // TEACHER类型
 typedef struct TEACHER{
@@ -23,6 +33,56 @@ int TeacherPrint(SEQ_LIST_ELEM t);
 // TEACHER类型的比较函数
 int TeacherCompare(SEQ_LIST_ELEM t1,SEQ_LIST_ELEM t2);
 
+// TEACHER类型按年龄比较的函数
+int TeacherAgeCompare(SEQ_LIST_ELEM t1, SEQ_LIST_ELEM t2);
+
+// TEACHER类型按年龄排序的比较函数
+int TeacherAgeOrder(SEQ_LIST_ELEM t1, SEQ_LIST_ELEM t2);
+
+// 年龄不小于*(int*)ctx的TEACHER满足条件
+int TeacherAgeAtLeast(SEQ_LIST_ELEM t, void* ctx);
+
+// 把TEACHER的年龄累加到*(int*)ctx中
+int TeacherAgeSum(SEQ_LIST_ELEM t, void* ctx);
+
+// 把int原子地累加到*(long long*)ctx中
+int IntAtomicSum(SEQ_LIST_ELEM value, void* ctx);
+
+// 遇到等于*(int*)ctx的int时停止
+int IntEqualStop(SEQ_LIST_ELEM value, void* ctx);
+
+// 两个int相等时返回1
+int IntCompare(SEQ_LIST_ELEM a, SEQ_LIST_ELEM b);
+
+// int不小于*(int*)ctx时返回1
+int IntAtLeast(SEQ_LIST_ELEM value, void* ctx);
+
+// 在(int*)ctx中记录每个int被调用的次数，int为奇数时返回1
+int IntOddCounted(SEQ_LIST_ELEM value, void* ctx);
+
+#define SHARED_WRITER_NUM	2			// 线程安全句柄测试的写线程数
+#define SHARED_VALUE_NUM	1000		// 每个写线程插入的数据个数
+
+// 线程安全句柄测试的线程参数
+typedef struct SHARED_WORKER{
+	SEQ_LIST_SHARED* shared;
+	int first;					// 负责的数据为first, first + 1, ..., first + SHARED_VALUE_NUM - 1
+	int found;					// 读线程最后一次批量查找中找到的个数
+}SHARED_WORKER;
+
+// 写线程，每次在表尾批量插入100个数据
+void* SharedWriter(void* arg);
+
+// 读线程，反复批量查找写线程的数据
+void* SharedReader(void* arg);
+
+// 生成元素类型为int的顺序线性表IntList
+#define INT_EQ(a, b)	((a) == (b))
+SEQ_LIST_DEFINE(IntList, int, INT_EQ)
+
+// IntList的print函数
+int IntPrint(int* value);
+
 int main(void)
 {
 	SEQ_LIST* seq_list = NULL;
@@ -149,6 +209,288 @@ int main(void)
 		return func_status;
 	}
 
+	// 按值存放数据元素的顺序线性表
+	printf("\n按值存放数据元素：\n");
+	seq_list = SeqList_CreateSized(100, sizeof(TEACHER));
+	if (seq_list == NULL)
+	{
+		printf("func main() err: seq_list == NULL\n");
+		return -1;
+	}
+	SeqList_Insert(seq_list, 0, (SEQ_LIST_ELEM)&t1);
+	SeqList_Insert(seq_list, 1, (SEQ_LIST_ELEM)&t2);
+	SeqList_Insert(seq_list, 2, (SEQ_LIST_ELEM)&t3);
+	SeqList_Insert(seq_list, 0, (SEQ_LIST_ELEM)&t4);
+	SeqList_Insert(seq_list, 2, (SEQ_LIST_ELEM)&t5);
+	t1.age = 31;		// 线性表中保存的是副本，修改t1不影响线性表
+	printf("length = %d\tcapacity = %d\n", SeqList_GetLength(seq_list), SeqList_GetCapacity(seq_list));
+	SeqList_Traverse(seq_list, TeacherPrint);
+	printf("age 23 in position: %d\n", SeqList_LocateElem(seq_list, &t3, TeacherAgeCompare));
+	tmp = (TEACHER*)SeqList_PriorELem(seq_list, &t5);
+	printf("t5的前驱：");
+	TeacherPrint((SEQ_LIST_ELEM)tmp);
+	tmp = (TEACHER*)SeqList_NextElem(seq_list, &t5);
+	printf("t5的后继：");
+	TeacherPrint((SEQ_LIST_ELEM)tmp);
+	while(!SeqList_IsEmpty(seq_list))
+	{
+		tmp = (TEACHER*)SeqList_Delete(seq_list, SeqList_GetLength(seq_list) / 2);
+		printf("length = %d\t删除节点：\t", SeqList_GetLength(seq_list));
+		TeacherPrint((SEQ_LIST_ELEM)tmp);
+	}
+	func_status = SeqList_Destroy(seq_list);
+	if (func_status != 0)
+	{
+		printf("func main() err: func_status != 0\n");
+		return func_status;
+	}
+
+	// 自动扩容
+	printf("\n自动扩容：\n");
+	seq_list = SeqList_CreateSized(2, sizeof(TEACHER));
+	if (seq_list == NULL)
+	{
+		printf("func main() err: seq_list == NULL\n");
+		return -1;
+	}
+	for (i = 0; i < 5; ++i)
+	{
+		SeqList_Insert(seq_list, i, (SEQ_LIST_ELEM)&t2);
+		printf("length = %d\tcapacity = %d\n", SeqList_GetLength(seq_list), SeqList_GetCapacity(seq_list));
+	}
+	SeqList_SetGrowth(seq_list, 1.5, 10);
+	while (SeqList_Insert(seq_list, 0, (SEQ_LIST_ELEM)&t3) >= 0){}
+	printf("容量上限为10：length = %d\tcapacity = %d\n", SeqList_GetLength(seq_list), SeqList_GetCapacity(seq_list));
+	SeqList_Reserve(seq_list, 50);
+	printf("预留50：length = %d\tcapacity = %d\n", SeqList_GetLength(seq_list), SeqList_GetCapacity(seq_list));
+	for (i = 0; i < 7; ++i)
+	{
+		SeqList_Delete(seq_list, 0);
+	}
+	SeqList_ShrinkToFit(seq_list);
+	printf("释放多余空间：length = %d\tcapacity = %d\n", SeqList_GetLength(seq_list), SeqList_GetCapacity(seq_list));
+	SeqList_Traverse(seq_list, TeacherPrint);
+	SeqList_Clear(seq_list);
+	SeqList_ShrinkToFit(seq_list);
+	printf("清空后释放多余空间：length = %d\tcapacity = %d\n", SeqList_GetLength(seq_list), SeqList_GetCapacity(seq_list));
+	SeqList_SetGrowth(seq_list, 1.0, 0);
+	SeqList_Insert(seq_list, 0, (SEQ_LIST_ELEM)&t4);
+	printf("不自动扩容：insert returns %d\n", SeqList_Insert(seq_list, 0, (SEQ_LIST_ELEM)&t5));
+	func_status = SeqList_Destroy(seq_list);
+	if (func_status != 0)
+	{
+		printf("func main() err: func_status != 0\n");
+		return func_status;
+	}
+
+	// 类型专用的顺序线性表
+	printf("\n类型专用的顺序线性表：\n");
+	{
+		IntList* int_list = IntList_Create(2);
+		int deleted = 0;
+
+		for (i = 0; i < 6; ++i)
+		{
+			IntList_Insert(int_list, i, i * 10);
+		}
+		IntList_Insert(int_list, 0, 99);
+		printf("length = %d\tcapacity = %d\n", IntList_GetLength(int_list), IntList_GetCapacity(int_list));
+		IntList_Traverse(int_list, IntPrint);
+		printf("\n30 in position: %d\t77 in position: %d\n", IntList_LocateElem(int_list, 30), IntList_LocateElem(int_list, 77));
+		IntList_Delete(int_list, 0, &deleted);
+		printf("删除：%d\t第2个元素：%d\n", deleted, *IntList_GetElem(int_list, 2));
+		IntList_Traverse(int_list, IntPrint);
+		printf("\n");
+		IntList_Destroy(int_list);
+	}
+
+	// 排序、二分查找和有序插入
+	printf("\n排序、二分查找和有序插入：\n");
+	seq_list = SeqList_Create(8);
+	if (seq_list == NULL)
+	{
+		printf("func main() err: seq_list == NULL\n");
+		return -1;
+	}
+	SeqList_Insert(seq_list, 0, (SEQ_LIST_ELEM)&t3);
+	SeqList_Insert(seq_list, 1, (SEQ_LIST_ELEM)&t5);
+	SeqList_Insert(seq_list, 2, (SEQ_LIST_ELEM)&t2);
+	SeqList_Insert(seq_list, 3, (SEQ_LIST_ELEM)&t4);
+	SeqList_Sort(seq_list, TeacherAgeOrder);
+	SeqList_Traverse(seq_list, TeacherPrint);
+	printf("BSearch(t4) = %d\tBSearch(t3) = %d\tLowerBound(t1) = %d\n", SeqList_BSearch(seq_list, &t4, TeacherAgeOrder), SeqList_BSearch(seq_list, &t3, TeacherAgeOrder), SeqList_LowerBound(seq_list, &t1, TeacherAgeOrder));
+	printf("InsertSorted(t1) = %d\n", SeqList_InsertSorted(seq_list, &t1, TeacherAgeOrder));
+	SeqList_Traverse(seq_list, TeacherPrint);
+	SeqList_Destroy(seq_list);
+
+	seq_list = SeqList_CreateSized(4, sizeof(TEACHER));
+	for (i = 0; i < 20; ++i)
+	{
+		TEACHER t = t1;
+		t.age = (i * 7) % 10;
+		SeqList_InsertSorted(seq_list, &t, TeacherAgeOrder);
+	}
+	for (i = 0; i < SeqList_GetLength(seq_list); ++i)
+	{
+		printf("%d ", ((TEACHER*)SeqList_GetElem(seq_list, i))->age);
+	}
+	t2.age = 5;
+	printf("\nLowerBound(5) = %d\t", SeqList_LowerBound(seq_list, &t2, TeacherAgeOrder));
+	t2.age = 12;
+	printf("BSearch(12) = %d\n", SeqList_BSearch(seq_list, &t2, TeacherAgeOrder));
+	t2.age = 22;
+	SeqList_Destroy(seq_list);
+
+	// 条件删除、批量插入和区间删除
+	printf("\n条件删除、批量插入和区间删除：\n");
+	seq_list = SeqList_Create(2);
+	if (seq_list == NULL)
+	{
+		printf("func main() err: seq_list == NULL\n");
+		return -1;
+	}
+	{
+		TEACHER* batch[5] = {&t1, &t2, &t3, &t4, &t5};
+		TEACHER* removed[2] = {NULL, NULL};
+		TEACHER values[3];
+		int min_age = 25;
+
+		printf("InsertBatch = %d\t", SeqList_InsertBatch(seq_list, 0, batch, 5));
+		printf("InsertBatch = %d\t", SeqList_InsertBatch(seq_list, 2, batch + 3, 2));
+		printf("length = %d\tcapacity = %d\n", SeqList_GetLength(seq_list), SeqList_GetCapacity(seq_list));
+		SeqList_Traverse(seq_list, TeacherPrint);
+		printf("RemoveIf(age >= 25) = %d\n", SeqList_RemoveIf(seq_list, TeacherAgeAtLeast, &min_age));
+		SeqList_Traverse(seq_list, TeacherPrint);
+		printf("DeleteRange(1, 2) = %d\t", SeqList_DeleteRange(seq_list, 1, 2, removed));
+		printf("删除：%s %s\n", removed[0]->name, removed[1]->name);
+		SeqList_Traverse(seq_list, TeacherPrint);
+		SeqList_Destroy(seq_list);
+
+		// 值模式下elems为连续存放的数据元素
+		seq_list = SeqList_CreateSized(2, sizeof(TEACHER));
+		values[0] = t3;
+		values[1] = t4;
+		values[2] = t5;
+		SeqList_InsertBatch(seq_list, 0, values, 3);
+		SeqList_InsertBatch(seq_list, 1, values, 3);
+		printf("RemoveIf(age >= 25) = %d\n", SeqList_RemoveIf(seq_list, TeacherAgeAtLeast, &min_age));
+		SeqList_Traverse(seq_list, TeacherPrint);
+		printf("DeleteRange(0, 2) = %d\t", SeqList_DeleteRange(seq_list, 0, 2, values));
+		printf("删除：%s %s\tlength = %d\n", values[0].name, values[1].name, SeqList_GetLength(seq_list));
+		SeqList_Destroy(seq_list);
+
+		// 每个元素只调用一次pred()
+		seq_list = SeqList_CreateSized(10, sizeof(int));
+		{
+			int calls[10] = {0};
+			int i = 0;
+
+			for (i = 0; i < 10; ++i)
+			{
+				SeqList_Insert(seq_list, i, &i);
+			}
+			printf("RemoveIf(odd) = %d\tpred调用次数：", SeqList_RemoveIf(seq_list, IntOddCounted, calls));
+			for (i = 0; i < 10; ++i)
+			{
+				printf("%d ", calls[i]);
+			}
+			printf("\t剩余：");
+			for (i = 0; i < SeqList_GetLength(seq_list); ++i)
+			{
+				printf("%d ", *(int*)SeqList_GetElem(seq_list, i));
+			}
+			printf("\n");
+		}
+		SeqList_Destroy(seq_list);
+	}
+
+	// 带调用者数据的遍历和多线程遍历
+	printf("\n带调用者数据的遍历和多线程遍历：\n");
+	seq_list = SeqList_Create(8);
+	if (seq_list == NULL)
+	{
+		printf("func main() err: seq_list == NULL\n");
+		return -1;
+	}
+	{
+		int age_sum = 0;
+		int min_age = 24;
+		long long parallel_sum = 0;
+		int target = 0;
+
+		SeqList_Insert(seq_list, 0, (SEQ_LIST_ELEM)&t2);
+		SeqList_Insert(seq_list, 1, (SEQ_LIST_ELEM)&t3);
+		SeqList_Insert(seq_list, 2, (SEQ_LIST_ELEM)&t4);
+		SeqList_Insert(seq_list, 3, (SEQ_LIST_ELEM)&t5);
+		printf("TraverseEx(sum) = %d\t", SeqList_TraverseEx(seq_list, TeacherAgeSum, &age_sum));
+		printf("age_sum = %d\n", age_sum);
+		printf("TraverseEx(age >= 24) = %d\n", SeqList_TraverseEx(seq_list, TeacherAgeAtLeast, &min_age));
+		SeqList_Destroy(seq_list);
+
+		seq_list = SeqList_CreateSized(16, sizeof(int));
+		for (i = 0; i < 100000; ++i)
+		{
+			SeqList_Insert(seq_list, i, &i);
+		}
+		printf("ParallelTraverse(sum, 4) = %d\t", SeqList_ParallelTraverse(seq_list, IntAtomicSum, &parallel_sum, 4));
+		printf("sum = %lld\n", parallel_sum);
+		target = 77777;
+		printf("ParallelTraverse(== 77777, 4) = %d\t", SeqList_ParallelTraverse(seq_list, IntEqualStop, &target, 4));
+		target = 123;
+		printf("ParallelTraverse(== 123, 3) = %d\t", SeqList_ParallelTraverse(seq_list, IntEqualStop, &target, 3));
+		target = -1;
+		printf("ParallelTraverse(== -1, 8) = %d\n", SeqList_ParallelTraverse(seq_list, IntEqualStop, &target, 8));
+		SeqList_Destroy(seq_list);
+	}
+
+	// 线程安全句柄
+	printf("\n*************** 线程安全句柄 ***************\n");
+	{
+		SEQ_LIST_SHARED* shared = SeqList_CreateShared(SeqList_CreateSized(16, sizeof(int)));
+		SHARED_WORKER writers[SHARED_WRITER_NUM];
+		SHARED_WORKER readers[SHARED_WRITER_NUM];
+		pthread_t writer_threads[SHARED_WRITER_NUM];
+		pthread_t reader_threads[SHARED_WRITER_NUM];
+		long long shared_sum = 0;
+		int value = 0;
+
+		// 写线程和读线程同时运行
+		for (i = 0; i < SHARED_WRITER_NUM; ++i)
+		{
+			writers[i].shared = shared;
+			writers[i].first = i * SHARED_VALUE_NUM;
+			readers[i] = writers[i];
+			pthread_create(&writer_threads[i], NULL, SharedWriter, &writers[i]);
+			pthread_create(&reader_threads[i], NULL, SharedReader, &readers[i]);
+		}
+		for (i = 0; i < SHARED_WRITER_NUM; ++i)
+		{
+			pthread_join(writer_threads[i], NULL);
+			pthread_join(reader_threads[i], NULL);
+		}
+		printf("length = %d\tfound = %d %d\t", SeqList_SharedGetLength(shared), readers[0].found, readers[1].found);
+		SeqList_SharedTraverse(shared, IntAtomicSum, &shared_sum);
+		printf("sum = %lld\n", shared_sum);
+
+		// 读取、查找、插入和删除
+		value = 1500;
+		printf("LocateElem(1500) >= 0: %d\t", SeqList_SharedLocateElem(shared, &value, IntCompare) >= 0);
+		value = 5000;
+		printf("LocateElem(5000) = %d\n", SeqList_SharedLocateElem(shared, &value, IntCompare));
+		value = 7;
+		printf("Insert(0, 7) = %d\t", SeqList_SharedInsert(shared, 0, &value));
+		SeqList_SharedGetElem(shared, 0, &value);
+		printf("GetElem(0) = %d\t", value);
+		printf("GetElem(-1) = %d\n", SeqList_SharedGetElem(shared, -1, &value));
+		value = 0;
+		printf("Delete(0) = %d\t", SeqList_SharedDelete(shared, 0, &value));
+		printf("deleted = %d\t", value);
+		value = SHARED_VALUE_NUM;
+		printf("RemoveIf(>= 1000) = %d\t", SeqList_SharedRemoveIf(shared, IntAtLeast, &value));
+		printf("length = %d\n", SeqList_SharedGetLength(shared));
+		SeqList_DestroyShared(shared);
+	}
+
 
 	printf("Hello world!\n");
 	return 0;
@@ -185,3 +527,116 @@ int TeacherCompare(SEQ_LIST_ELEM t1, SEQ_LIST_ELEM t2)
 	return (t1 == t2)?1:0; 
 }
 
+// TEACHER类型按年龄比较的函数
+int TeacherAgeCompare(SEQ_LIST_ELEM t1, SEQ_LIST_ELEM t2)
+{
+	// 参数检查
+	if (t1 == NULL || t2 == NULL)
+	{
+		printf("func TeacherAgeCompare() err: t1 == NULL || t2 == NULL\n");
+		return -1;
+	}
+
+	return (((TEACHER*)t1)->age == ((TEACHER*)t2)->age)?1:0;
+}
+
+// IntList的print函数
+int IntPrint(int* value)
+{
+	printf("%d ", *value);
+	return 0;
+}
+
+// TEACHER类型按年龄排序的比较函数
+int TeacherAgeOrder(SEQ_LIST_ELEM t1, SEQ_LIST_ELEM t2)
+{
+	return ((TEACHER*)t1)->age - ((TEACHER*)t2)->age;
+}
+
+// 年龄不小于*(int*)ctx的TEACHER满足条件
+int TeacherAgeAtLeast(SEQ_LIST_ELEM t, void* ctx)
+{
+	return (((TEACHER*)t)->age >= *(int*)ctx) ? 1 : 0;
+}
+
+// 把TEACHER的年龄累加到*(int*)ctx中
+int TeacherAgeSum(SEQ_LIST_ELEM t, void* ctx)
+{
+	*(int*)ctx += ((TEACHER*)t)->age;
+	return 0;
+}
+
+// 把int原子地累加到*(long long*)ctx中
+int IntAtomicSum(SEQ_LIST_ELEM value, void* ctx)
+{
+	__atomic_add_fetch((long long*)ctx, *(int*)value, __ATOMIC_RELAXED);
+	return 0;
+}
+
+// 遇到等于*(int*)ctx的int时停止
+int IntEqualStop(SEQ_LIST_ELEM value, void* ctx)
+{
+	return (*(int*)value == *(int*)ctx) ? 1 : 0;
+}
+
+// 两个int相等时返回1
+int IntCompare(SEQ_LIST_ELEM a, SEQ_LIST_ELEM b)
+{
+	return (*(int*)a == *(int*)b) ? 1 : 0;
+}
+
+// int不小于*(int*)ctx时返回1
+int IntAtLeast(SEQ_LIST_ELEM value, void* ctx)
+{
+	return (*(int*)value >= *(int*)ctx) ? 1 : 0;
+}
+
+// 在(int*)ctx中记录每个int被调用的次数，int为奇数时返回1
+int IntOddCounted(SEQ_LIST_ELEM value, void* ctx)
+{
+	((int*)ctx)[*(int*)value]++;
+	return (*(int*)value % 2 != 0) ? 1 : 0;
+}
+
+// 写线程，每次在表尾批量插入100个数据
+void* SharedWriter(void* arg)
+{
+	SHARED_WORKER* worker = (SHARED_WORKER*)arg;
+	int batch[100];
+	int i = 0;
+	int j = 0;
+	for (i = 0; i < SHARED_VALUE_NUM; i += 100)
+	{
+		for (j = 0; j < 100; ++j)
+		{
+			batch[j] = worker->first + i + j;
+		}
+		SeqList_SharedInsertBatch(worker->shared, -1, batch, 100);
+	}
+	return NULL;
+}
+
+// 读线程，反复批量查找写线程的数据，直到全部找到
+void* SharedReader(void* arg)
+{
+	SHARED_WORKER* worker = (SHARED_WORKER*)arg;
+	int values[SHARED_VALUE_NUM];
+	SEQ_LIST_ELEM keys[SHARED_VALUE_NUM];
+	int results[SHARED_VALUE_NUM];
+	int i = 0;
+	for (i = 0; i < SHARED_VALUE_NUM; ++i)
+	{
+		values[i] = worker->first + i;
+		keys[i] = &values[i];
+	}
+	do
+	{
+		SeqList_SharedLocateBatch(worker->shared, keys, SHARED_VALUE_NUM, IntCompare, results);
+		worker->found = 0;
+		for (i = 0; i < SHARED_VALUE_NUM; ++i)
+		{
+			worker->found += (results[i] >= 0) ? 1 : 0;
+		}
+	} while (worker->found < SHARED_VALUE_NUM);
+	return NULL;
+}
@@ -0,0 +1,746 @@
+/*****************************************************************************************************************************
+ * File name:	skip_list.cpp
+ * Author:	guoke
+ * Date:	2026.10.19
+ * Description:	C++有序跳表的源文件，该文件包含了skip_list.h中模板类SKIP_LIST_NODE和SKIP_LIST的实现。
+ * History:	1. 2026.10.19 创建并完成初始版本
+ *			2. 2026.10.19 修正<比==粗时SetSlider()找不到排在同序段第一个之后的相等数据
+ ****************************************************************************************************************************/
+
+#include <iostream>
+#include <cstring>
+#include "skip_list.h"
+
+using namespace std;
+
+/****************************************************************** SKIP_LIST_NODE类型API ****************************************************************/
+
+/*
+ * Function:		SKIP_LIST_NODE()
+ * Description:		SKIP_LIST_NODE类的构造函数，数据域调用其无参构造函数，指针域都置NULL，用于构造头结点
+ * Time complexity:	O(level)
+ * Input:
+ *		my_level:	int类型，结点的层数
+ * Output:
+ * Return:
+ */
+template <typename T>
+SKIP_LIST_NODE<T>::SKIP_LIST_NODE(int my_level):forward(NULL), prior(NULL), level(my_level)
+{
+	this->forward = new SKIP_LIST_NODE<T>*[this->level];
+	for (int i = 0; i < this->level; ++i)
+	{
+		this->forward[i] = NULL;
+	}
+}
+
+
+
+/*
+ * Function:		SKIP_LIST_NODE()
+ * Description:		SKIP_LIST_NODE类的有参构造函数，数据域由调用者指定，调用类T的拷贝构造函数，指针域都置NULL
+ * Time complexity:	与类T的拷贝构造函数时间复杂度相同
+ * Input:
+ *		my_data:	const T&类型，初始化结点的数据域的数据
+ *		my_level:	int类型，结点的层数
+ * Output:
+ * Return:
+ */
+template <typename T>
+SKIP_LIST_NODE<T>::SKIP_LIST_NODE(const T& my_data, int my_level):forward(NULL), prior(NULL), level(my_level), data(my_data)
+{
+	this->forward = new SKIP_LIST_NODE<T>*[this->level];
+	for (int i = 0; i < this->level; ++i)
+	{
+		this->forward[i] = NULL;
+	}
+}
+
+
+
+/*
+ * Function:		~SKIP_LIST_NODE()
+ * Description:		SKIP_LIST_NODE类的析构函数，释放各层后继指针数组
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:
+ */
+template <typename T>
+SKIP_LIST_NODE<T>::~SKIP_LIST_NODE()
+{
+	delete[] this->forward;
+	this->forward = NULL;
+}
+
+
+
+/*
+ * Function:		SetNextNode()
+ * Description:		设置该结点第i层的后继结点
+ * Time complexity:	O(1)
+ * Input:
+ *		i:			int类型，层号，取值范围[0, level)
+ *		node:		SKIP_LIST_NODE<T>*类型，后继结点的地址
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int SKIP_LIST_NODE<T>::SetNextNode(int i, SKIP_LIST_NODE<T>* node)
+{
+	// 层号检查
+	if (i < 0 || i >= this->level)
+	{
+		cout << "func SKIP_LIST_NODE<T>::SetNextNode() err: i < 0 || i >= this->level" << endl;
+		return -1;
+	}
+
+	this->forward[i] = node;
+	return 0;
+}
+
+
+
+/*
+ * Function:		GetNextNode()
+ * Description:		获取该结点第i层的后继结点的地址
+ * Time complexity:	O(1)
+ * Input:
+ *		i:			int类型，层号，取值范围[0, level)
+ * Output:
+ * Return:			SKIP_LIST_NODE<T>*类型，第i层的后继结点的地址，没有后继结点返回NULL
+ */
+template <typename T>
+SKIP_LIST_NODE<T>* SKIP_LIST_NODE<T>::GetNextNode(int i) const
+{
+	return this->forward[i];
+}
+
+
+
+/*
+ * Function:		SetPriorNode()
+ * Description:		设置该结点第0层的前驱结点
+ * Time complexity:	O(1)
+ * Input:
+ *		node:		SKIP_LIST_NODE<T>*类型，前驱结点的地址
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int SKIP_LIST_NODE<T>::SetPriorNode(SKIP_LIST_NODE<T>* node)
+{
+	this->prior = node;
+	return 0;
+}
+
+
+
+/*
+ * Function:		GetPriorNode()
+ * Description:		获取该结点第0层的前驱结点的地址
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			SKIP_LIST_NODE<T>*类型，前驱结点的地址
+ */
+template <typename T>
+SKIP_LIST_NODE<T>* SKIP_LIST_NODE<T>::GetPriorNode() const
+{
+	return this->prior;
+}
+
+
+
+/*
+ * Function:		GetLevel()
+ * Description:		获取该结点的层数
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			int类型，结点的层数
+ */
+template <typename T>
+int SKIP_LIST_NODE<T>::GetLevel() const
+{
+	return this->level;
+}
+
+
+
+/*
+ * Function:		GetNodeData()
+ * Description:		获取该结点的数据域的值
+ * Time complexity:	与类T的重载的赋值操作符时间复杂度相同
+ * Input:
+ * Output:
+ *		out_data:	T&类型，通过该引用将该结点的数据传给调用者
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int SKIP_LIST_NODE<T>::GetNodeData(T& out_data) const
+{
+	out_data = this->data;		// 调用类T重载的赋值操作
+	return 0;
+}
+
+
+
+/*
+ * Function:		GetDataRef()
+ * Description:		获取该结点数据域的常引用，比较时不需要拷贝数据
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			const T&类型，结点数据域的引用
+ */
+template <typename T>
+const T& SKIP_LIST_NODE<T>::GetDataRef() const
+{
+	return this->data;
+}
+
+
+/****************************************************************** SKIP_LIST类型API ****************************************************************/
+
+/*
+ * Function:		SKIP_LIST()
+ * Description:		SKIP_LIST类的无参构造函数，构造一个空的跳表
+ * Time complexity:	O(SKIP_LIST_MAX_LEVEL)
+ * Input:
+ * Output:
+ * Return:
+ */
+template <typename T>
+SKIP_LIST<T>::SKIP_LIST():header(SKIP_LIST_MAX_LEVEL), tail(NULL), level(1), length(0), slider(NULL), seed(2463534242u)
+{
+}
+
+
+
+/*
+ * Function:		~SKIP_LIST()
+ * Description:		SKIP_LIST类的析构函数，调用Clear()清空跳表结点
+ * Time complexity:	O(n)
+ * Input:
+ * Output:
+ * Return:
+ */
+template <typename T>
+SKIP_LIST<T>::~SKIP_LIST()
+{
+	this->Clear();
+}
+
+
+
+/*
+ * Function:		Clear()
+ * Description:		沿第0层逐个释放结点，将跳表置为空表
+ * Time complexity:	O(n)
+ * Input:
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int SKIP_LIST<T>::Clear()
+{
+	// 沿第0层释放所有结点，不需要逐个维护索引
+	SKIP_LIST_NODE<T>* current_node = this->header.GetNextNode(0);
+	while (current_node != NULL)
+	{
+		SKIP_LIST_NODE<T>* next_node = current_node->GetNextNode(0);
+		delete current_node;
+		current_node = next_node;
+	}
+
+	// 头结点各层置空
+	for (int i = 0; i < SKIP_LIST_MAX_LEVEL; ++i)
+	{
+		this->header.SetNextNode(i, NULL);
+	}
+
+	this->tail = NULL;
+	this->level = 1;
+	this->length = 0;
+	this->slider = NULL;
+
+	return 0;
+}
+
+
+
+/*
+ * Function:		GetLength()
+ * Description:		获取跳表长度
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			int类型，操作成功返回跳表长度，操作失败返回负数
+ */
+template <typename T>
+int SKIP_LIST<T>::GetLength() const
+{
+	return this->length;
+}
+
+
+
+/*
+ * Function:		IsEmpty()
+ * Description:		判断跳表是否为空表
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			bool类型，如果跳表为空表返回true，如果跳表不为空表则返回false
+ */
+template <typename T>
+bool SKIP_LIST<T>::IsEmpty() const
+{
+	return (this->length == 0) ? true : false;
+}
+
+
+
+/*
+ * Function:		ResetSlider()
+ * Description:		重置跳表的游标，如果跳表中有结点，游标指向第一个（最小的）结点；如果跳表中没有结点，游标置NULL
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int SKIP_LIST<T>::ResetSlider()
+{
+	this->slider = this->header.GetNextNode(0);			// 空表时为NULL
+	return 0;
+}
+
+
+
+/*
+ * Function:		GetSlider()
+ * Description:		获取跳表游标指向的结点数据
+ * Time complexity:	与类T的重载的赋值操作符的时间复杂度相同
+ * Input:
+ * Output:
+ *		out_data:	T&类型，通过该引用，将游标指向的结点的数据传给调用者
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int SKIP_LIST<T>::GetSlider(T& out_data) const
+{
+	// 如果跳表为空表时，报错
+	if (this->length == 0)
+	{
+		cout << "func SKIP_LIST<T>::GetSlider() err: this->length == 0" << endl;
+		return -1;
+	}
+
+	this->slider->GetNodeData(out_data);
+	return 0;
+}
+
+
+
+/*
+ * Function:		SliderForward()
+ * Description:		获取当前游标指向的结点的数据，游标指向其后继结点，最后一个结点的后继为第一个结点
+ * Time complexity:	与类T的重载的赋值操作符的时间复杂度相同
+ * Input:
+ * Output:
+ *		out_data:	T&类型，通过该引用，将游标指向的结点的数据传给调用者
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int SKIP_LIST<T>::SliderForward(T& out_data)
+{
+	// 如果跳表为空表，报错
+	if (this->length == 0)
+	{
+		cout << "func SKIP_LIST<T>::SliderForward() err: this->length == 0" << endl;
+		return -1;
+	}
+
+	// 缓存当前游标指向结点的数据，游标指向其后继结点，到达最后一个结点之后回绕到第一个结点
+	this->slider->GetNodeData(out_data);
+	this->slider = this->slider->GetNextNode(0);
+	if (this->slider == NULL)
+	{
+		this->slider = this->header.GetNextNode(0);
+	}
+
+	return 0;
+}
+
+
+
+/*
+ * Function:		SliderBackward()
+ * Description:		获取当前游标指向的结点的数据，游标指向其前驱结点，第一个结点的前驱为最后一个结点
+ * Time complexity:	与类T的重载的赋值操作符的时间复杂度相同
+ * Input:
+ * Output:
+ *		out_data:	T&类型，通过该引用，将游标指向的结点的数据传给调用者
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int SKIP_LIST<T>::SliderBackward(T& out_data)
+{
+	// 如果跳表为空表，报错
+	if (this->length == 0)
+	{
+		cout << "func SKIP_LIST<T>::SliderBackward() err: this->length == 0" << endl;
+		return -1;
+	}
+
+	// 缓存当前游标指向结点的数据，游标指向其前驱结点，到达第一个结点之后回绕到最后一个结点
+	this->slider->GetNodeData(out_data);
+	this->slider = this->slider->GetPriorNode();
+	if (this->slider == NULL)
+	{
+		this->slider = this->tail;
+	}
+
+	return 0;
+}
+
+
+
+/*
+ * Function:		Insert()
+ * Description:		按序插入一个结点，相等的数据插在已有数据之后，插入完成后游标指向插入的结点
+ * Time complexity:	期望O(log n)次类T的<操作
+ * Input:
+ *		data:		const T&类型，插入的数据
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int SKIP_LIST<T>::Insert(const T& data)
+{
+	SKIP_LIST_NODE<T>* update[SKIP_LIST_MAX_LEVEL];		// 每一层中位于插入位置之前的最后一个结点
+
+	// 自顶向下查找插入位置，跳过所有不大于data的结点，保证相等的数据按插入顺序排列
+	SKIP_LIST_NODE<T>* current_node = &this->header;
+	for (int i = this->level - 1; i >= 0; --i)
+	{
+		while (current_node->GetNextNode(i) != NULL && !(data < current_node->GetNextNode(i)->GetDataRef()))
+		{
+			current_node = current_node->GetNextNode(i);
+		}
+		update[i] = current_node;
+	}
+
+	// 生成新结点的层数，超过当前最大层数的部分由头结点作为前驱
+	int node_level = this->RandomLevel();
+	if (node_level > this->level)
+	{
+		for (int i = this->level; i < node_level; ++i)
+		{
+			update[i] = &this->header;
+		}
+		this->level = node_level;
+	}
+
+	// 申请结点空间
+	SKIP_LIST_NODE<T>* skip_list_node = new SKIP_LIST_NODE<T>(data, node_level);
+	if (skip_list_node == NULL)
+	{
+		cout << "func SKIP_LIST<T>::Insert() err: skip_list_node == NULL" << endl;
+		return -1;
+	}
+
+	// 在每一层中链接新结点
+	for (int i = 0; i < node_level; ++i)
+	{
+		skip_list_node->SetNextNode(i, update[i]->GetNextNode(i));
+		update[i]->SetNextNode(i, skip_list_node);
+	}
+
+	// 维护第0层的前驱指针，第一个结点的前驱为NULL
+	skip_list_node->SetPriorNode((update[0] == &this->header) ? NULL : update[0]);
+	if (skip_list_node->GetNextNode(0) != NULL)
+	{
+		skip_list_node->GetNextNode(0)->SetPriorNode(skip_list_node);
+	}
+	else
+	{
+		this->tail = skip_list_node;
+	}
+
+	// 插入完成之后slider指向插入结点，跳表长度加1
+	this->slider = skip_list_node;
+	this->length ++;
+
+	return 0;
+}
+
+
+
+/*
+ * Function:			DeleteSlider()
+ * Description:			删除游标指向的结点，获取删除结点的数据，游标指向删除结点的后继结点（删除最后一个结点时游标指向第一个结点）。如果删除之后跳表变为空表，游标置NULL
+ * Time complexity:		期望O(log n)次类T的<操作
+ * Input:
+ * Output:
+ *		deleted_data:	T&类型，通过该引用将删除的结点数据传出给调用者
+ * Return:				int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int SKIP_LIST<T>::DeleteSlider(T& deleted_data)
+{
+	SKIP_LIST_NODE<T>* update[SKIP_LIST_MAX_LEVEL];		// 每一层中位于删除结点之前的最后一个结点
+
+	// 如果跳表为空表，报错
+	if (this->length == 0)
+	{
+		cout << "func SKIP_LIST<T>::DeleteSlider() err: this->length == 0" << endl;
+		return -1;
+	}
+
+	SKIP_LIST_NODE<T>* deleted_node = this->slider;
+	const T& deleted_key = deleted_node->GetDataRef();
+
+	// 自顶向下查找删除结点在每一层的前驱。高于删除结点层数的层只需定位到下界；
+	// 删除结点所在的层中，再越过与其相等的结点直到删除结点本身
+	SKIP_LIST_NODE<T>* current_node = &this->header;
+	for (int i = this->level - 1; i >= 0; --i)
+	{
+		while (current_node->GetNextNode(i) != NULL && current_node->GetNextNode(i)->GetDataRef() < deleted_key)
+		{
+			current_node = current_node->GetNextNode(i);
+		}
+		if (i < deleted_node->GetLevel())
+		{
+			while (current_node->GetNextNode(i) != deleted_node)
+			{
+				current_node = current_node->GetNextNode(i);
+			}
+		}
+		update[i] = current_node;
+	}
+
+	// 通过引用传出结点数据
+	deleted_node->GetNodeData(deleted_data);
+
+	// 在每一层中摘除结点
+	for (int i = 0; i < deleted_node->GetLevel(); ++i)
+	{
+		update[i]->SetNextNode(i, deleted_node->GetNextNode(i));
+	}
+
+	// 维护第0层的前驱指针和尾结点
+	SKIP_LIST_NODE<T>* next_node = deleted_node->GetNextNode(0);
+	if (next_node != NULL)
+	{
+		next_node->SetPriorNode(deleted_node->GetPriorNode());
+	}
+	else
+	{
+		this->tail = deleted_node->GetPriorNode();
+	}
+
+	// 降低空层
+	while (this->level > 1 && this->header.GetNextNode(this->level - 1) == NULL)
+	{
+		this->level --;
+	}
+
+	// 游标指向删除结点的后继结点，删除的是最后一个结点时回绕到第一个结点，空表时为NULL
+	this->slider = (next_node != NULL) ? next_node : this->header.GetNextNode(0);
+
+	// 释放删除结点空间，跳表长度减1
+	delete deleted_node;
+	this->length --;
+
+	return 0;
+}
+
+
+
+/*
+ * Function:		SetSlider()
+ * Description:		如果跳表中存在某个结点包含数据data，将游标指向第一个包含该数据的结点。
+ *					从第一个不小于data的结点开始，在与data排序相等（!(data < x)）的结点中找第一个==data的结点，
+ *					因此类T的<可以比==粗（例如只比较部分字段）
+ * Time complexity:	期望O(log n + k)次类T的<操作，k为与data排序相等的结点数
+ * Input:
+ *		data:		const T&类型，在跳表中匹配该数据
+ * Output:
+ * Return:			int类型，操作成功返回0，没有找到返回-2，其他错误返回负数
+ */
+template <typename T>
+int SKIP_LIST<T>::SetSlider(const T& data)
+{
+	// 如果跳表为空表，报错
+	if (this->length == 0)
+	{
+		cout << "func SKIP_LIST<T>::SetSlider() err: this->length == 0" << endl;
+		return -1;
+	}
+
+	// 从第一个不小于data的结点开始，在排序上与data相等的一段结点中找第一个==data的结点
+	SKIP_LIST_NODE<T>* found_node = this->FindLowerBound(data, NULL);
+	while (found_node != NULL && !(data < found_node->GetDataRef()) && !(data == found_node->GetDataRef()))
+	{
+		found_node = found_node->GetNextNode(0);
+	}
+	if (found_node == NULL || data < found_node->GetDataRef())
+	{
+		cout << "func SKIP_LIST<T>::SetSlider() err: data not found" << endl;
+		return -2;
+	}
+
+	this->slider = found_node;
+	return 0;
+}
+
+
+
+/*
+ * Function:		LowerBound()
+ * Description:		将游标指向第一个不小于data的结点
+ * Time complexity:	期望O(log n)次类T的<操作
+ * Input:
+ *		data:		const T&类型，查找的下界
+ * Output:
+ * Return:			int类型，操作成功返回0，所有结点都小于data时返回-2且游标不变
+ */
+template <typename T>
+int SKIP_LIST<T>::LowerBound(const T& data)
+{
+	SKIP_LIST_NODE<T>* found_node = this->FindLowerBound(data, NULL);
+	if (found_node == NULL)
+	{
+		return -2;
+	}
+
+	this->slider = found_node;
+	return 0;
+}
+
+
+
+/*
+ * Function:		Traverse()
+ * Description:		按从小到大的顺序遍历跳表，每个结点的数据data作为参数，调用函数visit()，不改变游标
+ * Time complexity:	假设类T重载的赋值操作符时间复杂度为O(m)，visit()的时间复杂度为O(t)，则本函数时间复杂度为O(n*m + n*t)
+ * Input:
+ *		visit:		int (*)(T& data)类型，函数指针，以类T的引用为参数
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int SKIP_LIST<T>::Traverse(int (*visit)(T& data))
+{
+	// 沿第0层遍历
+	for (SKIP_LIST_NODE<T>* current_node = this->header.GetNextNode(0); current_node != NULL; current_node = current_node->GetNextNode(0))
+	{
+		T current_node_data;								// 用来暂存当前结点的数据
+		current_node->GetNodeData(current_node_data);
+
+		int func_status = visit(current_node_data);
+		if (func_status != 0)
+		{
+			cout << "func SKIP_LIST<T>::Traverse() err: func_status != 0" << endl;
+			return -1;
+		}
+	}
+	return 0;
+}
+
+
+
+/*
+ * Function:		TraverseRange()
+ * Description:		按从小到大的顺序遍历区间[low, high)内的结点，每个结点的数据data作为参数，调用函数visit()，不改变游标
+ * Time complexity:	期望O(log n + k)，k为区间内的结点数
+ * Input:
+ *		low:		const T&类型，区间下界（包含）
+ *		high:		const T&类型，区间上界（不包含）
+ *		visit:		int (*)(T& data)类型，函数指针，以类T的引用为参数
+ * Output:
+ * Return:			int类型，操作成功返回0，操作失败返回负数
+ */
+template <typename T>
+int SKIP_LIST<T>::TraverseRange(const T& low, const T& high, int (*visit)(T& data))
+{
+	// 通过索引定位区间起点，之后沿第0层遍历
+	for (SKIP_LIST_NODE<T>* current_node = this->FindLowerBound(low, NULL);
+		current_node != NULL && current_node->GetDataRef() < high;
+		current_node = current_node->GetNextNode(0))
+	{
+		T current_node_data;
+		current_node->GetNodeData(current_node_data);
+
+		int func_status = visit(current_node_data);
+		if (func_status != 0)
+		{
+			cout << "func SKIP_LIST<T>::TraverseRange() err: func_status != 0" << endl;
+			return -1;
+		}
+	}
+	return 0;
+}
+
+
+
+/*
+ * Function:		RandomLevel()
+ * Description:		以1/4的概率逐层晋升，生成新结点的层数
+ * Time complexity:	O(1)
+ * Input:
+ * Output:
+ * Return:			int类型，取值范围[1, SKIP_LIST_MAX_LEVEL]
+ */
+template <typename T>
+int SKIP_LIST<T>::RandomLevel()
+{
+	int node_level = 1;
+	while (node_level < SKIP_LIST_MAX_LEVEL)
+	{
+		// xorshift32伪随机数
+		this->seed ^= this->seed << 13;
+		this->seed ^= this->seed >> 17;
+		this->seed ^= this->seed << 5;
+
+		if ((this->seed & 3) != 0)
+		{
+			break;
+		}
+		node_level ++;
+	}
+	return node_level;
+}
+
+
+
+/*
+ * Function:		FindLowerBound()
+ * Description:		查找第一个不小于data的结点，update不为NULL时记录每一层中位于该结点之前的最后一个结点
+ * Time complexity:	期望O(log n)次类T的<操作
+ * Input:
+ *		data:		const T&类型，查找的下界
+ * Output:
+ *		update:		SKIP_LIST_NODE<T>**类型，长度为SKIP_LIST_MAX_LEVEL的数组，可以为NULL
+ * Return:			SKIP_LIST_NODE<T>*类型，第一个不小于data的结点，不存在时返回NULL
+ */
+template <typename T>
+SKIP_LIST_NODE<T>* SKIP_LIST<T>::FindLowerBound(const T& data, SKIP_LIST_NODE<T>** update)
+{
+	SKIP_LIST_NODE<T>* current_node = &this->header;
+	for (int i = this->level - 1; i >= 0; --i)
+	{
+		while (current_node->GetNextNode(i) != NULL && current_node->GetNextNode(i)->GetDataRef() < data)
+		{
+			current_node = current_node->GetNextNode(i);
+		}
+		if (update != NULL)
+		{
+			update[i] = current_node;
+		}
+	}
+	return current_node->GetNextNode(0);
+}
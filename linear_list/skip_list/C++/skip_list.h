@@ -0,0 +1,346 @@
+/*****************************************************************************************************************************
+ * File name:	skip_list.h
+ * Author:	guoke
+ * Date:	2026.10.19
+ * Description:	C++有序跳表的头文件，该文件包含了模板类SKIP_LIST_NODE和SKIP_LIST的声明，其实现包含在文件skip_list.cpp中。
+ *				第0层是按序排列的双向链表，保留了LINK_LIST的游标操作（游标前后移动为O(1)），高层索引使定位、有序插入和删除为O(log n)。
+ *				类T需要重载<操作符和==操作符。
+ * History:	1. 2026.10.19 创建并完成初始版本
+ *			2. 2026.10.19 修正<比==粗时SetSlider()找不到排在同序段第一个之后的相等数据
+ ****************************************************************************************************************************/
+
+#ifndef _SKIP_LIST_H_
+#define _SKIP_LIST_H_
+
+#define SKIP_LIST_MAX_LEVEL		32			// 跳表的最大层数
+
+/****************************************************************** SKIP_LIST_NODE类型，跳表中的结点 ****************************************************************/
+template <typename T>
+class SKIP_LIST_NODE{
+private:
+	SKIP_LIST_NODE**	forward;						// 各层的后继结点，forward[0]为第0层的后继结点
+	SKIP_LIST_NODE*		prior;							// 第0层的前驱结点
+	int					level;							// 结点的层数
+	T					data;							// 数据域
+
+public:
+	/*
+	 * Function:		SKIP_LIST_NODE()
+	 * Description:		SKIP_LIST_NODE类的构造函数，数据域调用其无参构造函数，指针域都置NULL，用于构造头结点
+	 * Time complexity:	O(level)
+	 * Input:
+	 *		my_level:	int类型，结点的层数
+	 * Output:
+	 * Return:
+	 */
+	SKIP_LIST_NODE(int my_level);
+
+	/*
+	 * Function:		SKIP_LIST_NODE()
+	 * Description:		SKIP_LIST_NODE类的有参构造函数，数据域由调用者指定，调用类T的拷贝构造函数，指针域都置NULL
+	 * Time complexity:	与类T的拷贝构造函数时间复杂度相同
+	 * Input:
+	 *		my_data:	const T&类型，初始化结点的数据域的数据
+	 *		my_level:	int类型，结点的层数
+	 * Output:
+	 * Return:
+	 */
+	SKIP_LIST_NODE(const T& my_data, int my_level);
+
+	/*
+	 * Function:		~SKIP_LIST_NODE()
+	 * Description:		SKIP_LIST_NODE类的析构函数，释放各层后继指针数组
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:
+	 */
+	~SKIP_LIST_NODE();
+
+private:
+	SKIP_LIST_NODE(const SKIP_LIST_NODE&);				// 结点持有指针数组，禁止拷贝
+	SKIP_LIST_NODE& operator=(const SKIP_LIST_NODE&);
+
+public:
+	/*
+	 * Function:		SetNextNode()
+	 * Description:		设置该结点第i层的后继结点
+	 * Time complexity:	O(1)
+	 * Input:
+	 *		i:			int类型，层号，取值范围[0, level)
+	 *		node:		SKIP_LIST_NODE<T>*类型，后继结点的地址
+	 * Output:
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int SetNextNode(int i, SKIP_LIST_NODE* node);
+
+	/*
+	 * Function:		GetNextNode()
+	 * Description:		获取该结点第i层的后继结点的地址
+	 * Time complexity:	O(1)
+	 * Input:
+	 *		i:			int类型，层号，取值范围[0, level)
+	 * Output:
+	 * Return:			SKIP_LIST_NODE<T>*类型，第i层的后继结点的地址，没有后继结点返回NULL
+	 */
+	SKIP_LIST_NODE* GetNextNode(int i) const;
+
+	/*
+	 * Function:		SetPriorNode()
+	 * Description:		设置该结点第0层的前驱结点
+	 * Time complexity:	O(1)
+	 * Input:
+	 *		node:		SKIP_LIST_NODE<T>*类型，前驱结点的地址
+	 * Output:
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int SetPriorNode(SKIP_LIST_NODE* node);
+
+	/*
+	 * Function:		GetPriorNode()
+	 * Description:		获取该结点第0层的前驱结点的地址
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			SKIP_LIST_NODE<T>*类型，前驱结点的地址
+	 */
+	SKIP_LIST_NODE* GetPriorNode() const;
+
+	/*
+	 * Function:		GetLevel()
+	 * Description:		获取该结点的层数
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			int类型，结点的层数
+	 */
+	int GetLevel() const;
+
+	/*
+	 * Function:		GetNodeData()
+	 * Description:		获取该结点的数据域的值
+	 * Time complexity:	与类T的重载的赋值操作符时间复杂度相同
+	 * Input:
+	 * Output:
+	 *		out_data:	T&类型，通过该引用将该结点的数据传给调用者
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int GetNodeData(T& out_data) const;
+
+	/*
+	 * Function:		GetDataRef()
+	 * Description:		获取该结点数据域的常引用，比较时不需要拷贝数据
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			const T&类型，结点数据域的引用
+	 */
+	const T& GetDataRef() const;
+};
+
+
+
+/****************************************************************** SKIP_LIST类型，有序跳表 ****************************************************************/
+template <typename T>
+class SKIP_LIST{
+private:
+	SKIP_LIST_NODE<T>	header;				// 头结点，拥有SKIP_LIST_MAX_LEVEL层，forward[i]指向第i层的第一个结点
+	SKIP_LIST_NODE<T>*	tail;				// 第0层的最后一个结点，用于游标从第一个结点回绕到最后一个结点
+	int					level;				// 当前跳表中结点的最大层数
+	int					length;				// 跳表长度
+	SKIP_LIST_NODE<T>*	slider;				// 游标，用来辅助定位
+	unsigned int		seed;				// 生成随机层数的种子
+
+public:
+	/*
+	 * Function:		SKIP_LIST()
+	 * Description:		SKIP_LIST类的无参构造函数，构造一个空的跳表
+	 * Time complexity:	O(SKIP_LIST_MAX_LEVEL)
+	 * Input:
+	 * Output:
+	 * Return:
+	 */
+	SKIP_LIST();
+
+	/*
+	 * Function:		~SKIP_LIST()
+	 * Description:		SKIP_LIST类的析构函数，调用Clear()清空跳表结点
+	 * Time complexity:	O(n)
+	 * Input:
+	 * Output:
+	 * Return:
+	 */
+	~SKIP_LIST();
+
+private:
+	SKIP_LIST(const SKIP_LIST&);			// 禁止拷贝
+	SKIP_LIST& operator=(const SKIP_LIST&);
+
+public:
+	/*
+	 * Function:		Clear()
+	 * Description:		沿第0层逐个释放结点，将跳表置为空表
+	 * Time complexity:	O(n)
+	 * Input:
+	 * Output:
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int Clear();
+
+	/*
+	 * Function:		GetLength()
+	 * Description:		获取跳表长度
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			int类型，操作成功返回跳表长度，操作失败返回负数
+	 */
+	int GetLength() const;
+
+	/*
+	 * Function:		IsEmpty()
+	 * Description:		判断跳表是否为空表
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			bool类型，如果跳表为空表返回true，如果跳表不为空表则返回false
+	 */
+	bool IsEmpty() const;
+
+	/*
+	 * Function:		ResetSlider()
+	 * Description:		重置跳表的游标，如果跳表中有结点，游标指向第一个（最小的）结点；如果跳表中没有结点，游标置NULL
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int ResetSlider();
+
+	/*
+	 * Function:		GetSlider()
+	 * Description:		获取跳表游标指向的结点数据
+	 * Time complexity:	与类T的重载的赋值操作符的时间复杂度相同
+	 * Input:
+	 * Output:
+	 *		out_data:	T&类型，通过该引用，将游标指向的结点的数据传给调用者
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int GetSlider(T& out_data) const;
+
+	/*
+	 * Function:		SliderForward()
+	 * Description:		获取当前游标指向的结点的数据，游标指向其后继结点，最后一个结点的后继为第一个结点
+	 * Time complexity:	与类T的重载的赋值操作符的时间复杂度相同
+	 * Input:
+	 * Output:
+	 *		out_data:	T&类型，通过该引用，将游标指向的结点的数据传给调用者
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int SliderForward(T& out_data);
+
+	/*
+	 * Function:		SliderBackward()
+	 * Description:		获取当前游标指向的结点的数据，游标指向其前驱结点，第一个结点的前驱为最后一个结点
+	 * Time complexity:	与类T的重载的赋值操作符的时间复杂度相同
+	 * Input:
+	 * Output:
+	 *		out_data:	T&类型，通过该引用，将游标指向的结点的数据传给调用者
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int SliderBackward(T& out_data);
+
+	/*
+	 * Function:		Insert()
+	 * Description:		按序插入一个结点，相等的数据插在已有数据之后，插入完成后游标指向插入的结点
+	 * Time complexity:	期望O(log n)次类T的<操作
+	 * Input:
+	 *		data:		const T&类型，插入的数据
+	 * Output:
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int Insert(const T& data);
+
+	/*
+	 * Function:			DeleteSlider()
+	 * Description:			删除游标指向的结点，获取删除结点的数据，游标指向删除结点的后继结点（删除最后一个结点时游标指向第一个结点）。如果删除之后跳表变为空表，游标置NULL
+	 * Time complexity:		期望O(log n)次类T的<操作
+	 * Input:
+	 * Output:
+	 *		deleted_data:	T&类型，通过该引用将删除的结点数据传出给调用者
+	 * Return:				int类型，操作成功返回0，操作失败返回负数
+	 */
+	int DeleteSlider(T& deleted_data);
+
+	/*
+	 * Function:		SetSlider()
+	 * Description:		如果跳表中存在某个结点包含数据data，将游标指向第一个包含该数据的结点。
+	 *					从第一个不小于data的结点开始，在与data排序相等（!(data < x)）的结点中找第一个==data的结点，
+	 *					因此类T的<可以比==粗（例如只比较部分字段）
+	 * Time complexity:	期望O(log n + k)次类T的<操作，k为与data排序相等的结点数
+	 * Input:
+	 *		data:		const T&类型，在跳表中匹配该数据
+	 * Output:
+	 * Return:			int类型，操作成功返回0，没有找到返回-2，其他错误返回负数
+	 */
+	int SetSlider(const T& data);
+
+	/*
+	 * Function:		LowerBound()
+	 * Description:		将游标指向第一个不小于data的结点
+	 * Time complexity:	期望O(log n)次类T的<操作
+	 * Input:
+	 *		data:		const T&类型，查找的下界
+	 * Output:
+	 * Return:			int类型，操作成功返回0，所有结点都小于data时返回-2且游标不变
+	 */
+	int LowerBound(const T& data);
+
+	/*
+	 * Function:		Traverse()
+	 * Description:		按从小到大的顺序遍历跳表，每个结点的数据data作为参数，调用函数visit()，不改变游标
+	 * Time complexity:	假设类T重载的赋值操作符时间复杂度为O(m)，visit()的时间复杂度为O(t)，则本函数时间复杂度为O(n*m + n*t)
+	 * Input:
+	 *		visit:		int (*)(T& data)类型，函数指针，以类T的引用为参数
+	 * Output:
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int Traverse(int (*visit)(T& data));
+
+	/*
+	 * Function:		TraverseRange()
+	 * Description:		按从小到大的顺序遍历区间[low, high)内的结点，每个结点的数据data作为参数，调用函数visit()，不改变游标
+	 * Time complexity:	期望O(log n + k)，k为区间内的结点数
+	 * Input:
+	 *		low:		const T&类型，区间下界（包含）
+	 *		high:		const T&类型，区间上界（不包含）
+	 *		visit:		int (*)(T& data)类型，函数指针，以类T的引用为参数
+	 * Output:
+	 * Return:			int类型，操作成功返回0，操作失败返回负数
+	 */
+	int TraverseRange(const T& low, const T& high, int (*visit)(T& data));
+
+private:
+	/*
+	 * Function:		RandomLevel()
+	 * Description:		以1/4的概率逐层晋升，生成新结点的层数
+	 * Time complexity:	O(1)
+	 * Input:
+	 * Output:
+	 * Return:			int类型，取值范围[1, SKIP_LIST_MAX_LEVEL]
+	 */
+	int RandomLevel();
+
+	/*
+	 * Function:		FindLowerBound()
+	 * Description:		查找第一个不小于data的结点，update不为NULL时记录每一层中位于该结点之前的最后一个结点
+	 * Time complexity:	期望O(log n)次类T的<操作
+	 * Input:
+	 *		data:		const T&类型，查找的下界
+	 * Output:
+	 *		update:		SKIP_LIST_NODE<T>**类型，长度为SKIP_LIST_MAX_LEVEL的数组，可以为NULL
+	 * Return:			SKIP_LIST_NODE<T>*类型，第一个不小于data的结点，不存在时返回NULL
+	 */
+	SKIP_LIST_NODE<T>* FindLowerBound(const T& data, SKIP_LIST_NODE<T>** update);
+};
+#endif
@@ -0,0 +1,196 @@
+/******************************************************************************************************************************************
+ * File name:	test.cpp
+ * Author:	guoke
+ * Date:	2026.10.19
+ * Description:	C++有序跳表库skip_list.cpp、skip_list.h的API测试程序
+ * History:	1. 2026.10.19 创建并完成初始版本
+ *			2. 2026.10.19 增加年龄相同、名字不同时设置游标的测试
+ *****************************************************************************************************************************************/
+
+#include <iostream>
+#include <cstdlib>
+#include <string>
+#include "skip_list.cpp"
+
+using namespace std;
+
+
+// TEACHER类型，按年龄排序
+class TEACHER{
+private:
+	int age;
+	string name;
+public:
+	TEACHER():age(0),name(""){}											// Constructor
+	TEACHER(int _age, const string _name):age(_age),name(_name){}		// Constructor with parameter
+	TEACHER(const TEACHER& t):age(t.age),name(t.name){}					// Copy constructor
+
+public:
+	/* 输出类信息 */
+	int PrintInfo(){cout << "age = " << age << "\tname = " << name << endl; return 0;}
+
+public:
+	/* 重载赋值操作符 */
+	TEACHER& operator=(const TEACHER& t);
+
+	/* 重载==操作符 */
+	bool operator==(const TEACHER& t) const;
+
+	/* 重载<操作符，按年龄比较 */
+	bool operator<(const TEACHER& t) const;
+};
+
+// 打印TEACHER类信息
+int PrintTeacher(TEACHER& t);
+
+// 检查int类型数据是否有序
+int CheckOrder(int& data);
+static int last_data = 0;
+static int visit_count = 0;
+
+int main(void)
+{
+	TEACHER t1(21, "teacher_01"), t2(22, "teacher_02"), t3(23, "teacher_03"), t4(24, "teacher_04"), t5(25, "teacher_05");
+	TEACHER tmp;
+
+	// 创建跳表
+	cout << "\n***************************************** 创建跳表 **********************************" << endl;
+	SKIP_LIST<TEACHER> teacher_list;
+	cout << "length = " << teacher_list.GetLength() << endl;
+
+	// 乱序插入元素
+	cout << "\n***************************************** 乱序插入元素 **********************************" << endl;
+	teacher_list.Insert(t3);
+	teacher_list.Insert(t1);
+	teacher_list.Insert(t5);
+	teacher_list.Insert(t2);
+	teacher_list.Insert(t4);
+	teacher_list.GetSlider(tmp);
+	cout << "length = " << teacher_list.GetLength() << ", slider is ";
+	tmp.PrintInfo();
+
+	// 遍历跳表
+	cout << "\n***************************************** 遍历跳表 **********************************" << endl;
+	teacher_list.Traverse(PrintTeacher);
+
+	// 遍历区间[22, 25)
+	cout << "\n***************************************** 遍历区间[22, 25) **********************************" << endl;
+	teacher_list.TraverseRange(TEACHER(22, ""), TEACHER(25, ""), PrintTeacher);
+
+	// 设置游标位置并前后移动游标
+	cout << "\n***************************************** 设置游标位置并前后移动游标 **********************************" << endl;
+	teacher_list.SetSlider(t3);
+	for (int i = 0; i < teacher_list.GetLength(); ++i)
+	{
+		teacher_list.SliderForward(tmp);
+		tmp.PrintInfo();
+	}
+	teacher_list.SetSlider(t3);
+	for (int i = 0; i < teacher_list.GetLength(); ++i)
+	{
+		teacher_list.SliderBackward(tmp);
+		tmp.PrintInfo();
+	}
+
+	// 下界定位
+	cout << "\n***************************************** 下界定位 **********************************" << endl;
+	teacher_list.LowerBound(TEACHER(23, ""));
+	teacher_list.GetSlider(tmp);
+	cout << "lower bound of 23: ";
+	tmp.PrintInfo();
+	cout << "lower bound of 26: " << teacher_list.LowerBound(TEACHER(26, "")) << endl;
+
+	// 年龄相同、名字不同的数据：<只比较年龄，==还比较名字
+	cout << "\n***************************************** 设置游标到年龄相同的数据 **********************************" << endl;
+	teacher_list.Insert(TEACHER(23, "teacher_03b"));
+	teacher_list.Insert(TEACHER(23, "teacher_03c"));
+	cout << "set slider to teacher_03c: " << teacher_list.SetSlider(TEACHER(23, "teacher_03c")) << ", slider is ";
+	teacher_list.GetSlider(tmp);
+	tmp.PrintInfo();
+	cout << "set slider to teacher_03b: " << teacher_list.SetSlider(TEACHER(23, "teacher_03b")) << ", slider is ";
+	teacher_list.GetSlider(tmp);
+	tmp.PrintInfo();
+	int not_found = teacher_list.SetSlider(TEACHER(23, "teacher_03d"));
+	cout << "set slider to teacher_03d: " << not_found << endl;
+
+	// 删除数据
+	cout << "\n***************************************** 删除数据 **********************************" << endl;
+	teacher_list.ResetSlider();
+	while (teacher_list.GetLength())
+	{
+		teacher_list.DeleteSlider(tmp);
+		tmp.PrintInfo();
+		cout << "length = " << teacher_list.GetLength() << endl;
+	}
+
+	// 大量数据的插入、查找和删除
+	cout << "\n***************************************** 大量数据的插入、查找和删除 **********************************" << endl;
+	SKIP_LIST<int> int_list;
+	srand(1);
+	for (int i = 0; i < 100000; ++i)
+	{
+		int_list.Insert(rand() % 50000);
+	}
+	last_data = -1;
+	visit_count = 0;
+	cout << "insert: length = " << int_list.GetLength() << ", ordered = " << (int_list.Traverse(CheckOrder) == 0) << ", visited = " << visit_count << endl;
+
+	int deleted_count = 0;
+	for (int key = 0; key < 50000; key += 2)
+	{
+		int deleted_data = 0;
+		while (int_list.LowerBound(key) == 0 && int_list.GetSlider(deleted_data) == 0 && deleted_data == key)
+		{
+			int_list.DeleteSlider(deleted_data);
+			deleted_count ++;
+		}
+	}
+	last_data = -1;
+	visit_count = 0;
+	cout << "delete even keys: deleted = " << deleted_count << ", length = " << int_list.GetLength() << ", ordered = " << (int_list.Traverse(CheckOrder) == 0) << ", visited = " << visit_count << endl;
+
+	cout << "Hello world!" << endl;
+	return 0;
+}
+
+
+/* Class of TEACHER overloads = */
+TEACHER& TEACHER::operator=(const TEACHER& t)
+{
+	this->age = t.age;
+	this->name = t.name;
+	return *this;
+}
+
+/* Class of TEACHER overloads == */
+bool TEACHER::operator==(const TEACHER& t) const
+{
+	return (age == t.age && name == t.name) ? true : false;
+}
+
+/* Class of TEACHER overloads < */
+bool TEACHER::operator<(const TEACHER& t) const
+{
+	return age < t.age;
+}
+
+
+
+// 打印TEACHER类信息
+int PrintTeacher(TEACHER& t)
+{
+	t.PrintInfo();
+	return 0;
+}
+
+// 检查int类型数据是否有序，并统计访问的结点数
+int CheckOrder(int& data)
+{
+	if (data < last_data)
+	{
+		return -1;
+	}
+	last_data = data;
+	visit_count ++;
+	return 0;
+}